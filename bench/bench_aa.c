@@ -0,0 +1,136 @@
+/*
+ * Anti-aliasing benchmark. Draws a few thousand small random triangles,
+ * plenty of edges, through the post chain at 1280x720 with tone mapping
+ * and each anti-aliasing mode, waiting for the GPU after each stage, and
+ * prints a table of what the scene and the post passes cost under each
+ * and the memory the chain holds.
+ *
+ *     bench_aa [triangles] [frames]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_gl.h"
+#include "assets.h"
+#include "post.h"
+#include "shader.h"
+#include "timing.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+
+static float
+random_float(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+int
+main(int argc, char **argv)
+{
+    int triangles = argc > 1 ? atoi(argv[1]) : 4096;
+    int frames = argc > 2 ? atoi(argv[2]) : 30;
+
+    bench_window("bench_aa", WIDTH, HEIGHT);
+    fprintf(stdout, "%s, %d triangles\n", (const char *)glGetString(GL_RENDERER), triangles);
+
+    Assets assets;
+    assets_init(&assets, false);
+    Arena arena;
+    arena_init(&arena, "bench aa", (size_t)triangles * 3 * sizeof(vec4) + (1 << 20));
+
+    Post post;
+    post_init(&post, get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_downsample.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_upsample.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_composite.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_fxaa.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_taa.fs"));
+
+    // flat white triangles a few pixels to a few dozen across, in front of the camera
+    srand(1);
+    vec4 *vertices = ARENA_ARRAY(&arena, vec4, (size_t)triangles * 3);
+    for(int t = 0; t < triangles; t++) {
+        float x = random_float(-1.6f, 1.6f), y = random_float(-0.9f, 0.9f), z = random_float(-4.0f, -2.0f);
+        for(int v = 0; v < 3; v++) {
+            vertices[t * 3 + v][0] = x + random_float(-0.08f, 0.08f);
+            vertices[t * 3 + v][1] = y + random_float(-0.08f, 0.08f);
+            vertices[t * 3 + v][2] = z;
+            vertices[t * 3 + v][3] = 1.0f;
+        }
+    }
+    unsigned int vao, vbo;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vec4) * 3 * (size_t)triangles, vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(vec4), (void *)0);
+    glEnableVertexAttribArray(0);
+
+    unsigned int program = get_shader_program(&assets, &arena, "shaders/shader2.vs", "shaders/shader2.fs");
+    mat4x4 identity, projection, view_projection;
+    mat4x4_identity(identity);
+    glUseProgram(program);
+    glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, (GLfloat *)identity);
+    glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (GLfloat *)identity);
+    glUniform3f(glGetUniformLocation(program, "positionOffset"), 0.0f, 0.0f, 0.0f);
+    glUniform3f(glGetUniformLocation(program, "positionScale"), 1.0f, 1.0f, 1.0f);
+    int loc_projection = glGetUniformLocation(program, "projection");
+
+    PostConfig config = {
+        .render_scale = 1.0f,
+        .bloom_levels = 5,
+        .exposure = 1.0f,
+        .taa_feedback = 0.1f,
+    };
+    fprintf(stdout, "%-9s %10s %10s %10s %10s %9s\n", "mode", "scene ms", "post ms", "total ms", "vs off", "memory");
+    double off_ms = 0.0;
+    for(int aa = 0; aa < POST_AA_MODES; aa++) {
+        config.aa = aa;
+        double scene_ms = 0.0, post_ms = 0.0;
+        // the first frame of each mode allocates the targets
+        for(int f = -1; f < frames; f++) {
+            mat4x4_perspective(projection, 0.785398f, (float)WIDTH / HEIGHT, 0.1f, 100.0f);
+            mat4x4_dup(view_projection, projection);
+            post_configure(&post, config, config.render_scale, WIDTH, HEIGHT);
+            post_jitter(&post, projection, view_projection);
+            glFinish();
+            double start = now_ms();
+            glEnable(GL_DEPTH_TEST);
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            glUseProgram(program);
+            glUniformMatrix4fv(loc_projection, 1, GL_FALSE, (GLfloat *)projection);
+            glBindVertexArray(vao);
+            glDrawArrays(GL_TRIANGLES, 0, triangles * 3);
+            glFinish();
+            double drawn = now_ms();
+            post_end(&post, POST_TONEMAP, WIDTH, HEIGHT);
+            glFinish();
+            if(f < 0)
+                continue;
+            scene_ms += drawn - start;
+            post_ms += now_ms() - drawn;
+        }
+        scene_ms /= frames;
+        post_ms /= frames;
+        if(aa == POST_AA_OFF)
+            off_ms = scene_ms + post_ms;
+        char name[16];
+        snprintf(name, sizeof(name), "%s", post_aa_name(aa));
+        if(post.samples && post.samples != 2 << (aa - POST_AA_MSAA2))
+            snprintf(name, sizeof(name), "%s(%d)", post_aa_name(aa), post.samples);   // clamped to GL_MAX_SAMPLES
+        fprintf(stdout, "%-9s %10.3f %10.3f %10.3f %+10.3f %6.1f MB\n", name, scene_ms, post_ms, scene_ms + post_ms,
+                scene_ms + post_ms - off_ms, post_memory(&post) / (1024.0 * 1024.0));
+    }
+
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    post_destroy(&post);
+    arena_destroy(&arena);
+    assets_destroy(&assets);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Camera update benchmark. The old per frame path (front from yaw and
+ * pitch with four sin/cos, look_at, perspective, a full 4x4 multiply and
+ * the right vector for strafing) against camera_update on a frame
+ * without mouse input and on one with it.
+ *
+ *     bench_camera [frames]
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "camera.h"
+#include "timing.h"
+
+static void
+report(const char *name, double ms, int frames)
+{
+    fprintf(stdout, "%-32s %9.3f ms %8.2f ns/frame\n", name, ms, ms * 1000000.0 / frames);
+}
+
+int
+main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 2000000;
+    // volatile inputs keep the compiler from hoisting the work out of the loops
+    volatile float yaw_input = -1.5707963f, pitch_input = 0.1f, step = 1e-6f;
+    float checksum = 0.0f;
+
+    double start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        float yaw = yaw_input, pitch = pitch_input;
+        vec3 position = { 0.0f, 0.0f, 3.0f + f * step }, up = { 0.0f, 1.0f, 0.0f };
+        vec3 direction = { cosf(yaw) * cosf(pitch), sinf(pitch), sinf(yaw) * cosf(pitch) }, front, center, right;
+        vec3_norm(front, direction);
+        vec3_add(center, position, front);
+        mat4x4 view, projection, view_projection;
+        mat4x4_look_at(view, position, center, up);
+        mat4x4_perspective(projection, 0.785398f, 4.0f / 3.0f, 0.01f, 100.0f);
+        mat4x4_mul(view_projection, projection, view);
+        vec3_mul_cross(right, front, up);
+        vec3_norm(right, right);
+        checksum += view_projection[3][2] + right[0];
+    }
+    report("trig + look_at + mul", now_ms() - start, frames);
+
+    Camera camera;
+    vec3 position = { 0.0f, 0.0f, 3.0f };
+    camera_init(&camera, position, yaw_input, pitch_input, 0.785398f, 4.0f / 3.0f, 0.01f, 100.0f);
+    start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        camera.position[2] = 3.0f + f * step;
+        camera_update(&camera);
+        checksum += camera.view_projection[3][2] + camera.right[0];
+    }
+    report("camera_update, no input", now_ms() - start, frames);
+
+    start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        camera_rotate(&camera, step, (f & 1) ? step : -step);
+        camera.position[2] = 3.0f + f * step;
+        camera_update(&camera);
+        checksum += camera.view_projection[3][2] + camera.right[0];
+    }
+    report("camera_update, mouse moved", now_ms() - start, frames);
+    fprintf(stdout, "  checksum %f\n", checksum);
+    return 0;
+}
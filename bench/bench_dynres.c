@@ -0,0 +1,66 @@
+/*
+ * Dynamic resolution controller benchmark. Drives DynamicResolution with
+ * a modelled GPU: a fixed cost plus a cost per pixel that follows the
+ * square of the scale, a load that jumps up for a while twice, a little
+ * noise, and results arriving GPU_TIMER_LATENCY frames late as the timer
+ * queries do. Reports how many frames miss the target at a fixed full
+ * scale and under the controller, and what resolution that costs.
+ *
+ *     bench_dynres [target ms] [frames]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dynres.h"
+#include "gpu_timer.h"
+
+#define FIXED_MS 2.0
+#define PIXEL_MS 10.0           /* at full scale and no extra load */
+
+static double
+load(int frame, int frames)
+{
+    // one short spike and one long one
+    if(frame > frames / 5 && frame < frames / 5 + 30)
+        return 1.9;
+    if(frame > frames / 2 && frame < frames / 2 + frames / 5)
+        return 1.5;
+    return 1.0;
+}
+
+static void
+run(const char *name, bool dynamic, float target_ms, int frames)
+{
+    DynamicResolution d;
+    dynres_init(&d, target_ms, 0.5f, 1.0f);
+    double in_flight[GPU_TIMER_LATENCY] = { 0 };
+    double scale_sum = 0.0, worst = 0.0;
+    int over = 0, over_run = 0, over_run_max = 0;
+    srand(1);
+    for(int f = 0; f < frames; f++) {
+        double noise = 1.0 + ((rand() % 1000) / 1000.0 - 0.5) * 0.1;
+        double ms = (FIXED_MS + PIXEL_MS * d.scale * d.scale * load(f, frames)) * noise;
+        scale_sum += d.scale;
+        worst = ms > worst ? ms : worst;
+        over_run = ms > target_ms ? over_run + 1 : 0;
+        over += ms > target_ms;
+        over_run_max = over_run > over_run_max ? over_run : over_run_max;
+
+        double measured = in_flight[f % GPU_TIMER_LATENCY];
+        in_flight[f % GPU_TIMER_LATENCY] = ms;
+        if(dynamic)
+            dynres_update(&d, measured);
+    }
+    fprintf(stdout, "%-8s target %5.1f ms: %4d/%d frames over (longest run %3d), worst %6.2f ms, average scale %3.0f%%, %u changes\n",
+            name, target_ms, over, frames, over_run_max, worst, scale_sum / frames * 100.0, d.changes);
+}
+
+int
+main(int argc, char **argv)
+{
+    float target_ms = argc > 1 ? (float)atof(argv[1]) : 14.0f;
+    int frames = argc > 2 ? atoi(argv[2]) : 600;
+    run("fixed", false, target_ms, frames);
+    run("dynamic", true, target_ms, frames);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Component store benchmark: insertion, iteration and removal with 1M
+ * entities. Iteration is timed both through sparse lookups and over
+ * pools aligned with ecs_align, after churn has shuffled them. Transform
+ * updates are timed with every node dirty and with 1% dirty.
+ *
+ *     bench_ecs [entities]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ecs.h"
+#include "timing.h"
+
+static void
+report(const char *name, double ms, u32 count)
+{
+    fprintf(stdout, "%-28s %9.2f ms %8.2f ns/entity\n", name, ms, ms * 1000000.0 / count);
+}
+
+static float
+frand(void)
+{
+    return rand() / (float)RAND_MAX;
+}
+
+static void
+spawn(EcsWorld *w, Entity *entities, u32 count)
+{
+    vec3 unit = { 1.0f, 1.0f, 1.0f };
+    for(u32 i = 0; i < count; i++) {
+        vec3 position = { (frand() - 0.5f) * 400.0f, 0.0f, -frand() * 400.0f };
+        Entity e = ecs_create(w);
+        ecs_add_transform(w, e, ECS_NULL, position, frand() * 6.28f, unit);
+        ecs_add_mesh(w, e, 0, 0.87f);
+        ecs_add_material(w, e, i % 16);
+        entities[i] = e;
+    }
+}
+
+/* What a submit pass does per object: position, bound and material. */
+static float
+submit_sparse(EcsWorld *w)
+{
+    const Entity *entities = ecs_entities(w, ECS_MESH);
+    const float *radius = ecs_column(w, ECS_MESH, MESH_RADIUS);
+    const u32 *material = ecs_column(w, ECS_MATERIAL, MATERIAL_ID);
+    float sum = 0.0f;
+    for(u32 i = 0; i < ecs_count(w, ECS_MESH); i++) {
+        Entity e = entities[i];
+        sum += hierarchy_world(&w->transforms, ecs_node(w, e))[14] * radius[i] + material[ecs_slot(w, ECS_MATERIAL, e)];
+    }
+    return sum;
+}
+
+static float
+submit_aligned(EcsWorld *w)
+{
+    u32 count = ecs_align(w, ECS_TRANSFORM, ECS_MESH);
+    ecs_align(w, ECS_MATERIAL, ECS_MESH);
+    const float *radius = ecs_column(w, ECS_MESH, MESH_RADIUS);
+    const u32 *nodes = ecs_column(w, ECS_TRANSFORM, TRANSFORM_NODE);
+    const u32 *material = ecs_column(w, ECS_MATERIAL, MATERIAL_ID);
+    float sum = 0.0f;
+    for(u32 i = 0; i < count; i++)
+        sum += hierarchy_world(&w->transforms, nodes[i])[14] * radius[i] + material[i];
+    return sum;
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 count = argc > 1 ? (u32)atoi(argv[1]) : 1000000;
+    Entity *entities = malloc(sizeof(Entity) * count);
+    static EcsWorld world;
+    ecs_init(&world, count + count / 2);
+    srand(1);
+
+    fprintf(stdout, "%u entities, Transform + MeshRef + Material\n", count);
+    double start = now_ms();
+    spawn(&world, entities, count);
+    report("insert", now_ms() - start, count);
+
+    start = now_ms();
+    hierarchy_update(&world.transforms);
+    report("transforms, all dirty", now_ms() - start, count);
+
+    const u32 *nodes = ecs_column(&world, ECS_TRANSFORM, TRANSFORM_NODE);
+    for(u32 i = 0; i < count; i += 100) {
+        vec3 position = { (frand() - 0.5f) * 400.0f, 0.0f, -frand() * 400.0f };
+        hierarchy_set_position(&world.transforms, nodes[i], position);
+    }
+    start = now_ms();
+    hierarchy_update(&world.transforms);
+    report("transforms, 1% dirty", now_ms() - start, count);
+
+    start = now_ms();
+    float sum = submit_sparse(&world);
+    report("submit, fresh pools", now_ms() - start, count);
+
+    // remove half at random, then refill from the free list, which scrambles pool order
+    for(u32 i = count - 1; i > 0; i--) {
+        u32 j = (u32)rand() % (i + 1);
+        Entity t = entities[i]; entities[i] = entities[j]; entities[j] = t;
+    }
+    u32 half = count / 2;
+    start = now_ms();
+    for(u32 i = 0; i < half; i++)
+        ecs_destroy_entity(&world, entities[i]);
+    report("remove (random half)", now_ms() - start, half);
+
+    start = now_ms();
+    spawn(&world, entities, half);
+    report("reinsert (free list)", now_ms() - start, half);
+
+    start = now_ms();
+    hierarchy_update(&world.transforms);
+    report("transforms, compact + new", now_ms() - start, count);
+
+    // remove only meshes from every 8th entity, so the pools hold different sets
+    for(u32 i = 0; i < count; i += 8)
+        ecs_remove(&world, ECS_MESH, entities[i]);
+    for(u32 i = 0; i < count; i += 16)
+        ecs_add_mesh(&world, entities[i], 0, 0.87f);
+
+    start = now_ms();
+    sum += submit_sparse(&world);
+    report("submit, sparse lookups", now_ms() - start, ecs_count(&world, ECS_MESH));
+
+    start = now_ms();
+    sum += submit_aligned(&world);
+    report("submit, align + lockstep", now_ms() - start, ecs_count(&world, ECS_MESH));
+
+    start = now_ms();
+    sum += submit_aligned(&world);
+    report("submit, already aligned", now_ms() - start, ecs_count(&world, ECS_MESH));
+
+    fprintf(stdout, "(checksum %g, %u alive)\n", sum, world.entity_count);
+    ecs_destroy(&world);
+    free(entities);
+    return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef __BENCH_GL__H__
+#define __BENCH_GL__H__
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Hidden 3.3 core window with its context current and vsync off, every GPU bench starts from one. */
+static inline GLFWwindow *
+bench_window(const char *title, int width, int height)
+{
+    if(!glfwInit()) {
+        fprintf(stderr, "Failed to initialize GLFW\n");
+        exit(1);
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow *window = glfwCreateWindow(width, height, title, NULL, NULL);
+    if(!window) {
+        fprintf(stderr, "Failed to create GLFW window\n");
+        exit(1);
+    }
+    glfwMakeContextCurrent(window);
+    if(!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        fprintf(stderr, "Failed to initialize GLAD\n");
+        exit(1);
+    }
+    glfwSwapInterval(0);
+    return window;
+}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * Frame task scaling benchmark. Builds a large cubePositions-style scene
+ * and runs one frame's worth of work (transforms -> culling, light
+ * rects -> tile binning, image decode) through the job system with 1..N
+ * threads.
+ *
+ *     bench_jobs [objects] [frames] [max threads]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "job.h"
+#include "frame_tasks.h"
+#include "timing.h"
+
+#define GRAIN 4096
+#define LIGHTS 1024
+#define IMAGES 24
+#define WIDTH 1920
+#define HEIGHT 1080
+
+typedef struct {
+    JobSystem *js;
+    JobCounter *frame;
+    CullTask *cull;
+    LightBinTask *bin;
+    u32 objects;
+} FrameContext;
+
+static unsigned char *
+read_file(const char *filename, int *size)
+{
+    FILE *file = fopen(filename, "rb");
+    if(!file) {
+        fprintf(stderr, "Couldn't open file %s\n", filename);
+        exit(1);
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (int)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char *data = malloc(*size);
+    if(fread(data, 1, *size, file) != (size_t)*size) {
+        fprintf(stderr, "Couldn't read file %s\n", filename);
+        exit(1);
+    }
+    fclose(file);
+    return data;
+}
+
+static void
+start_cull(void *data, u32 begin, u32 end)
+{
+    (void)begin; (void)end;
+    FrameContext *ctx = data;
+    job_parallel_for(ctx->js, task_cull, ctx->cull, ctx->objects, GRAIN, ctx->frame);
+}
+
+static void
+start_binning(void *data, u32 begin, u32 end)
+{
+    (void)begin; (void)end;
+    FrameContext *ctx = data;
+    job_parallel_for(ctx->js, task_bin_lights, ctx->bin, (u32)ctx->bin->tiles_y, 1, ctx->frame);
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 objects = argc > 1 ? (u32)atoi(argv[1]) : 1000000;
+    int frames = argc > 2 ? atoi(argv[2]) : 20;
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(argc > 3)
+        cores = atoi(argv[3]);
+    if(cores > JOB_MAX_THREADS)
+        cores = JOB_MAX_THREADS;
+
+    vec3 *positions = malloc(sizeof(vec3) * objects);
+    float *angles = malloc(sizeof(float) * objects);
+    vec3 *scales = malloc(sizeof(vec3) * objects);
+    float *radius = malloc(sizeof(float) * objects);
+    mat4x4 *models = aligned_alloc(64, sizeof(mat4x4) * objects);
+    u8 *visible = malloc(objects);
+
+    srand(1);
+    for(u32 i = 0; i < objects; i++) {
+        positions[i][0] = (rand() / (float)RAND_MAX - 0.5f) * 400.0f;
+        positions[i][1] = 0.0f;
+        positions[i][2] = -(rand() / (float)RAND_MAX) * 400.0f;
+        angles[i] = 20.0f * (float)i * (3.141592f / 180.0f);
+        scales[i][0] = scales[i][1] = scales[i][2] = 1.0f;
+        radius[i] = 0.87f;
+    }
+
+    vec3 light_pos[LIGHTS];
+    float light_radius[LIGHTS];
+    int light_rects[LIGHTS][4];
+    for(int i = 0; i < LIGHTS; i++) {
+        light_pos[i][0] = (rand() / (float)RAND_MAX - 0.5f) * 100.0f;
+        light_pos[i][1] = 1.5f;
+        light_pos[i][2] = -(rand() / (float)RAND_MAX) * 100.0f;
+        light_radius[i] = 2.0f + (rand() / (float)RAND_MAX) * 6.0f;
+    }
+
+    const char *image_files[] = { "teksture/container.jpg", "teksture/wall.jpg", "teksture/awesomeface.png" };
+    const unsigned char *files[IMAGES];
+    int file_sizes[IMAGES];
+    for(int i = 0; i < 3; i++)
+        files[i] = read_file(image_files[i], &file_sizes[i]);
+    for(int i = 3; i < IMAGES; i++) {
+        files[i] = files[i % 3];
+        file_sizes[i] = file_sizes[i % 3];
+    }
+    unsigned char *pixels[IMAGES];
+    int widths[IMAGES], heights[IMAGES], channels[IMAGES];
+
+    mat4x4 view, projection, view_projection;
+    vec3 eye = { 0.0f, 2.0f, 3.0f }, center = { 0.0f, 0.0f, -10.0f }, up = { 0.0f, 1.0f, 0.0f };
+    mat4x4_look_at(view, eye, center, up);
+    mat4x4_perspective(projection, 45.0f * (3.141592f / 180.0f), (float)WIDTH / HEIGHT, 0.1f, 200.0f);
+    mat4x4_mul(view_projection, projection, view);
+
+    TransformTask transforms = { (const vec3 *)positions, angles, (const vec3 *)scales, models };
+    CullTask cull = { .models = models, .radius = radius, .visible = visible };
+    frustum_from_matrix(cull.planes, view_projection);
+
+    int tiles_x = (WIDTH + LIGHT_TILE_SIZE - 1) / LIGHT_TILE_SIZE;
+    int tiles_y = (HEIGHT + LIGHT_TILE_SIZE - 1) / LIGHT_TILE_SIZE;
+    LightBinTask bin = {
+        .light_count = LIGHTS, .positions = (const vec3 *)light_pos, .radius = light_radius,
+        .width = WIDTH, .height = HEIGHT, .tiles_x = tiles_x, .tiles_y = tiles_y, .rects = light_rects,
+        .tile_counts = malloc(sizeof(u16) * tiles_x * tiles_y),
+        .tile_lights = malloc(sizeof(u16) * tiles_x * tiles_y * MAX_LIGHTS_PER_TILE),
+    };
+    mat4x4_dup(bin.view_projection, view_projection);
+    DecodeTask decode = { files, file_sizes, pixels, widths, heights, channels };
+
+    fprintf(stdout, "%u objects, %d lights, %d images, %d frames per run\n", objects, LIGHTS, IMAGES, frames);
+    fprintf(stdout, "threads   frame ms   speedup   steals/frame\n");
+
+    double base = 0.0;
+    for(int threads = 1; threads <= cores; threads = threads < cores && threads * 2 > cores ? cores : threads * 2) {
+        JobSystem js;
+        job_system_init(&js, threads);
+
+        double best = 1e30;
+        u64 steals = 0;
+        u32 visible_count = 0;
+        for(int f = 0; f < frames; f++) {
+            double start = now_ms();
+            JobCounter frame, transformed, rects;
+            job_counter_init(&frame);
+            job_counter_init(&transformed);
+            job_counter_init(&rects);
+            FrameContext ctx = { &js, &frame, &cull, &bin, objects };
+
+            // culling reads the matrices, binning reads the rects: both chained as continuations
+            job_counter_then(&transformed, start_cull, &ctx, &frame);
+            job_counter_then(&rects, start_binning, &ctx, &frame);
+            job_parallel_for(&js, task_build_transforms, &transforms, objects, GRAIN, &transformed);
+            job_parallel_for(&js, task_light_rects, &bin, LIGHTS, 64, &rects);
+            job_parallel_for(&js, task_decode_images, &decode, IMAGES, 1, &frame);
+            job_wait(&js, &frame);
+
+            double ms = now_ms() - start;
+            if(ms < best)
+                best = ms;
+            for(int i = 0; i < IMAGES; i++)
+                stbi_image_free(pixels[i]);
+        }
+        for(u32 i = 0; i < objects; i++)
+            visible_count += visible[i];
+        steals = atomic_load(&js.steals);
+        job_system_shutdown(&js);
+
+        if(threads == 1)
+            base = best;
+        fprintf(stdout, "%7d   %8.2f   %7.2fx   %12.1f   (%u visible)\n",
+                threads, best, base / best, (double)steals / frames, visible_count);
+        if(threads == cores)
+            break;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * Level of detail benchmark. Builds the LOD chain of a detailed torus,
+ * then draws a grid of thousands of them from a camera looking across
+ * the grid, at full detail and with LOD selection at a few error
+ * thresholds. Reports triangles per frame, GPU time and the cost of
+ * selecting. A slowly swaying camera counts how often objects switch
+ * level with and without hysteresis.
+ *
+ *     bench_lod [grid side] [torus rings]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_gl.h"
+#include "gpu_timer.h"
+#include "lod.h"
+#include "mesh.h"
+#include "vertex_format.h"
+#include "timing.h"
+
+#define FRAMES 16
+#define SWAY_FRAMES 240
+#define WIDTH 640
+#define HEIGHT 360
+#define FOV 0.785398f
+
+static const char *vertex_src =
+    "#version 330 core\n"
+    "layout (location = 0) in vec4 aPos;\n"
+    "layout (location = 1) in vec4 aNormal;\n"
+    "uniform mat4 model;\n"
+    "uniform mat4 viewProjection;\n"
+    "uniform vec3 positionOffset;\n"
+    "uniform vec3 positionScale;\n"
+    "out vec2 Normal;\n"
+    "void main()\n"
+    "{\n"
+    "    Normal = aNormal.xy;\n"
+    "    gl_Position = viewProjection * model * vec4(positionOffset + aPos.xyz * positionScale, 1.0);\n"
+    "}\n";
+
+static const char *fragment_src =
+    "#version 330 core\n"
+    "in vec2 Normal;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    FragColor = vec4(Normal * 0.5 + 0.5, 0.5, 1.0);\n"
+    "}\n";
+
+static unsigned int
+compile(const char *src, GLenum type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &src, NULL);
+    glCompileShader(shader);
+    int success;
+    char log[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if(!success) {
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "shader: %s\n", log);
+        exit(1);
+    }
+    return shader;
+}
+
+typedef struct {
+    u32 count;
+    vec3 *positions;
+    u32 *lods;
+} Grid;
+
+static void
+camera_at(float z, vec3 eye, mat4x4 view_projection)
+{
+    vec3 center = { 0.0f, 0.0f, z - 10.0f }, up = { 0.0f, 1.0f, 0.0f };
+    eye[0] = 0.0f;
+    eye[1] = 4.0f;
+    eye[2] = z;
+    mat4x4 view, projection;
+    mat4x4_look_at(view, eye, center, up);
+    mat4x4_perspective(projection, FOV, (float)WIDTH / HEIGHT, 0.1f, 500.0f);
+    mat4x4_mul(view_projection, projection, view);
+}
+
+/* Picks a level for every object, returns the triangles that would be drawn and how many objects switched. */
+static u64
+select_lods(Grid *g, const Mesh *m, const vec3 eye, float threshold, float hysteresis, u32 *switches)
+{
+    u64 triangles = 0;
+    float radius = mesh_radius(m);
+    for(u32 i = 0; i < g->count; i++) {
+        vec3 d;
+        vec3_sub(d, g->positions[i], eye);
+        float pixels = lod_pixels_per_unit(vec3_len(d) - radius, FOV, HEIGHT);
+        u32 lod = threshold > 0.0f ? lod_select(m->lods, m->lod_count, g->lods[i], pixels, threshold, hysteresis) : 0;
+        if(switches && lod != g->lods[i])
+            (*switches)++;
+        g->lods[i] = lod;
+        triangles += m->lods[lod].index_count / 3;
+    }
+    return triangles;
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 side = argc > 1 ? (u32)atoi(argv[1]) : 64;
+    u32 rings = argc > 2 ? (u32)atoi(argv[2]) : 96;
+
+    bench_window("bench_lod", WIDTH, HEIGHT);
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, compile(vertex_src, GL_VERTEX_SHADER));
+    glAttachShader(program, compile(fragment_src, GL_FRAGMENT_SHADER));
+    glLinkProgram(program);
+    glUseProgram(program);
+    GpuMeshUniforms mesh_uniforms = gpu_mesh_uniforms(program);
+    glViewport(0, 0, WIDTH, HEIGHT);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+
+    Mesh m;
+    mesh_torus(&m, rings, rings / 2);
+    double start = now_ms();
+    mesh_build_lods(&m, MESH_LOD_MAX_ERROR * mesh_radius(&m));
+    double build = now_ms() - start;
+    mesh_optimize(&m);
+    fprintf(stdout, "torus %u triangles, %u levels built in %.1f ms:\n", m.lods[0].index_count / 3, m.lod_count, build);
+    for(u32 i = 0; i < m.lod_count; i++)
+        fprintf(stdout, "  [%u] %6u triangles, error %.5f (%.2f%% of radius)\n", i, m.lods[i].index_count / 3,
+                m.lods[i].error, 100.0f * m.lods[i].error / mesh_radius(&m));
+
+    GpuMesh g;
+    gpu_mesh_create(&g, &m, (VertexFormat){ POSITION_UNORM16, NORMAL_OCTAHEDRAL });
+    gpu_mesh_bind(&g, &mesh_uniforms);
+
+    Grid grid;
+    grid.count = side * side;
+    grid.positions = malloc(sizeof(vec3) * grid.count);
+    grid.lods = calloc(grid.count, sizeof(u32));
+    for(u32 i = 0; i < grid.count; i++) {
+        grid.positions[i][0] = ((float)(i % side) - side * 0.5f) * 3.0f;
+        grid.positions[i][1] = 0.0f;
+        grid.positions[i][2] = -(float)(i / side) * 3.0f;
+    }
+
+    vec3 eye;
+    mat4x4 view_projection, model;
+    camera_at(6.0f, eye, view_projection);
+    glUniformMatrix4fv(glGetUniformLocation(program, "viewProjection"), 1, GL_FALSE, (GLfloat *)view_projection);
+    int model_loc = glGetUniformLocation(program, "model");
+
+    fprintf(stdout, "%u objects, %dx%d\n", grid.count, WIDTH, HEIGHT);
+    fprintf(stdout, "%-14s %12s %8s %10s %12s\n", "mode", "triangles", "share", "ms GPU", "select us");
+    const float thresholds[] = { 0.0f, 0.5f, 1.0f, 4.0f };
+    u64 full = 0;
+    double full_ms = 0.0;
+    for(size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); t++) {
+        start = now_ms();
+        u64 triangles = 0;
+        for(int i = 0; i < FRAMES; i++)
+            triangles = select_lods(&grid, &m, eye, thresholds[t], LOD_HYSTERESIS, NULL);
+        double select_us = (now_ms() - start) * 1000.0 / FRAMES;
+
+        GpuTimer timer;
+        gpu_timer_init(&timer);
+        for(int frame = 0; frame < FRAMES + GPU_TIMER_LATENCY; frame++) {
+            if(frame == GPU_TIMER_LATENCY)
+                gpu_timer_reset(&timer);
+            gpu_timer_begin(&timer);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            for(u32 i = 0; i < grid.count; i++) {
+                mat4x4_translate(model, grid.positions[i][0], grid.positions[i][1], grid.positions[i][2]);
+                glUniformMatrix4fv(model_loc, 1, GL_FALSE, (GLfloat *)model);
+                gpu_mesh_draw_lod(&g, grid.lods[i]);
+            }
+            gpu_timer_end(&timer);
+            glFinish();
+        }
+        double ms = gpu_timer_average(&timer);
+        gpu_timer_destroy(&timer);
+        if(t == 0) {
+            full = triangles;
+            full_ms = ms;
+        }
+
+        char mode[32];
+        if(thresholds[t] > 0.0f)
+            snprintf(mode, sizeof(mode), "lod %.1f px", thresholds[t]);
+        else
+            snprintf(mode, sizeof(mode), "full detail");
+        fprintf(stdout, "%-14s %12llu %7.1f%% %10.3f %12.1f", mode, (unsigned long long)triangles,
+                100.0 * triangles / full, ms, select_us);
+        if(t > 0)
+            fprintf(stdout, "   %.2fx faster", full_ms / ms);
+        fprintf(stdout, "\n");
+    }
+
+    // the camera sways half a unit back and forth, every level switch would be a visible pop
+    const float hysteresis[] = { 0.0f, LOD_HYSTERESIS };
+    for(int h = 0; h < 2; h++) {
+        for(u32 i = 0; i < grid.count; i++)
+            grid.lods[i] = 0;
+        u32 switches = 0;
+        for(int frame = 0; frame < SWAY_FRAMES; frame++) {
+            camera_at(6.0f + 0.5f * sinf(frame * 0.2f), eye, view_projection);
+            select_lods(&grid, &m, eye, 1.0f, hysteresis[h], frame ? &switches : NULL);
+        }
+        fprintf(stdout, "swaying camera, hysteresis %.2f: %.2f level switches per frame\n", hysteresis[h],
+                switches / (double)(SWAY_FRAMES - 1));
+    }
+
+    free(grid.positions);
+    free(grid.lods);
+    gpu_mesh_destroy(&g);
+    mesh_free(&m);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * Material submission benchmark. Draws a grid of small quads, one draw
+ * each with its own offset, shaded from a few hundred materials:
+ *   uniforms  the material's parameters uploaded as uniforms every draw
+ *   index     the material index uploaded every draw, the shader fetches
+ *             the material from the buffer texture
+ *   sorted    the same with the draws ordered by material, the index is
+ *             only uploaded when it changes
+ * and prints what issuing the draws costs on the CPU, the whole frame
+ * with the GPU waited on, and the uniform uploads a frame.
+ *
+ *     bench_materials [draws] [materials] [frames]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_gl.h"
+#include "material.h"
+#include "memory.h"
+#include "shader.h"
+#include "timing.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+
+enum { MODE_UNIFORMS, MODE_INDEX, MODE_SORTED, MODES };
+static const char *mode_names[MODES] = { "uniforms", "index", "sorted" };
+
+static const char *vertex_source =
+    "#version 330 core\n"
+    "layout (location = 0) in vec2 aPos;\n"
+    "uniform vec2 offset;\n"
+    "void main() { gl_Position = vec4(aPos + offset, 0.0, 1.0); }\n";
+
+static const char *uniform_source =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "uniform vec3 baseColor;\n"
+    "uniform float metallic;\n"
+    "uniform float roughness;\n"
+    "void main() { FragColor = vec4(baseColor * (1.0 - metallic) + vec3(roughness * 0.1), 1.0); }\n";
+
+static const char *buffer_source =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "uniform samplerBuffer materials;\n"
+    "uniform int materialIndex;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 baseMetallic = texelFetch(materials, materialIndex * 2);\n"
+    "    float roughness = texelFetch(materials, materialIndex * 2 + 1).x;\n"
+    "    FragColor = vec4(baseMetallic.rgb * (1.0 - baseMetallic.a) + vec3(roughness * 0.1), 1.0);\n"
+    "}\n";
+
+typedef struct {
+    float offset[2];
+    u32 material;
+} Draw;
+
+static float
+random_float(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static int
+compare_draws(const void *a, const void *b)
+{
+    u32 ma = ((const Draw *)a)->material, mb = ((const Draw *)b)->material;
+    return (ma > mb) - (ma < mb);
+}
+
+int
+main(int argc, char **argv)
+{
+    int draw_count = argc > 1 ? atoi(argv[1]) : 4096;
+    int material_count = argc > 2 ? atoi(argv[2]) : 256;
+    int frames = argc > 3 ? atoi(argv[3]) : 30;
+    if(draw_count <= 0 || material_count <= 0 || material_count > MATERIAL_MAX) {
+        fprintf(stderr, "bench_materials [draws] [materials up to %d] [frames]\n", MATERIAL_MAX);
+        return 1;
+    }
+
+    bench_window("bench_materials", WIDTH, HEIGHT);
+    fprintf(stdout, "%s, %d draws, %d materials\n", (const char *)glGetString(GL_RENDERER), draw_count, material_count);
+
+    Arena arena;
+    arena_init(&arena, "bench materials", (size_t)material_count * sizeof(Material) + sizeof(Draw) * 2 * draw_count + 4096);
+    MaterialLibrary lib;
+    material_library_init(&lib, &arena, (u32)material_count);
+    srand(1);
+    for(int i = 0; i < material_count; i++) {
+        vec3 color = { random_float(0.0f, 1.0f), random_float(0.0f, 1.0f), random_float(0.0f, 1.0f) };
+        material_add(&lib, color, rand() % 4 == 0 ? 1.0f : 0.0f, random_float(0.1f, 1.0f));
+    }
+    MaterialBuffer buffer;
+    material_buffer_init(&buffer, lib.materials, lib.count);
+
+    // a grid covering the window, materials handed out at random
+    Draw *draws = ARENA_ARRAY(&arena, Draw, draw_count);
+    Draw *sorted = ARENA_ARRAY(&arena, Draw, draw_count);
+    int columns = 1;
+    while(columns * columns < draw_count)
+        columns++;
+    float cell = 2.0f / columns;
+    for(int i = 0; i < draw_count; i++) {
+        draws[i].offset[0] = -1.0f + cell * (i % columns);
+        draws[i].offset[1] = -1.0f + cell * (i / columns);
+        draws[i].material = (u32)(rand() % material_count);
+    }
+    memcpy(sorted, draws, sizeof(Draw) * draw_count);
+    qsort(sorted, draw_count, sizeof(Draw), compare_draws);
+
+    float quad[] = { 0.0f, 0.0f, cell, 0.0f, cell, cell, 0.0f, 0.0f, cell, cell, 0.0f, cell };
+    unsigned int vao, vbo;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    glEnableVertexAttribArray(0);
+
+    unsigned int uniform_program = link_shader_program(vertex_source, uniform_source, "bench uniforms");
+    unsigned int buffer_program = link_shader_program(vertex_source, buffer_source, "bench buffer");
+    glUseProgram(buffer_program);
+    material_buffer_bind(&buffer, buffer_program);
+
+    fprintf(stdout, "%-9s %10s %10s %10s\n", "mode", "submit ms", "frame ms", "uploads");
+    for(int mode = 0; mode < MODES; mode++) {
+        unsigned int program = mode == MODE_UNIFORMS ? uniform_program : buffer_program;
+        const Draw *order = mode == MODE_SORTED ? sorted : draws;
+        int loc_offset = glGetUniformLocation(program, "offset");
+        int loc_color = glGetUniformLocation(program, "baseColor");
+        int loc_metallic = glGetUniformLocation(program, "metallic");
+        int loc_roughness = glGetUniformLocation(program, "roughness");
+        int loc_index = glGetUniformLocation(program, "materialIndex");
+        double submit_ms = 0.0, frame_ms = 0.0;
+        u32 uploads = 0;
+        // the first frame of each mode warms the program up
+        for(int f = -1; f < frames; f++) {
+            glFinish();
+            double start = now_ms();
+            glClear(GL_COLOR_BUFFER_BIT);
+            glUseProgram(program);
+            u32 bound = MATERIAL_NONE;
+            u32 frame_uploads = 0;
+            for(int i = 0; i < draw_count; i++) {
+                const Draw *d = &order[i];
+                glUniform2fv(loc_offset, 1, d->offset);
+                if(mode == MODE_UNIFORMS) {
+                    const Material *m = &lib.materials[d->material];
+                    glUniform3fv(loc_color, 1, m->base_color);
+                    glUniform1f(loc_metallic, m->metallic);
+                    glUniform1f(loc_roughness, m->roughness);
+                    frame_uploads += 3;
+                } else if(mode == MODE_INDEX || d->material != bound) {
+                    glUniform1i(loc_index, (int)d->material);
+                    bound = d->material;
+                    frame_uploads++;
+                }
+                glDrawArrays(GL_TRIANGLES, 0, 6);
+            }
+            double submitted = now_ms();
+            glFinish();
+            if(f < 0)
+                continue;
+            submit_ms += submitted - start;
+            frame_ms += now_ms() - start;
+            uploads = frame_uploads;
+        }
+        fprintf(stdout, "%-9s %10.3f %10.3f %10u\n", mode_names[mode], submit_ms / frames, frame_ms / frames, uploads);
+    }
+    fprintf(stdout, "material buffer %.1f KB\n", material_buffer_memory(&buffer) / 1024.0);
+
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(uniform_program);
+    glDeleteProgram(buffer_program);
+    material_buffer_destroy(&buffer);
+    arena_destroy(&arena);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Allocator benchmark. A frame's worth of small, short lived allocations
+ * (sizes 16-256 bytes, all freed at the end of the frame) through malloc
+ * and free, through a frame arena that is reset instead, and fixed size
+ * items churned through a pool versus malloc.
+ *
+ *     bench_memory [allocations per frame] [frames]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory.h"
+#include "timing.h"
+
+static void
+report(const char *name, double ms, u64 count)
+{
+    fprintf(stdout, "%-28s %9.2f ms %8.2f ns/allocation\n", name, ms, ms * 1000000.0 / count);
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 count = argc > 1 ? (u32)atoi(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 50;
+    u64 total = (u64)count * frames;
+
+    size_t *sizes = malloc(sizeof(size_t) * count);
+    void **pointers = malloc(sizeof(void *) * count);
+    srand(1);
+    for(u32 i = 0; i < count; i++)
+        sizes[i] = 16 + (size_t)(rand() % 241);
+
+    // touching every allocation keeps the comparison honest about cache misses
+    u64 checksum = 0;
+    double start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        for(u32 i = 0; i < count; i++) {
+            pointers[i] = malloc(sizes[i]);
+            memset(pointers[i], (int)i, 16);
+        }
+        for(u32 i = 0; i < count; i++) {
+            checksum += ((u8 *)pointers[i])[0];
+            free(pointers[i]);
+        }
+    }
+    report("malloc + free", now_ms() - start, total);
+
+    Arena frame;
+    arena_init(&frame, "bench frame", 64 << 20);
+    start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        arena_reset(&frame);
+        for(u32 i = 0; i < count; i++) {
+            pointers[i] = arena_push(&frame, sizes[i], 16);
+            memset(pointers[i], (int)i, 16);
+        }
+        for(u32 i = 0; i < count; i++)
+            checksum += ((u8 *)pointers[i])[0];
+    }
+    report("frame arena", now_ms() - start, total);
+    fprintf(stdout, "  ");
+    arena_print(stdout, &frame);
+    fprintf(stdout, "\n");
+
+    // half the items are freed and reallocated each frame, in a scattered order
+    const size_t item = 64;
+    Arena persistent;
+    arena_init(&persistent, "bench persistent", 64 << 20);
+    Pool pool;
+    pool_init(&pool, &persistent, item, count);
+    for(u32 i = 0; i < count; i++)
+        pointers[i] = pool_alloc(&pool);
+    start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        for(u32 i = f & 1; i < count; i += 2)
+            pool_free(&pool, pointers[i]);
+        for(u32 i = f & 1; i < count; i += 2) {
+            pointers[i] = pool_alloc(&pool);
+            memset(pointers[i], (int)i, 16);
+        }
+    }
+    report("pool churn", now_ms() - start, total / 2);
+
+    for(u32 i = 0; i < count; i++)
+        pointers[i] = malloc(item);
+    start = now_ms();
+    for(int f = 0; f < frames; f++) {
+        for(u32 i = f & 1; i < count; i += 2)
+            free(pointers[i]);
+        for(u32 i = f & 1; i < count; i += 2) {
+            pointers[i] = malloc(item);
+            memset(pointers[i], (int)i, 16);
+        }
+    }
+    report("malloc churn", now_ms() - start, total / 2);
+    fprintf(stdout, "  pool %u/%u items, peak %u, checksum %llu\n", pool.used, pool.capacity, pool.peak,
+            (unsigned long long)checksum);
+
+    for(u32 i = 0; i < count; i++)
+        free(pointers[i]);
+    arena_destroy(&frame);
+    arena_destroy(&persistent);
+    free(sizes);
+    free(pointers);
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Mesh load benchmark. Writes a large torus as OBJ text and as glTF
+ * (.gltf + .bin), then times parsing each, the cache optimization and
+ * loading the binary cache by mmap. Triangles are shuffled first so the
+ * optimizer has something to do.
+ *
+ *     bench_mesh [rings] [sides] [dir]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "mesh.h"
+#include "timing.h"
+
+static long
+file_size(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? (long)st.st_size : 0;
+}
+
+static void
+shuffle_triangles(Mesh *m)
+{
+    srand(1);
+    for(u32 t = m->index_count / 3 - 1; t > 0; t--) {
+        u32 j = (u32)rand() % (t + 1), tmp[3];
+        memcpy(tmp, &m->indices[t * 3], sizeof(tmp));
+        memcpy(&m->indices[t * 3], &m->indices[j * 3], sizeof(tmp));
+        memcpy(&m->indices[j * 3], tmp, sizeof(tmp));
+    }
+}
+
+static void
+write_obj(const Mesh *m, const char *path)
+{
+    FILE *f = fopen(path, "w");
+    for(u32 i = 0; i < m->vertex_count; i++)
+        fprintf(f, "v %f %f %f\n", m->positions[i * 3], m->positions[i * 3 + 1], m->positions[i * 3 + 2]);
+    for(u32 i = 0; i < m->vertex_count; i++)
+        fprintf(f, "vt %f %f\n", m->uvs[i * 2], m->uvs[i * 2 + 1]);
+    for(u32 i = 0; i < m->vertex_count; i++)
+        fprintf(f, "vn %f %f %f\n", m->normals[i * 3], m->normals[i * 3 + 1], m->normals[i * 3 + 2]);
+    for(u32 i = 0; i < m->index_count; i += 3) {
+        u32 a = m->indices[i] + 1, b = m->indices[i + 1] + 1, c = m->indices[i + 2] + 1;
+        fprintf(f, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c);
+    }
+    fclose(f);
+}
+
+static void
+write_gltf(const Mesh *m, const char *dir)
+{
+    char path[1024];
+    size_t positions = sizeof(float) * 3 * m->vertex_count;
+    size_t normals = positions, uvs = sizeof(float) * 2 * m->vertex_count;
+    size_t indices = sizeof(u32) * m->index_count;
+
+    snprintf(path, sizeof(path), "%s/torus.bin", dir);
+    FILE *f = fopen(path, "wb");
+    fwrite(m->positions, 1, positions, f);
+    fwrite(m->normals, 1, normals, f);
+    fwrite(m->uvs, 1, uvs, f);
+    fwrite(m->indices, 1, indices, f);
+    fclose(f);
+
+    snprintf(path, sizeof(path), "%s/torus.gltf", dir);
+    f = fopen(path, "w");
+    fprintf(f,
+        "{\n  \"asset\": { \"version\": \"2.0\" },\n"
+        "  \"buffers\": [ { \"uri\": \"torus.bin\", \"byteLength\": %zu } ],\n"
+        "  \"bufferViews\": [\n"
+        "    { \"buffer\": 0, \"byteOffset\": 0, \"byteLength\": %zu },\n"
+        "    { \"buffer\": 0, \"byteOffset\": %zu, \"byteLength\": %zu },\n"
+        "    { \"buffer\": 0, \"byteOffset\": %zu, \"byteLength\": %zu },\n"
+        "    { \"buffer\": 0, \"byteOffset\": %zu, \"byteLength\": %zu }\n  ],\n"
+        "  \"accessors\": [\n"
+        "    { \"bufferView\": 0, \"componentType\": 5126, \"count\": %u, \"type\": \"VEC3\" },\n"
+        "    { \"bufferView\": 1, \"componentType\": 5126, \"count\": %u, \"type\": \"VEC3\" },\n"
+        "    { \"bufferView\": 2, \"componentType\": 5126, \"count\": %u, \"type\": \"VEC2\" },\n"
+        "    { \"bufferView\": 3, \"componentType\": 5125, \"count\": %u, \"type\": \"SCALAR\" }\n  ],\n"
+        "  \"meshes\": [ { \"primitives\": [ { \"attributes\": { \"POSITION\": 0, \"NORMAL\": 1, \"TEXCOORD_0\": 2 }, \"indices\": 3 } ] } ]\n}\n",
+        positions + normals + uvs + indices,
+        positions, positions, normals, positions + normals, uvs, positions + normals + uvs, indices,
+        m->vertex_count, m->vertex_count, m->vertex_count, m->index_count);
+    fclose(f);
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 rings = argc > 1 ? (u32)atoi(argv[1]) : 1024;
+    u32 sides = argc > 2 ? (u32)atoi(argv[2]) : 512;
+    const char *dir = argc > 3 ? argv[3] : "/tmp";
+    char obj_path[1024], gltf_path[1024], bin_path[1024], cache_path[1024];
+    snprintf(obj_path, sizeof(obj_path), "%s/torus.obj", dir);
+    snprintf(gltf_path, sizeof(gltf_path), "%s/torus.gltf", dir);
+    snprintf(bin_path, sizeof(bin_path), "%s/torus.bin", dir);
+    snprintf(cache_path, sizeof(cache_path), "%s/torus.mesh", dir);
+
+    Mesh source;
+    mesh_torus(&source, rings, sides);
+    shuffle_triangles(&source);
+    write_obj(&source, obj_path);
+    write_gltf(&source, dir);
+    fprintf(stdout, "torus: %u vertices, %u triangles\n", source.vertex_count, source.index_count / 3);
+    mesh_free(&source);
+
+    Mesh obj, gltf;
+    double start = now_ms();
+    mesh_load_obj(obj_path, &obj);
+    double obj_ms = now_ms() - start;
+    start = now_ms();
+    mesh_load_gltf(gltf_path, &gltf);
+    double gltf_ms = now_ms() - start;
+
+    float acmr_before = mesh_acmr(obj.indices, obj.index_count, 32);
+    start = now_ms();
+    mesh_optimize(&obj);
+    double optimize_ms = now_ms() - start;
+    float acmr_after = mesh_acmr(obj.indices, obj.index_count, 32);
+
+    start = now_ms();
+    mesh_write_cache(&obj, cache_path);
+    double write_ms = now_ms() - start;
+
+    // mapping alone is nearly free, touching every page is the fair comparison
+    MeshView view;
+    start = now_ms();
+    if(!mesh_map_cache(cache_path, &view)) {
+        fprintf(stderr, "Couldn't map %s\n", cache_path);
+        return 1;
+    }
+    double map_ms = now_ms() - start;
+    u32 checksum = 0;
+    const u8 *bytes = view.mapping;
+    for(size_t i = 0; i < view.size; i += 64)
+        checksum += bytes[i];
+    double touch_ms = now_ms() - start;
+
+    fprintf(stdout, "%-24s %10s %10s\n", "", "ms", "MB");
+    fprintf(stdout, "%-24s %10.2f %10.2f\n", "parse OBJ", obj_ms, file_size(obj_path) / 1048576.0);
+    fprintf(stdout, "%-24s %10.2f %10.2f\n", "parse glTF", gltf_ms, (file_size(gltf_path) + file_size(bin_path)) / 1048576.0);
+    fprintf(stdout, "%-24s %10.2f\n", "optimize", optimize_ms);
+    fprintf(stdout, "%-24s %10.2f %10.2f\n", "write cache", write_ms, view.size / 1048576.0);
+    fprintf(stdout, "%-24s %10.3f\n", "mmap cache", map_ms);
+    fprintf(stdout, "%-24s %10.3f\n", "mmap + touch all pages", touch_ms);
+    fprintf(stdout, "ACMR (32 entry FIFO) %.3f -> %.3f, cache load %.0fx faster than OBJ, %.0fx than glTF (checksum %u)\n",
+            acmr_before, acmr_after, obj_ms / touch_ms, gltf_ms / touch_ms, checksum);
+
+    mesh_unmap(&view);
+    mesh_free(&obj);
+    mesh_free(&gltf);
+    return 0;
+}
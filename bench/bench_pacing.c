@@ -0,0 +1,68 @@
+/*
+ * Frame cap wait benchmark. Waits for a fixed period deadline the three
+ * ways a limiter can: nanosleep to the deadline, spinning on the clock,
+ * and FrameCap's sleep then spin. Reports how late each wakes up and how
+ * much CPU the wait burns.
+ *
+ *     bench_pacing [frames per rate]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "pacing.h"
+
+enum { WAIT_SLEEP, WAIT_SPIN, WAIT_HYBRID };
+
+static double
+cpu_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+run(const char *name, int method, double hz, int frames)
+{
+    FrameCap cap;
+    frame_cap_init(&cap, hz);
+    double late_sum = 0.0, late_max = 0.0;
+    double cpu_start = cpu_seconds(), start = pacing_now();
+    double deadline = start;
+    for(int f = 0; f < frames; f++) {
+        deadline += cap.period;
+        if(method == WAIT_SLEEP) {
+            double seconds = deadline - pacing_now();
+            if(seconds > 0.0) {
+                struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+                nanosleep(&ts, NULL);
+            }
+        } else if(method == WAIT_SPIN) {
+            while(pacing_now() < deadline)
+                ;
+        } else {
+            pacing_wait_until(&cap, deadline);
+        }
+        double late = pacing_now() - deadline;
+        late_sum += late;
+        if(late > late_max)
+            late_max = late;
+    }
+    double wall = pacing_now() - start;
+    fprintf(stdout, "%5.0f Hz %-14s late %7.3f ms avg %7.3f ms max, cpu %5.1f%%\n", hz, name,
+            late_sum / frames * 1000.0, late_max * 1000.0, (cpu_seconds() - cpu_start) / wall * 100.0);
+}
+
+int
+main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 120;
+    const double rates[] = { 60.0, 144.0, 240.0 };
+    for(int i = 0; i < 3; i++) {
+        run("sleep", WAIT_SLEEP, rates[i], frames);
+        run("spin", WAIT_SPIN, rates[i], frames);
+        run("sleep + spin", WAIT_HYBRID, rates[i], frames);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Asset loading benchmark. Reads every file of assets.pak once as loose
+ * files and once through the mapped pack, including the open, and checks
+ * that both give the same bytes. The first round of each mode is
+ * reported on its own since it is the closest to a cold start this
+ * process can get; the page cache is warm after it. The textures are
+ * then decoded straight out of the pack's views.
+ *
+ *     bench_pack [rounds]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "assets.h"
+#include "timing.h"
+
+static double
+load_all(bool loose, const char **names, int count, Arena *arena, u64 *checksum)
+{
+    double start = now_ms();
+    Assets assets;
+    assets_init(&assets, loose);
+    for(int i = 0; i < count; i++) {
+        size_t size;
+        const char *data = assets_read(&assets, names[i], arena, &size);
+        *checksum += (u8)data[size / 2] + size;
+    }
+    assets_destroy(&assets);
+    return now_ms() - start;
+}
+
+int
+main(int argc, char **argv)
+{
+    int rounds = argc > 1 ? atoi(argv[1]) : 200;
+
+    Assets packed;
+    assets_init(&packed, false);
+    if(!packed.packed) {
+        fprintf(stderr, "No %s%s, make assets.pak first\n", packed.root, ASSETS_PACK_NAME);
+        return 1;
+    }
+    int count = 0;
+    const char *names[256];
+    for(u32 b = 0; b < packed.pack.header->bucket_count && count < 256; b++) {
+        const PackEntry *e = &packed.pack.buckets[b];
+        if(e->hash)
+            names[count++] = strndup((const char *)packed.pack.base + e->name_offset, e->name_length);
+    }
+
+    Arena arena;
+    arena_init(&arena, "bench assets", 64 << 20);
+    u64 lz4_entries = 0, bytes = 0;
+    for(int i = 0; i < count; i++) {
+        size_t loose_size, packed_size;
+        Assets loose;
+        assets_init(&loose, true);
+        const char *a = assets_read(&loose, names[i], &arena, &loose_size);
+        const char *b = assets_read(&packed, names[i], &arena, &packed_size);
+        if(loose_size != packed_size || memcmp(a, b, loose_size + 1)) {
+            fprintf(stderr, "%s differs between the pack and the loose file\n", names[i]);
+            return 1;
+        }
+        lz4_entries += pack_lookup(&packed.pack, names[i])->compression == PACK_LZ4;
+        bytes += loose_size;
+    }
+    fprintf(stdout, "%d files, %.1f KB, %llu compressed, pack %.1f KB\n", count, bytes / 1024.0,
+            (unsigned long long)lz4_entries, packed.pack.size / 1024.0);
+
+    u64 checksum = 0;
+    for(int mode = 0; mode < 2; mode++) {
+        bool loose = mode == 0;
+        arena_reset(&arena);
+        double first = load_all(loose, names, count, &arena, &checksum);
+        double total = 0.0;
+        for(int r = 0; r < rounds; r++) {
+            arena_reset(&arena);
+            total += load_all(loose, names, count, &arena, &checksum);
+        }
+        fprintf(stdout, "%-12s first %8.3f ms, then %8.3f ms per load of all files\n", loose ? "loose" : "packed",
+                first, total / rounds);
+    }
+
+    // the decoder reads the mapping directly, no copy of the compressed image is made
+    double start = now_ms();
+    int decoded = 0;
+    for(int i = 0; i < count; i++) {
+        const PackEntry *e = pack_lookup(&packed.pack, names[i]);
+        if(strncmp(names[i], "teksture/", 9))
+            continue;
+        PackView v = pack_view(&packed.pack, e, &arena);
+        int w, h, channels;
+        u8 *pixels = stbi_load_from_memory(v.data, (int)v.size, &w, &h, &channels, 0);
+        if(pixels) {
+            checksum += pixels[0];
+            decoded++;
+            stbi_image_free(pixels);
+        }
+    }
+    fprintf(stdout, "%d textures decoded from the pack in %.3f ms, checksum %llu\n", decoded, now_ms() - start,
+            (unsigned long long)checksum);
+
+    for(int i = 0; i < count; i++)
+        free((char *)names[i]);
+    assets_destroy(&packed);
+    arena_destroy(&arena);
+    return 0;
+}
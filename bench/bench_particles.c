@@ -0,0 +1,134 @@
+/*
+ * Particle benchmark. Steps and draws the fountain on each path into a
+ * small hidden window, waiting for the GPU after each, and reports how
+ * many particles each path would fit in a 60 FPS frame.
+ * Then the CPU step alone, scalar against SSE, and how far the two
+ * paths drift apart from the same start over the same steps.
+ *
+ *     bench_particles [particles] [frames]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_gl.h"
+#include "assets.h"
+#include "particles.h"
+#include "shader.h"
+#include "timing.h"
+
+#define SIZE 512
+#define FRAME_MS (1000.0 / 60.0)
+#define STEP (1.0f / 60.0f)
+
+static const ParticleEmitter emitter = {
+    .position = { 0.0f, -0.5f, -4.5f },
+    .color = { 0.16f, 0.08f, 0.03f },
+    .speed = 4.5f,
+    .spread = 0.35f,
+    .lifetime = 2.5f,
+    .gravity = 4.0f,
+    .floor = -0.5f,
+    .size = 0.04f,
+};
+
+static void
+create(ParticleSystem *ps, Assets *assets, Arena *arena, int count)
+{
+    unsigned int update_shader = compile_shader(assets_read(assets, "shaders/particles_update.vs", arena, NULL),
+                                                GL_VERTEX_SHADER);
+    unsigned int draw_program = get_shader_program(assets, arena, "shaders/particles.vs", "shaders/particles.fs");
+    particles_init(ps, update_shader, draw_program, count, &emitter, arena);
+}
+
+/* Every stage waited on, timer queries aren't reliable on software drivers. */
+static void
+run(const char *name, ParticleSystem *ps, int mode, int frames, mat4x4 view, mat4x4 projection)
+{
+    double step_ms = 0.0, draw_ms = 0.0;
+    for(int f = 0; f < frames; f++) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glFinish();
+        double start = now_ms();
+        if(mode == PARTICLES_GPU)
+            particles_update_gpu(ps, STEP);
+        else
+            particles_update_cpu(ps, STEP);
+        glFinish();
+        double stepped = now_ms();
+        particles_draw(ps, view, projection);
+        glFinish();
+        step_ms += stepped - start;
+        draw_ms += now_ms() - stepped;
+    }
+    step_ms /= frames;
+    draw_ms /= frames;
+    fprintf(stdout, "%-4s %8d particles: step %8.3f ms, draw %8.3f ms, at 60 FPS %10.0f stepped, %9.0f stepped and drawn\n",
+            name, ps->count, step_ms, draw_ms, ps->count * FRAME_MS / step_ms, ps->count * FRAME_MS / (step_ms + draw_ms));
+}
+
+int
+main(int argc, char **argv)
+{
+    int count = argc > 1 ? atoi(argv[1]) : 262144;
+    int frames = argc > 2 ? atoi(argv[2]) : 60;
+
+    bench_window("bench_particles", SIZE, SIZE);
+    glViewport(0, 0, SIZE, SIZE);
+    glEnable(GL_DEPTH_TEST);
+    fprintf(stdout, "%s\n", (const char *)glGetString(GL_RENDERER));
+
+    Assets assets;
+    assets_init(&assets, false);
+    Arena arena;
+    arena_init(&arena, "bench particles", (size_t)count * sizeof(Particle) * 4 + (16 << 20));
+
+    mat4x4 view, projection;
+    vec3 eye = { 0.0f, 0.5f, 3.0f }, center = { 0.0f, 0.5f, -4.5f }, up = { 0.0f, 1.0f, 0.0f };
+    mat4x4_look_at(view, eye, center, up);
+    mat4x4_perspective(projection, 0.785398f, 1.0f, 0.1f, 100.0f);
+
+    ParticleSystem gpu, cpu;
+    create(&gpu, &assets, &arena, count);
+    create(&cpu, &assets, &arena, count);
+    run("gpu", &gpu, PARTICLES_GPU, frames, view, projection);
+    run("cpu", &cpu, PARTICLES_CPU, frames, view, projection);
+
+    // both started from the same prewarm and took the same steps
+    Particle *readback = ARENA_ARRAY(&arena, Particle, count);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.buffers[gpu.current]);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Particle) * (size_t)count, readback);
+    float drift = 0.0f;
+    int differ = 0;
+    for(int i = 0; i < count; i++) {
+        float d = 0.0f;
+        for(int k = 0; k < 3; k++)
+            d = fmaxf(d, fabsf(readback[i].position_life[k] - cpu.cpu[i].position_life[k]));
+        differ += d > 1e-3f;
+        drift = fmaxf(drift, d);
+    }
+    fprintf(stdout, "after %d steps: %d particles more than 1 mm apart, %.4f at most\n", frames, differ, drift);
+
+    Particle *copy = ARENA_ARRAY(&arena, Particle, count);
+    memcpy(copy, cpu.cpu, sizeof(Particle) * (size_t)count);
+    double start = now_ms();
+    for(int f = 0; f < frames; f++)
+        particles_step_scalar(copy, count, (u32)f, STEP, &emitter);
+    double scalar_ms = (now_ms() - start) / frames;
+    start = now_ms();
+    for(int f = 0; f < frames; f++)
+        particles_step(cpu.cpu, count, (u32)f, STEP, &emitter);
+    double simd_ms = (now_ms() - start) / frames;
+    fprintf(stdout, "cpu step alone: scalar %.3f ms, sse %.3f ms (%.2fx), %.0f and %.0f at 60 FPS\n", scalar_ms,
+            simd_ms, scalar_ms / simd_ms, count * FRAME_MS / scalar_ms, count * FRAME_MS / simd_ms);
+
+    particles_destroy(&gpu);
+    particles_destroy(&cpu);
+    arena_destroy(&arena);
+    assets_destroy(&assets);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Post processing benchmark. Resolves an HDR target through tone mapping
+ * alone and with bloom at a few render scales of a 1280x720 window,
+ * waiting for the GPU after each, and reports what each costs and what
+ * the scale saves. The target holds whatever was cleared into it, the
+ * passes cost the same whatever the scene.
+ *
+ *     bench_post [frames]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_gl.h"
+#include "assets.h"
+#include "post.h"
+#include "shader.h"
+#include "timing.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+
+static double
+run(Post *post, PostConfig config, int mode, int frames)
+{
+    double total = 0.0;
+    for(int f = 0; f < frames; f++) {
+        post_configure(post, config, config.render_scale, WIDTH, HEIGHT);
+        // bright enough in places that the bright pass keeps something
+        glClearColor(f & 1 ? 4.0f : 0.5f, 0.5f, 0.25f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glFinish();
+        double start = now_ms();
+        post_end(post, mode, WIDTH, HEIGHT);
+        glFinish();
+        total += now_ms() - start;
+    }
+    return total / frames;
+}
+
+int
+main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 60;
+
+    bench_window("bench_post", WIDTH, HEIGHT);
+    fprintf(stdout, "%s\n", (const char *)glGetString(GL_RENDERER));
+
+    Assets assets;
+    assets_init(&assets, false);
+    Arena arena;
+    arena_init(&arena, "bench post", 1 << 20);
+
+    Post post;
+    post_init(&post, get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_downsample.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_upsample.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_composite.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_fxaa.fs"),
+              get_shader_program(&assets, &arena, "shaders/deferred_light.vs", "shaders/post_taa.fs"));
+
+    const float scales[] = { 0.5f, 0.75f, 1.0f };
+    PostConfig config = {
+        .bloom_levels = 5,
+        .bloom_threshold = 1.0f,
+        .bloom_knee = 0.5f,
+        .bloom_intensity = 0.5f,
+        .exposure = 1.0f,
+    };
+    for(int i = 0; i < 3; i++) {
+        config.render_scale = scales[i];
+        double tonemap_ms = run(&post, config, POST_TONEMAP, frames);
+        double bloom_ms = run(&post, config, POST_BLOOM, frames);
+        fprintf(stdout, "%4.0f%% %4dx%-4d tone map %7.3f ms, with bloom %7.3f ms (bloom chain %7.3f ms, %d levels), %5.1f MB\n",
+                scales[i] * 100.0f, post.width, post.height, tonemap_ms, bloom_ms, bloom_ms - tonemap_ms,
+                post.bloom_levels, post_memory(&post) / (1024.0 * 1024.0));
+    }
+
+    post_destroy(&post);
+    arena_destroy(&arena);
+    assets_destroy(&assets);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Vertex format benchmark. Encodes a large torus in every position and
+ * normal format, reports the memory per vertex, the worst position and
+ * normal error after decoding on the CPU exactly as the shaders do, and
+ * the GPU time of drawing it repeatedly into a small hidden window.
+ *
+ *     bench_vertex [rings] [sides] [draws]
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_gl.h"
+#include "gpu_timer.h"
+#include "mesh.h"
+#include "vertex_format.h"
+
+#define FRAMES 32
+
+static const char *vertex_src =
+    "#version 330 core\n"
+    "layout (location = 0) in vec4 aPos;\n"
+    "layout (location = 1) in vec4 aNormal;\n"
+    "uniform vec3 positionOffset;\n"
+    "uniform vec3 positionScale;\n"
+    "uniform int normalEncoding;\n"
+    "out vec3 Normal;\n"
+    "vec3 decode_normal(vec4 n)\n"
+    "{\n"
+    "    if(normalEncoding == 0)\n"
+    "        return n.xyz;\n"
+    "    vec3 v = vec3(n.xy, 1.0 - abs(n.x) - abs(n.y));\n"
+    "    if(v.z < 0.0)\n"
+    "        v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);\n"
+    "    return normalize(v);\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    Normal = decode_normal(aNormal);\n"
+    "    gl_Position = vec4((positionOffset + aPos.xyz * positionScale) * 0.25, 1.0);\n"
+    "}\n";
+
+static const char *fragment_src =
+    "#version 330 core\n"
+    "in vec3 Normal;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    FragColor = vec4(Normal * 0.5 + 0.5, 1.0);\n"
+    "}\n";
+
+static unsigned int
+compile(const char *src, GLenum type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &src, NULL);
+    glCompileShader(shader);
+    int success;
+    char log[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if(!success) {
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "shader: %s\n", log);
+        exit(1);
+    }
+    return shader;
+}
+
+static float
+half_to_float(u16 h)
+{
+    u32 sign = (u32)(h & 0x8000) << 16, exponent = (h >> 10) & 0x1f, mantissa = h & 0x3ff;
+    u32 bits = exponent == 0 ? sign : sign | (exponent - 15 + 127) << 23 | mantissa << 13;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static float
+snorm(int value, int max)
+{
+    float v = (float)value / (float)max;
+    return v < -1.0f ? -1.0f : v;
+}
+
+/* Mirrors the vertex shaders, returns the decoded position and normal of vertex i. */
+static void
+decode(VertexFormat f, const u8 *data, u32 i, const vec3 offset, const vec3 scale, vec3 position, vec3 normal)
+{
+    const u8 *vertex = data + (size_t)i * vertex_format_stride(f);
+    u16 q[3];
+    memcpy(q, vertex, sizeof(q));
+    for(int k = 0; k < 3; k++) {
+        float a;
+        switch(f.position) {
+        case POSITION_FLOAT: memcpy(&a, vertex + k * 4, 4); break;
+        case POSITION_HALF: a = half_to_float(q[k]); break;
+        case POSITION_SNORM16: a = snorm((i16)q[k], 32767); break;
+        default: a = q[k] / 65535.0f; break;
+        }
+        position[k] = offset[k] + a * scale[k];
+    }
+
+    const u8 *n = vertex + (f.position == POSITION_FLOAT ? 12 : 8);
+    if(f.normal == NORMAL_FLOAT) {
+        memcpy(normal, n, 12);
+    } else if(f.normal == NORMAL_INT_2_10_10_10) {
+        u32 packed;
+        memcpy(&packed, n, 4);
+        for(int k = 0; k < 3; k++) {
+            int v = (int)((packed >> (10 * k)) & 0x3ff);
+            normal[k] = snorm(v >= 512 ? v - 1024 : v, 511);
+        }
+    } else {
+        i16 e[2];
+        memcpy(e, n, 4);
+        float x = snorm(e[0], 32767), y = snorm(e[1], 32767);
+        normal[0] = x;
+        normal[1] = y;
+        normal[2] = 1.0f - fabsf(x) - fabsf(y);
+        if(normal[2] < 0.0f) {
+            normal[0] = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            normal[1] = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        }
+    }
+    vec3_norm(normal, normal);
+}
+
+int
+main(int argc, char **argv)
+{
+    u32 rings = argc > 1 ? (u32)atoi(argv[1]) : 512;
+    u32 sides = argc > 2 ? (u32)atoi(argv[2]) : 256;
+    int draws = argc > 3 ? atoi(argv[3]) : 16;
+
+    bench_window("bench_vertex", 256, 256);
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, compile(vertex_src, GL_VERTEX_SHADER));
+    glAttachShader(program, compile(fragment_src, GL_FRAGMENT_SHADER));
+    glLinkProgram(program);
+    glUseProgram(program);
+    GpuMeshUniforms mesh_uniforms = gpu_mesh_uniforms(program);
+    glViewport(0, 0, 256, 256);
+    glEnable(GL_DEPTH_TEST);
+
+    Mesh m;
+    mesh_torus(&m, rings, sides);
+    mesh_optimize(&m);
+    fprintf(stdout, "torus %u vertices, %u triangles, %d draws per frame\n", m.vertex_count, m.index_count / 3, draws);
+    fprintf(stdout, "%-44s %6s %9s %7s %12s %10s %10s\n", "format", "bytes", "MB", "ratio", "max pos err", "max angle", "ms/frame");
+
+    const VertexFormat formats[] = {
+        { POSITION_FLOAT, NORMAL_FLOAT },
+        { POSITION_FLOAT, NORMAL_INT_2_10_10_10 },
+        { POSITION_HALF, NORMAL_INT_2_10_10_10 },
+        { POSITION_HALF, NORMAL_OCTAHEDRAL },
+        { POSITION_SNORM16, NORMAL_OCTAHEDRAL },
+        { POSITION_UNORM16, NORMAL_OCTAHEDRAL },
+    };
+    double float_bytes = 0.0;
+    for(size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        vec3 offset, scale;
+        u8 *data = vertex_format_encode(formats[f], &m, offset, scale);
+        float position_error = 0.0f, normal_error = 0.0f;
+        for(u32 i = 0; i < m.vertex_count; i++) {
+            vec3 p, n;
+            decode(formats[f], data, i, offset, scale, p, n);
+            for(int k = 0; k < 3; k++)
+                position_error = fmaxf(position_error, fabsf(p[k] - m.positions[i * 3 + k]));
+            float d = vec3_mul_inner(n, &m.normals[i * 3]);
+            normal_error = fmaxf(normal_error, acosf(fminf(d, 1.0f)));
+        }
+        free(data);
+
+        GpuMesh g;
+        gpu_mesh_create(&g, &m, formats[f]);
+        gpu_mesh_bind(&g, &mesh_uniforms);
+        GpuTimer timer;
+        gpu_timer_init(&timer);
+        for(int frame = 0; frame < FRAMES + GPU_TIMER_LATENCY; frame++) {
+            // the first frames only fill the query ring
+            if(frame == GPU_TIMER_LATENCY)
+                gpu_timer_reset(&timer);
+            gpu_timer_begin(&timer);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            for(int d = 0; d < draws; d++)
+                gpu_mesh_draw(&g);
+            gpu_timer_end(&timer);
+            glFinish();
+        }
+
+        if(f == 0)
+            float_bytes = (double)g.vertex_bytes;
+        fprintf(stdout, "%-44s %6u %9.2f %6.2fx %12.6f %8.4f deg %10.3f\n", vertex_format_name(formats[f]), g.stride,
+                g.vertex_bytes / (1024.0 * 1024.0), float_bytes / g.vertex_bytes, position_error,
+                normal_error * 180.0f / (float)M_PI, gpu_timer_average(&timer));
+        gpu_timer_destroy(&timer);
+        gpu_mesh_destroy(&g);
+    }
+
+    mesh_free(&m);
+    glfwTerminate();
+    return 0;
+}
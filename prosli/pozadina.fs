@@ -0,0 +1,15 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 ScreenPos;
+
+uniform float time;
+
+void main()
+{
+	// a slow vertical gradient that breathes with the time
+	float t = 0.5 + 0.5 * sin(time * 0.5);
+	vec3 top = mix(vec3(0.17, 0.2, 0.23), vec3(0.1, 0.15, 0.3), t);
+	vec3 bottom = vec3(0.05, 0.05, 0.08);
+	FragColor = vec4(mix(bottom, top, ScreenPos.y * 0.5 + 0.5), 1.0);
+}
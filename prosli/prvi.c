@@ -1,215 +1,82 @@
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-#include <stdio.h>
-
-#include "../untitled_types.h"
-
-void framebuffer_size_callback(GLFWwindow* window, int width, int height)
-{
-    glViewport(0, 0, width, height);
-}
-
-void processInput(GLFWwindow *window)
-{
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-        glfwSetWindowShouldClose(window, true);
-}
-
-int main(int argc, char **argv)
-{
-    (void)argc;
-    (void)argv;
-
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    
-    // ovo je za mac-os
-    //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-
-    GLFWwindow *window = glfwCreateWindow(800, 600, "OpenGL", 0, 0);
-    if(!window) {
-        fprintf(stderr, "Couldn't create window\n");
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
-
-    
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        fprintf(stderr, "Failed to initialize GLAD\n");
-        return -1;
-    }
-
-    glViewport(0, 0, 800, 600);
-
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback); 
-
-    float vertices[] = {
-        0.5f, -0.5f, 0.0f,
-        0.0f,  0.5f, 0.0f,
-        0.0f, -0.5f, 0.0f
-
-    };
-
-    float vertices3[] = {
-        0.0f, -0.5f, 0.0f,
-       -0.5f, -0.5f, 0.0f,
-        0.0f,  0.5f, 0.0f
-    };
-
-
-    float vertices2[] = {
-        0.5f,  0.5f, 0.0f,  // top right
-        0.5f, -0.5f, 0.0f,  // bottom right
-        -0.5f, -0.5f, 0.0f,  // bottom left
-        -0.5f,  0.5f, 0.0f   // top left 
-    };
-    unsigned int indices[] = {  // note that we start from 0!
-        0, 1, 3,   // first triangle
-        1, 2, 3    // second triangle
-    };
-
-    const char *vertexShaderSource = "#version 330 core\n"
+/*
+ * Hello triangle: two triangles in wireframe, each with its own program,
+ * the shaders inline.
+ */
+#include "app.h"
+#include "shader.h"
+
+static const char *vertex_source = "#version 330 core\n"
     "layout (location = 0) in vec3 aPos;\n"
     "void main()\n"
     "{\n"
-    "   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-    "}\0";
-
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    int  success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-
-    if(!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        fprintf(stderr, "ERROR SHADER VERTEX COMPILATION_FAILED %s\n", infoLog);
-    }
-
-    const char *fragmentShaderSource  = "#version 330 core\n"
-        "out vec4 FragColor;\n"
-        "void main() { \n"
-        "    FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-        "}\0"; 
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, 0);
-    glCompileShader(fragmentShader);
-
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-
-    if(!success) {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        fprintf(stderr, "ERROR SHADER FRAGMENT COMPILATION_FAILED %s\n", infoLog);
-    }
-
-    const char *fragmentShaderSource2 = "#version 330 core\n"
-        "out vec4 FragColor;\n"
-        "void main() { \n"
-        "    FragColor = vec4(1.0f, 1.0f, 0.0f, 1.0f);\n"
-        "}\0"; 
-
-    unsigned int fragmentShader2 = glCreateShader(GL_FRAGMENT_SHADER);
-
-    glShaderSource(fragmentShader2, 1, &fragmentShaderSource2, 0);
-    glCompileShader(fragmentShader2);
-
-    glGetShaderiv(fragmentShader2, GL_COMPILE_STATUS, &success);
-
-    if(!success) {
-        glGetShaderInfoLog(fragmentShader2, 512, NULL, infoLog);
-        fprintf(stderr, "ERROR SHADER FRAGMENT COMPILATION_FAILED %s\n", infoLog);
-    }
-
-    unsigned int shaderProgram = glCreateProgram();
-    unsigned int shaderProgram2 = glCreateProgram();
-
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    glAttachShader(shaderProgram2, vertexShader);
-    glAttachShader(shaderProgram2, fragmentShader2);
-    glLinkProgram(shaderProgram2);
-
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if(!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        fprintf(stderr, "ERROR SHADER Program COMPILATION_FAILED %s\n", infoLog);
+    "   gl_Position = vec4(aPos, 1.0);\n"
+    "}\n";
+
+static const char *orange_source = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { \n"
+    "    FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+    "}\n";
+
+static const char *yellow_source = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { \n"
+    "    FragColor = vec4(1.0f, 1.0f, 0.0f, 1.0f);\n"
+    "}\n";
+
+static const float right_triangle[] = {
+    0.5f, -0.5f, 0.0f,
+    0.0f,  0.5f, 0.0f,
+    0.0f, -0.5f, 0.0f
+};
+
+static const float left_triangle[] = {
+    0.0f, -0.5f, 0.0f,
+   -0.5f, -0.5f, 0.0f,
+    0.0f,  0.5f, 0.0f
+};
+
+static struct {
+    unsigned int programs[2];
+    unsigned int vaos[2], vbos[2];
+} prvi;
+
+static void
+prvi_init(App *app)
+{
+    (void)app;
+    prvi.programs[0] = link_shader_program(vertex_source, orange_source, "prvi orange");
+    prvi.programs[1] = link_shader_program(vertex_source, yellow_source, "prvi yellow");
+
+    const float *vertices[2] = { right_triangle, left_triangle };
+    glGenVertexArrays(2, prvi.vaos);
+    glGenBuffers(2, prvi.vbos);
+    for(int i = 0; i < 2; i++) {
+        glBindVertexArray(prvi.vaos[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, prvi.vbos[i]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(right_triangle), vertices[i], GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
     }
-
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-    glDeleteShader(fragmentShader2);
-
-
-    unsigned int VBO, VAO;
-
-    unsigned int EBO;
-    glGenBuffers(1, &EBO);
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(VAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-
-    // You can unbind the VAO afterwards so other VAO calls won't accidentally modify this VAO, but this rarely happens. Modifying other
-    // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
-    glBindVertexArray(0); 
-
-    unsigned int VAO1, VBO1;
-    glGenVertexArrays(1, &VAO1);
-    glGenBuffers(1, &VBO1);
-
-    glBindVertexArray(VAO1);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO1);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices3), vertices3, GL_STATIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-    glBindVertexArray(0); 
-
-
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+}
 
-    while(!glfwWindowShouldClose(window)) {
-        processInput(window);
-
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        glUseProgram(shaderProgram);
-        glBindVertexArray(VAO); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-   
-        glUseProgram(shaderProgram2);
-        glBindVertexArray(VAO1); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
+static void
+prvi_draw(App *app)
+{
+    (void)app;
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    for(int i = 0; i < 2; i++) {
+        glUseProgram(prvi.programs[i]);
+        glBindVertexArray(prvi.vaos[i]);
         glDrawArrays(GL_TRIANGLES, 0, 3);
-        //glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();    
     }
+}
 
-    glfwTerminate();
-    return 0;
+int
+main(int argc, char **argv)
+{
+    Scene scene = { "prvi", false, prvi_init, prvi_draw };
+    return app_run(&scene, argc, argv);
 }
@@ -0,0 +1,117 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+uniform usampler2D gMaterial;
+uniform sampler2D gNormal;
+uniform sampler2D gDepth;
+
+uniform mat4 invProjection;
+uniform mat4 invView;
+// light position is in view space, the camera sits at the origin;
+// a light with radius 0 is directional and lightPos is the direction towards it
+uniform vec3 lightPos;
+uniform vec3 lightColor;
+uniform float lightRadius;
+uniform float ambientStrength;
+
+// two texels a material, see material.h
+uniform samplerBuffer materials;
+
+uniform int castsShadow;
+
+// the ambient pass takes these instead of ambientStrength when enabled, in world space
+uniform bool iblEnabled;
+uniform samplerCube irradianceMap;
+uniform samplerCube prefilteredMap;
+uniform float prefilteredMaxLod;
+
+vec3 oct_decode(vec2 f)
+{
+    f = f * 2.0 - 1.0;
+    vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+#include "shadow.glsl"
+
+/*
+ * GGX, Smith-Schlick visibility and Schlick's Fresnel over a Lambert
+ * diffuse. Light colors have the 1/PI of the diffuse folded in, a white
+ * diffuse surface facing a light reflects its color.
+ */
+vec3 brdf(vec3 n, vec3 v, vec3 l, vec3 albedo, vec3 f0, float roughness)
+{
+    vec3 h = normalize(v + l);
+    float nDotV = max(dot(n, v), 1e-4);
+    float nDotL = max(dot(n, l), 0.0);
+    float nDotH = max(dot(n, h), 0.0);
+    float a2 = roughness * roughness * roughness * roughness;
+    float d = nDotH * nDotH * (a2 - 1.0) + 1.0;
+    float k = (roughness + 1.0) * (roughness + 1.0) / 8.0;
+    float vis = 0.25 / ((nDotV * (1.0 - k) + k) * (nDotL * (1.0 - k) + k));
+    vec3 fresnel = f0 + (1.0 - f0) * pow(1.0 - max(dot(v, h), 0.0), 5.0);
+    return ((1.0 - fresnel) * albedo + fresnel * (a2 / (d * d) * vis)) * nDotL;
+}
+
+// the split sum's second factor, fitted instead of a lookup texture
+vec3 env_brdf(vec3 f0, float roughness, float nDotV)
+{
+    vec4 r = roughness * vec4(-1.0, -0.0275, -0.572, 0.022) + vec4(1.0, 0.0425, 1.04, -0.04);
+    float a004 = min(r.x * r.x, exp2(-9.28 * nDotV)) * r.x + r.y;
+    vec2 ab = vec2(-1.04, 1.04) * a004 + r.zw;
+    return f0 * ab.x + ab.y;
+}
+
+void main()
+{
+    // fetched by pixel, the G-buffer may be larger than the view TexCoord spans
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    float depth = texelFetch(gDepth, pixel, 0).r;
+    if(depth == 1.0)
+        discard;
+
+    vec4 clip = vec4(vec3(TexCoord, depth) * 2.0 - 1.0, 1.0);
+    vec4 view = invProjection * clip;
+    vec3 FragPos = view.xyz / view.w;
+
+    int materialIndex = int(texelFetch(gMaterial, pixel, 0).r);
+    vec4 baseMetallic = texelFetch(materials, materialIndex * 2);
+    vec4 roughnessReflectance = texelFetch(materials, materialIndex * 2 + 1);
+    float roughness = clamp(roughnessReflectance.x, 0.04, 1.0);
+    vec3 albedo = baseMetallic.rgb * (1.0 - baseMetallic.a);
+    vec3 f0 = mix(vec3(0.16 * roughnessReflectance.y * roughnessReflectance.y), baseMetallic.rgb, baseMetallic.a);
+
+    vec3 norm = oct_decode(texelFetch(gNormal, pixel, 0).rg);
+    vec3 viewDir = normalize(-FragPos);
+
+    // ambient, a flat environment without IBL
+    vec3 ambient = vec3(0.0);
+    if(ambientStrength > 0.0) {
+        vec3 irradiance = vec3(ambientStrength), reflection = vec3(ambientStrength);
+        if(iblEnabled) {
+            mat3 toWorld = mat3(invView);
+            irradiance = texture(irradianceMap, toWorld * norm).rgb;
+            reflection = textureLod(prefilteredMap, toWorld * reflect(-viewDir, norm), roughness * prefilteredMaxLod).rgb;
+        }
+        ambient = irradiance * albedo + reflection * env_brdf(f0, roughness, max(dot(norm, viewDir), 0.0));
+    }
+
+    bool directional = lightRadius <= 0.0;
+    vec3 toLight = directional ? lightPos : lightPos - FragPos;
+    float dist = length(toLight);
+    vec3 lightDir = toLight / dist;
+    float diff = max(dot(norm, lightDir), 0.0);
+
+    float attenuation = directional ? 1.0 : clamp(1.0 - dist / lightRadius, 0.0, 1.0);
+    attenuation *= attenuation;
+    if(castsShadow != 0 && diff > 0.0)
+        attenuation *= shadow_factor((invView * vec4(FragPos, 1.0)).xyz, -FragPos.z, diff);
+
+    vec3 result = ambient + brdf(norm, viewDir, lightDir, albedo, f0, roughness) * lightColor * attenuation;
+    FragColor = vec4(result, 1.0);
+}
@@ -0,0 +1,19 @@
+#version 330 core
+layout (location = 0) in vec4 aPos;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+// per mesh dequantization, see vertex_format.h
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+
+// must match the lit programs bit for bit, the lit pass tests with GL_EQUAL
+invariant gl_Position;
+
+void main()
+{
+    vec3 position = positionOffset + aPos.xyz * positionScale;
+	gl_Position = projection * view * model * vec4(position, 1.0);
+}
@@ -0,0 +1,26 @@
+#version 330 core
+layout (location = 0) out uint gMaterial;
+layout (location = 1) out vec2 gNormal;
+
+in vec3 Normal;
+
+// the light pass fetches the material itself
+uniform int materialIndex;
+
+vec2 oct_wrap(vec2 v)
+{
+    return (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec2 oct_encode(vec3 n)
+{
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    n.xy = n.z >= 0.0 ? n.xy : oct_wrap(n.xy);
+    return n.xy * 0.5 + 0.5;
+}
+
+void main()
+{
+    gMaterial = uint(materialIndex);
+    gNormal = oct_encode(normalize(Normal));
+}
@@ -0,0 +1,34 @@
+#version 330 core
+layout (location = 0) in vec4 aPos;
+layout (location = 1) in vec4 aNormal;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+// per mesh dequantization, see vertex_format.h
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+uniform int normalEncoding;
+
+vec3 decode_normal()
+{
+    if(normalEncoding == 0)
+        return aNormal.xyz;
+    vec3 n = vec3(aNormal.xy, 1.0 - abs(aNormal.x) - abs(aNormal.y));
+    if(n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
+invariant gl_Position;
+
+out vec3 Normal;
+
+void main()
+{
+    vec3 position = positionOffset + aPos.xyz * positionScale;
+	gl_Position = projection * view * model * vec4(position, 1.0);
+    // lighting happens in view space, the position is rebuilt from depth
+    Normal = mat3(transpose(inverse(view * model))) * decode_normal();
+}
@@ -0,0 +1,11 @@
+#version 330 core
+
+uniform sampler2D depthTexture;
+uniform vec2 viewScale;   // the corner of depthTexture the frame covered
+
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = vec4(texelFetch(depthTexture, ivec2(gl_FragCoord.xy * viewScale), 0).r);
+}
@@ -0,0 +1,28 @@
+#version 330 core
+
+// base and max level are set to the level above the one being written
+uniform sampler2D depthPyramid;
+
+out vec4 FragColor;
+
+float fetch(ivec2 p)
+{
+    return texelFetch(depthPyramid, min(p, textureSize(depthPyramid, 0) - 1), 0).r;
+}
+
+void main()
+{
+    ivec2 size = textureSize(depthPyramid, 0);
+    ivec2 p = ivec2(gl_FragCoord.xy) * 2;
+    float d = max(max(fetch(p), fetch(p + ivec2(1, 0))), max(fetch(p + ivec2(0, 1)), fetch(p + ivec2(1, 1))));
+
+    // an odd level folds its last row and column into the texels before them
+    bool last_x = p.x + 3 == size.x, last_y = p.y + 3 == size.y;
+    if(last_x)
+        d = max(d, max(fetch(p + ivec2(2, 0)), fetch(p + ivec2(2, 1))));
+    if(last_y)
+        d = max(d, max(fetch(p + ivec2(0, 2)), fetch(p + ivec2(1, 2))));
+    if(last_x && last_y)
+        d = max(d, fetch(p + ivec2(2, 2)));
+    FragColor = vec4(d);
+}
@@ -0,0 +1,42 @@
+#version 330 core
+
+layout (location = 0) in vec3 boxMin;
+layout (location = 1) in vec3 boxMax;
+
+uniform mat4 viewProjection;
+uniform sampler2D depthPyramid;
+uniform int levelCount;
+
+// captured with transform feedback, 0 means hidden
+out float visible;
+
+void main()
+{
+    visible = 1.0;
+    vec3 lo = vec3(1e30), hi = vec3(-1e30);
+    for(int i = 0; i < 8; i++) {
+        vec3 corner = mix(boxMin, boxMax, vec3(i & 1, (i >> 1) & 1, (i >> 2) & 1));
+        vec4 clip = viewProjection * vec4(corner, 1.0);
+        // reaching past the near plane, the box is right in front of the camera
+        if(clip.z < -clip.w || clip.w <= 0.0)
+            return;
+        vec3 ndc = clip.xyz / clip.w;
+        lo = min(lo, ndc);
+        hi = max(hi, ndc);
+    }
+    if(any(lessThan(hi.xy, vec2(-1.0))) || any(greaterThan(lo.xy, vec2(1.0))))
+        return;
+
+    // the level where the screen rectangle touches at most 2x2 texels
+    vec2 screen = vec2(textureSize(depthPyramid, 0));
+    vec2 a = clamp(lo.xy * 0.5 + 0.5, 0.0, 1.0) * screen;
+    vec2 b = clamp(hi.xy * 0.5 + 0.5, 0.0, 1.0) * screen;
+    vec2 size = b - a;
+    int level = int(clamp(ceil(log2(max(max(size.x, size.y), 1.0))), 0.0, float(levelCount - 1)));
+    // level sizes follow from level 0, some drivers get textureSize wrong for a varying lod
+    ivec2 last = max(textureSize(depthPyramid, 0) >> level, ivec2(1)) - 1;
+    ivec2 t0 = min(ivec2(a) >> level, last), t1 = min(ivec2(b) >> level, last);
+    float farthest = max(max(texelFetch(depthPyramid, t0, level).r, texelFetch(depthPyramid, ivec2(t1.x, t0.y), level).r),
+                         max(texelFetch(depthPyramid, ivec2(t0.x, t1.y), level).r, texelFetch(depthPyramid, t1, level).r));
+    visible = lo.z * 0.5 + 0.5 <= farthest ? 1.0 : 0.0;
+}
@@ -0,0 +1,43 @@
+#version 330 core
+
+// cosine weighted hemisphere integral of the environment, divided by pi so albedo multiplies it directly
+uniform samplerCube environment;
+uniform int face;
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+#define PI 3.14159265
+#define STEP 0.1
+
+// GL cube face order, uv in -1..1 as the face is rendered
+vec3 cube_direction(int face, vec2 uv)
+{
+    if(face == 0) return normalize(vec3(1.0, -uv.y, -uv.x));
+    if(face == 1) return normalize(vec3(-1.0, -uv.y, uv.x));
+    if(face == 2) return normalize(vec3(uv.x, 1.0, uv.y));
+    if(face == 3) return normalize(vec3(uv.x, -1.0, -uv.y));
+    if(face == 4) return normalize(vec3(uv.x, -uv.y, 1.0));
+    return normalize(vec3(-uv.x, -uv.y, -1.0));
+}
+
+void main()
+{
+    vec3 n = cube_direction(face, TexCoord * 2.0 - 1.0);
+    vec3 up = abs(n.y) < 0.999 ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);
+    vec3 right = normalize(cross(up, n));
+    up = cross(n, right);
+
+    // a 16x16 mip is plenty for a lobe this wide and keeps the sun from aliasing
+    vec3 sum = vec3(0.0);
+    float count = 0.0;
+    for(float phi = 0.0; phi < 2.0 * PI; phi += STEP) {
+        for(float theta = 0.0; theta < 0.5 * PI; theta += STEP) {
+            vec3 t = vec3(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
+            vec3 s = t.x * right + t.y * up + t.z * n;
+            sum += textureLod(environment, s, 3.0).rgb * cos(theta) * sin(theta);
+            count += 1.0;
+        }
+    }
+    FragColor = vec4(PI * sum / count, 1.0);
+}
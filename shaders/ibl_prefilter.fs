@@ -0,0 +1,73 @@
+#version 330 core
+
+// GGX importance sampled with normal = view = reflection, one mip per roughness
+uniform samplerCube environment;
+uniform float environmentSize;
+uniform float roughness;
+uniform int face;
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+#define PI 3.14159265
+#define SAMPLES 256u
+
+// GL cube face order, uv in -1..1 as the face is rendered
+vec3 cube_direction(int face, vec2 uv)
+{
+    if(face == 0) return normalize(vec3(1.0, -uv.y, -uv.x));
+    if(face == 1) return normalize(vec3(-1.0, -uv.y, uv.x));
+    if(face == 2) return normalize(vec3(uv.x, 1.0, uv.y));
+    if(face == 3) return normalize(vec3(uv.x, -1.0, -uv.y));
+    if(face == 4) return normalize(vec3(uv.x, -uv.y, 1.0));
+    return normalize(vec3(-uv.x, -uv.y, -1.0));
+}
+
+vec2 hammersley(uint i)
+{
+    uint bits = i;
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return vec2(float(i) / float(SAMPLES), float(bits) * 2.3283064365386963e-10);
+}
+
+void main()
+{
+    vec3 n = cube_direction(face, TexCoord * 2.0 - 1.0);
+    if(roughness == 0.0) {
+        FragColor = vec4(textureLod(environment, n, 0.0).rgb, 1.0);
+        return;
+    }
+    vec3 up = abs(n.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent = normalize(cross(up, n));
+    vec3 bitangent = cross(n, tangent);
+
+    float a = roughness * roughness;
+    float texel_angle = 4.0 * PI / (6.0 * environmentSize * environmentSize);
+    vec3 sum = vec3(0.0);
+    float weight = 0.0;
+    for(uint i = 0u; i < SAMPLES; i++) {
+        vec2 xi = hammersley(i);
+        float phi = 2.0 * PI * xi.x;
+        float cos_theta = sqrt((1.0 - xi.y) / (1.0 + (a * a - 1.0) * xi.y));
+        float sin_theta = sqrt(1.0 - cos_theta * cos_theta);
+        vec3 h = normalize(tangent * cos(phi) * sin_theta + bitangent * sin(phi) * sin_theta + n * cos_theta);
+        vec3 l = normalize(2.0 * dot(n, h) * h - n);
+        float n_dot_l = dot(n, l);
+        if(n_dot_l <= 0.0)
+            continue;
+
+        // read from the mip whose texels cover what this sample stands for, bright spots would sparkle otherwise
+        float n_dot_h = max(dot(n, h), 0.0);
+        float d = (n_dot_h * n_dot_h * (a * a - 1.0) + 1.0);
+        float pdf = a * a / (PI * d * d) * 0.25 + 1e-4;
+        float sample_angle = 1.0 / (float(SAMPLES) * pdf);
+        float lod = 0.5 * log2(sample_angle / texel_angle) + 1.0;
+        sum += textureLod(environment, l, max(lod, 0.0)).rgb * n_dot_l;
+        weight += n_dot_l;
+    }
+    FragColor = vec4(sum / weight, 1.0);
+}
@@ -0,0 +1,33 @@
+#version 330 core
+
+// the environment, a procedural sky with a sun
+uniform int face;
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+// GL cube face order, uv in -1..1 as the face is rendered
+vec3 cube_direction(int face, vec2 uv)
+{
+    if(face == 0) return normalize(vec3(1.0, -uv.y, -uv.x));
+    if(face == 1) return normalize(vec3(-1.0, -uv.y, uv.x));
+    if(face == 2) return normalize(vec3(uv.x, 1.0, uv.y));
+    if(face == 3) return normalize(vec3(uv.x, -1.0, -uv.y));
+    if(face == 4) return normalize(vec3(uv.x, -uv.y, 1.0));
+    return normalize(vec3(-uv.x, -uv.y, -1.0));
+}
+
+const vec3 sun_direction = vec3(-0.42, 0.56, -0.71);
+const vec3 sun_color = vec3(1.0, 0.9, 0.75);
+const vec3 zenith = vec3(0.12, 0.24, 0.5);
+const vec3 horizon = vec3(0.55, 0.58, 0.62);
+const vec3 ground = vec3(0.16, 0.15, 0.14);
+
+void main()
+{
+    vec3 d = cube_direction(face, TexCoord * 2.0 - 1.0);
+    vec3 c = d.y >= 0.0 ? mix(horizon, zenith, sqrt(d.y)) : mix(horizon, ground, sqrt(min(-d.y * 4.0, 1.0)));
+    float s = max(dot(d, normalize(sun_direction)), 0.0);
+    c += sun_color * (pow(s, 1000.0) * 40.0 + pow(s, 12.0) * 0.3);
+    FragColor = vec4(c, 1.0);
+}
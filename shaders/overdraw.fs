@@ -0,0 +1,8 @@
+#version 330 core
+out vec4 FragColor;
+
+void main()
+{
+    // additively blended, one step per fragment shader invocation
+	FragColor = vec4(vec3(1.0 / 16.0), 1.0);
+}
@@ -0,0 +1,18 @@
+#version 330 core
+
+in vec2 Corner;
+in float Fade;
+
+uniform vec3 color;
+
+out vec4 FragColor;
+
+void main()
+{
+    float d = dot(Corner, Corner);
+    if(d > 1.0)
+        discard;
+    // added on top of the scene, premultiplied
+    float a = (1.0 - d) * Fade;
+    FragColor = vec4(color * a, a);
+}
@@ -0,0 +1,21 @@
+#version 330 core
+
+layout (location = 0) in vec2 aCorner;
+layout (location = 1) in vec4 aPositionLife;
+layout (location = 2) in vec4 aVelocitySize;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform float lifetime;
+
+out vec2 Corner;
+out float Fade;
+
+void main()
+{
+    // the quad is spread in view space, so it faces the camera without its axes
+    vec4 center = view * vec4(aPositionLife.xyz, 1.0);
+    Corner = aCorner;
+    Fade = clamp(aPositionLife.w / lifetime * 2.0, 0.0, 1.0);
+    gl_Position = projection * (center + vec4(aCorner * aVelocitySize.w, 0.0, 0.0));
+}
@@ -0,0 +1,60 @@
+#version 330 core
+
+layout (location = 0) in vec4 aPositionLife;
+layout (location = 1) in vec4 aVelocitySize;
+
+uniform float dt;
+uniform uint step;
+uniform vec3 emitter;
+uniform float speed;
+uniform float spread;
+uniform float lifetime;
+uniform float gravity;
+uniform float floorHeight;
+uniform float bounce;
+uniform float size;
+
+// captured with transform feedback into the other buffer
+out vec4 positionLife;
+out vec4 velocitySize;
+
+// lowbias32, the CPU path in particles.c has the same one
+uint hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+float random(inout uint state)
+{
+    state = hash(state);
+    return float(state & 0xffffffu) / 16777216.0;
+}
+
+void main()
+{
+    vec4 p = aPositionLife;
+    vec4 v = aVelocitySize;
+    p.w -= dt;
+    if(p.w <= 0.0) {
+        uint state = uint(gl_VertexID) * 0x9e3779b9u ^ step * 0x85ebca6bu;
+        float angle = random(state) * 6.2831853;
+        float radial = spread * sqrt(random(state));
+        float s = speed * (0.75 + 0.5 * random(state));
+        p = vec4(emitter, lifetime * (0.5 + 0.5 * random(state)));
+        v = vec4(cos(angle) * radial * s, s, sin(angle) * radial * s, size * (0.5 + random(state)));
+    } else {
+        v.y -= gravity * dt;
+        p.xyz += v.xyz * dt;
+        if(p.y < floorHeight) {
+            p.y = floorHeight;
+            v.y *= -bounce;
+        }
+    }
+    positionLife = p;
+    velocitySize = v;
+}
@@ -0,0 +1,55 @@
+#version 330 core
+
+uniform sampler2D scene;
+uniform sampler2D bloom;
+uniform vec2 texelSize;         // of scene
+uniform vec2 uvScale;           // the corner of scene the frame covered
+uniform vec2 bloomUvScale;      // and of the bloom chain's first level
+uniform float exposure;
+uniform float bloomIntensity;   // 0 when the bloom chain wasn't built this frame
+uniform float sharpness;        // 0 when the scene is drawn at window size
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+// Narkowicz's fit of the ACES filmic curve
+vec3 aces(vec3 x)
+{
+    return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);
+}
+
+// taps stay inside the covered corner, the rest of scene is stale
+vec3 tap(vec2 uv)
+{
+    return texture(scene, min(uv, uvScale - 0.5 * texelSize)).rgb;
+}
+
+// contrast adaptive: the cross around the pixel is subtracted harder where its tone mapped range leaves room
+vec3 sharpen(vec2 uv, vec3 c)
+{
+    vec3 n = tap(uv + vec2(0.0, texelSize.y));
+    vec3 s = tap(uv - vec2(0.0, texelSize.y));
+    vec3 e = tap(uv + vec2(texelSize.x, 0.0));
+    vec3 w = tap(uv - vec2(texelSize.x, 0.0));
+    vec3 tc = aces(c * exposure), tn = aces(n * exposure), ts = aces(s * exposure);
+    vec3 te = aces(e * exposure), tw = aces(w * exposure);
+    vec3 lo = min(tc, min(min(tn, ts), min(te, tw)));
+    vec3 hi = max(tc, max(max(tn, ts), max(te, tw)));
+    vec3 amount = sqrt(clamp(min(lo, 1.0 - hi) / max(hi, 1e-4), 0.0, 1.0));
+    vec3 lobe = -amount * mix(0.125, 0.2, sharpness);
+    return max((c + lobe * (n + s + e + w)) / (1.0 + 4.0 * lobe), 0.0);
+}
+
+void main()
+{
+    // bilinear, the scene may be drawn smaller than the window
+    vec2 uv = TexCoord * uvScale;
+    vec3 hdr = tap(uv);
+    if(sharpness > 0.0)
+        hdr = sharpen(uv, hdr);
+    if(bloomIntensity > 0.0) {
+        vec2 bloomMax = bloomUvScale - 0.5 / vec2(textureSize(bloom, 0));
+        hdr += textureLod(bloom, min(TexCoord * bloomUvScale, bloomMax), 0.0).rgb * bloomIntensity;
+    }
+    FragColor = vec4(pow(aces(hdr * exposure), vec3(1.0 / 2.2)), 1.0);
+}
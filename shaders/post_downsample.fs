@@ -0,0 +1,43 @@
+#version 330 core
+
+// base and max level are set to the level read, the HDR target for the first pass
+uniform sampler2D source;
+uniform vec2 texelSize;   // of source
+uniform vec2 uvScale;     // the corner of source the last pass covered
+uniform bool prefilter;
+uniform vec3 threshold;   // threshold, threshold - knee, 0.25 / knee
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+// quadratic ramp into the threshold so bloom doesn't pop on and off
+vec3 bright(vec3 c)
+{
+    float brightness = max(c.r, max(c.g, c.b));
+    float knee = threshold.x - threshold.y;
+    float soft = clamp(brightness - threshold.y, 0.0, 2.0 * knee);
+    soft = soft * soft * threshold.z;
+    return c * max(soft, brightness - threshold.x) / max(brightness, 1e-4);
+}
+
+// taps stay inside the covered corner, the rest of source is stale
+vec3 tap(vec2 uv)
+{
+    return textureLod(source, min(uv, uvScale - 0.5 * texelSize), 0.0).rgb;
+}
+
+void main()
+{
+    // the centre and four diagonals, each a bilinear tap over 2x2 texels
+    vec2 d = texelSize;
+    vec2 uv = TexCoord * uvScale;
+    vec3 c = tap(uv) * 4.0;
+    c += tap(uv + vec2(-d.x, -d.y));
+    c += tap(uv + vec2( d.x, -d.y));
+    c += tap(uv + vec2(-d.x,  d.y));
+    c += tap(uv + vec2( d.x,  d.y));
+    c *= 0.125;
+    if(prefilter)
+        c = bright(c);
+    FragColor = vec4(c, 1.0);
+}
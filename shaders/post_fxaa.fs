@@ -0,0 +1,106 @@
+#version 330 core
+
+// after Lottes' FXAA 3.11, quality preset 12 steps; image is tone mapped and gamma encoded
+uniform sampler2D image;
+uniform vec2 texelSize;
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+#define EDGE_THRESHOLD_MIN 0.0312
+#define EDGE_THRESHOLD_MAX 0.125
+#define SUBPIXEL_QUALITY 0.75
+#define STEPS 12
+
+const float step_size[STEPS] = float[](1.0, 1.0, 1.0, 1.0, 1.0, 1.5, 2.0, 2.0, 2.0, 2.0, 4.0, 8.0);
+
+float luma(vec2 uv)
+{
+    return dot(textureLod(image, uv, 0.0).rgb, vec3(0.299, 0.587, 0.114));
+}
+
+void main()
+{
+    vec2 uv = TexCoord;
+    vec3 color = textureLod(image, uv, 0.0).rgb;
+    float m = dot(color, vec3(0.299, 0.587, 0.114));
+    float n = luma(uv + vec2(0.0, texelSize.y)), s = luma(uv - vec2(0.0, texelSize.y));
+    float e = luma(uv + vec2(texelSize.x, 0.0)), w = luma(uv - vec2(texelSize.x, 0.0));
+    float lo = min(m, min(min(n, s), min(e, w)));
+    float hi = max(m, max(max(n, s), max(e, w)));
+    float range = hi - lo;
+    if(range < max(EDGE_THRESHOLD_MIN, hi * EDGE_THRESHOLD_MAX)) {
+        FragColor = vec4(color, 1.0);
+        return;
+    }
+
+    float ne = luma(uv + texelSize), sw = luma(uv - texelSize);
+    float nw = luma(uv + vec2(-texelSize.x, texelSize.y)), se = luma(uv + vec2(texelSize.x, -texelSize.y));
+
+    // which way the edge runs
+    float horizontal = abs(-2.0 * w + nw + sw) + abs(-2.0 * m + n + s) * 2.0 + abs(-2.0 * e + ne + se);
+    float vertical = abs(-2.0 * n + nw + ne) + abs(-2.0 * m + w + e) * 2.0 + abs(-2.0 * s + sw + se);
+    bool is_horizontal = horizontal >= vertical;
+
+    // and which side of the pixel it is on
+    float l1 = is_horizontal ? s : w, l2 = is_horizontal ? n : e;
+    float g1 = l1 - m, g2 = l2 - m;
+    bool steepest_first = abs(g1) >= abs(g2);
+    float gradient = 0.25 * max(abs(g1), abs(g2));
+    float step_length = is_horizontal ? texelSize.y : texelSize.x;
+    float local_average;
+    if(steepest_first) {
+        step_length = -step_length;
+        local_average = 0.5 * (l1 + m);
+    } else {
+        local_average = 0.5 * (l2 + m);
+    }
+    vec2 edge_uv = uv;
+    if(is_horizontal)
+        edge_uv.y += step_length * 0.5;
+    else
+        edge_uv.x += step_length * 0.5;
+
+    // walk both ways along the edge until its contrast changes
+    vec2 offset = is_horizontal ? vec2(texelSize.x, 0.0) : vec2(0.0, texelSize.y);
+    vec2 uv1 = edge_uv - offset, uv2 = edge_uv + offset;
+    float end1 = luma(uv1) - local_average, end2 = luma(uv2) - local_average;
+    bool done1 = abs(end1) >= gradient, done2 = abs(end2) >= gradient;
+    for(int i = 1; i < STEPS && !(done1 && done2); i++) {
+        if(!done1) {
+            uv1 -= offset * step_size[i];
+            end1 = luma(uv1) - local_average;
+            done1 = abs(end1) >= gradient;
+        }
+        if(!done2) {
+            uv2 += offset * step_size[i];
+            end2 = luma(uv2) - local_average;
+            done2 = abs(end2) >= gradient;
+        }
+    }
+
+    float distance1 = is_horizontal ? uv.x - uv1.x : uv.y - uv1.y;
+    float distance2 = is_horizontal ? uv2.x - uv.x : uv2.y - uv.y;
+    bool nearer1 = distance1 < distance2;
+    float nearest = min(distance1, distance2);
+    float edge_length = distance1 + distance2;
+    float pixel_offset = -nearest / edge_length + 0.5;
+
+    // no blend when the nearer end doesn't turn the way the centre does
+    bool centre_smaller = m < local_average;
+    bool correct = ((nearer1 ? end1 : end2) < 0.0) != centre_smaller;
+    float final_offset = correct ? pixel_offset : 0.0;
+
+    // and at least as much as the 3x3 average asks for, for detail smaller than a pixel
+    float average = (1.0 / 12.0) * (2.0 * (n + s + e + w) + ne + nw + se + sw);
+    float subpixel = clamp(abs(average - m) / range, 0.0, 1.0);
+    subpixel = (-2.0 * subpixel + 3.0) * subpixel * subpixel;
+    final_offset = max(final_offset, subpixel * subpixel * SUBPIXEL_QUALITY);
+
+    vec2 final_uv = uv;
+    if(is_horizontal)
+        final_uv.y += final_offset * step_length;
+    else
+        final_uv.x += final_offset * step_length;
+    FragColor = vec4(textureLod(image, final_uv, 0.0).rgb, 1.0);
+}
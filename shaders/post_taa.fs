@@ -0,0 +1,49 @@
+#version 330 core
+
+uniform sampler2D current;
+uniform sampler2D history;
+uniform sampler2D depth;
+uniform mat4 reprojection;   // last frame's view projection times the inverse of this one's, both unjittered
+uniform vec2 jitter;         // this frame's, in UV
+uniform ivec2 viewSize;      // the corner of current this frame covered
+uniform vec2 historyUvScale; // and of history, last frame's
+uniform float feedback;      // weight of this frame, 1 drops the history
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+float luma(vec3 c)
+{
+    return dot(c, vec3(0.2126, 0.7152, 0.0722));
+}
+
+void main()
+{
+    ivec2 p = ivec2(gl_FragCoord.xy);
+    ivec2 last = viewSize - 1;
+    vec3 c = texelFetch(current, p, 0).rgb;
+
+    // the history is only trusted inside what the new frame shows around the pixel
+    vec3 lo = c, hi = c;
+    for(int y = -1; y <= 1; y++) {
+        for(int x = -1; x <= 1; x++) {
+            vec3 n = texelFetch(current, clamp(p + ivec2(x, y), ivec2(0), last), 0).rgb;
+            lo = min(lo, n);
+            hi = max(hi, n);
+        }
+    }
+
+    float d = texelFetch(depth, p, 0).r;
+    vec4 previous = reprojection * vec4((TexCoord - jitter) * 2.0 - 1.0, d * 2.0 - 1.0, 1.0);
+    vec2 uv = previous.xy / previous.w * 0.5 + 0.5;
+    float w = feedback;
+    if(any(lessThan(uv, vec2(0.0))) || any(greaterThan(uv, vec2(1.0))))
+        w = 1.0;
+    // last frame may have been drawn at another scale
+    vec2 historyMax = historyUvScale - 0.5 / vec2(textureSize(history, 0));
+    vec3 h = clamp(texture(history, min(uv * historyUvScale, historyMax)).rgb, lo, hi);
+
+    // weighed as if tone mapped, a bright sample would flicker through the blend otherwise
+    float wc = w / (1.0 + luma(c)), wh = (1.0 - w) / (1.0 + luma(h));
+    FragColor = vec4((c * wc + h * wh) / max(wc + wh, 1e-5), 1.0);
+}
@@ -0,0 +1,25 @@
+#version 330 core
+
+// base and max level are set to the smaller level read, the result is added onto the one above
+uniform sampler2D source;
+uniform vec2 texelSize;   // of source
+uniform vec2 uvScale;     // the corner of source the last pass covered
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+vec3 tap(vec2 uv)
+{
+    return textureLod(source, min(uv, uvScale - 0.5 * texelSize), 0.0).rgb;
+}
+
+void main()
+{
+    // 3x3 tent
+    vec2 d = texelSize;
+    vec2 uv = TexCoord * uvScale;
+    vec3 c = tap(uv) * 4.0;
+    c += (tap(uv + vec2(-d.x, 0.0)) + tap(uv + vec2(d.x, 0.0)) + tap(uv + vec2(0.0, -d.y)) + tap(uv + vec2(0.0, d.y))) * 2.0;
+    c += tap(uv + vec2(-d.x, -d.y)) + tap(uv + vec2(d.x, -d.y)) + tap(uv + vec2(-d.x, d.y)) + tap(uv + vec2(d.x, d.y));
+    FragColor = vec4(c * (1.0 / 16.0), 1.0);
+}
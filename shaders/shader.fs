@@ -1,33 +1,96 @@
 #version 330 core
+#define MAX_LIGHTS 16
 out vec4 FragColor;
 
 in vec3 Normal;  
 in vec3 FragPos;  
+in float ViewDepth;
   
-uniform vec3 lightPos; 
+// a light with radius 0 is directional, lightPos is then the direction towards it
+uniform int lightCount;
+uniform vec3 lightPos[MAX_LIGHTS]; 
+uniform vec3 lightColor[MAX_LIGHTS];
+uniform float lightRadius[MAX_LIGHTS];
 uniform vec3 viewPos; 
-uniform vec3 lightColor;
-uniform vec3 objectColor;
+
+// two texels a material, see material.h
+uniform samplerBuffer materials;
+uniform int materialIndex;
+
+// shadowLight < 0 disables shadows
+uniform int shadowLight;
+
+// image based ambient and reflections, a constant ambient without
+uniform bool iblEnabled;
+uniform samplerCube irradianceMap;
+uniform samplerCube prefilteredMap;
+uniform float prefilteredMaxLod;   // roughness 1
+
+#include "shadow.glsl"
+
+/*
+ * GGX, Smith-Schlick visibility and Schlick's Fresnel over a Lambert
+ * diffuse. Light colors have the 1/PI of the diffuse folded in, a white
+ * diffuse surface facing a light reflects its color.
+ */
+vec3 brdf(vec3 n, vec3 v, vec3 l, vec3 albedo, vec3 f0, float roughness)
+{
+    vec3 h = normalize(v + l);
+    float nDotV = max(dot(n, v), 1e-4);
+    float nDotL = max(dot(n, l), 0.0);
+    float nDotH = max(dot(n, h), 0.0);
+    float a2 = roughness * roughness * roughness * roughness;
+    float d = nDotH * nDotH * (a2 - 1.0) + 1.0;
+    float k = (roughness + 1.0) * (roughness + 1.0) / 8.0;
+    float vis = 0.25 / ((nDotV * (1.0 - k) + k) * (nDotL * (1.0 - k) + k));
+    vec3 fresnel = f0 + (1.0 - f0) * pow(1.0 - max(dot(v, h), 0.0), 5.0);
+    return ((1.0 - fresnel) * albedo + fresnel * (a2 / (d * d) * vis)) * nDotL;
+}
+
+// the split sum's second factor, fitted instead of a lookup texture
+vec3 env_brdf(vec3 f0, float roughness, float nDotV)
+{
+    vec4 r = roughness * vec4(-1.0, -0.0275, -0.572, 0.022) + vec4(1.0, 0.0425, 1.04, -0.04);
+    float a004 = min(r.x * r.x, exp2(-9.28 * nDotV)) * r.x + r.y;
+    vec2 ab = vec2(-1.04, 1.04) * a004 + r.zw;
+    return f0 * ab.x + ab.y;
+}
 
 void main()
 {
-    // ambient
-    float ambientStrength = 0.2;
-    vec3 ambient = ambientStrength * lightColor;
-  	
-    // diffuse 
+    vec4 baseMetallic = texelFetch(materials, materialIndex * 2);
+    vec4 roughnessReflectance = texelFetch(materials, materialIndex * 2 + 1);
+    float roughness = clamp(roughnessReflectance.x, 0.04, 1.0);
+    vec3 albedo = baseMetallic.rgb * (1.0 - baseMetallic.a);
+    vec3 f0 = mix(vec3(0.16 * roughnessReflectance.y * roughnessReflectance.y), baseMetallic.rgb, baseMetallic.a);
+
     vec3 norm = normalize(Normal);
-    vec3 lightDir = normalize(lightPos - FragPos);
-    float diff = max(dot(norm, lightDir), 0.0);
-    vec3 diffuse = diff * lightColor;
-    
-    // specular
-    float specularStrength = 1.0;
     vec3 viewDir = normalize(viewPos - FragPos);
-    vec3 reflectDir = reflect(-lightDir, norm);  
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
-    vec3 specular = specularStrength * spec * lightColor;  
+    vec3 lighting = vec3(0.0);
+
+    // ambient, a flat environment without IBL
+    vec3 irradiance = vec3(0.2), reflection = vec3(0.2);
+    if(iblEnabled) {
+        vec3 reflected = reflect(-viewDir, norm);
+        irradiance = texture(irradianceMap, norm).rgb;
+        reflection = textureLod(prefilteredMap, reflected, roughness * prefilteredMaxLod).rgb;
+    }
+    vec3 ambient = irradiance * albedo + reflection * env_brdf(f0, roughness, max(dot(norm, viewDir), 0.0));
+
+    for(int i = 0; i < lightCount; i++) {
+        bool directional = lightRadius[i] <= 0.0;
+
+        vec3 toLight = directional ? lightPos[i] : lightPos[i] - FragPos;
+        float dist = length(toLight);
+        vec3 lightDir = toLight / dist;
+        float diff = max(dot(norm, lightDir), 0.0);
+
+        float attenuation = directional ? 1.0 : clamp(1.0 - dist / lightRadius[i], 0.0, 1.0);
+        attenuation *= attenuation;
+        if(i == shadowLight && diff > 0.0)
+            attenuation *= shadow_factor(FragPos, ViewDepth, diff);
+        lighting += brdf(norm, viewDir, lightDir, albedo, f0, roughness) * lightColor[i] * attenuation;
+    }
         
-    vec3 result = (ambient + diffuse + specular) * objectColor;
-    FragColor = vec4(result, 1.0);
+    FragColor = vec4(ambient + lighting, 1.0);
 } 
@@ -1,18 +1,38 @@
 #version 330 core
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
+layout (location = 0) in vec4 aPos;
+layout (location = 1) in vec4 aNormal;
 
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
+// per mesh dequantization, see vertex_format.h
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+uniform int normalEncoding;
+
+vec3 decode_normal()
+{
+    if(normalEncoding == 0)
+        return aNormal.xyz;
+    vec3 n = vec3(aNormal.xy, 1.0 - abs(aNormal.x) - abs(aNormal.y));
+    if(n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
+invariant gl_Position;
+
 out vec3 Normal;
 out vec3 FragPos;
+out float ViewDepth;
 
 void main()
 {
-	gl_Position = projection * view * model * vec4(aPos, 1.0);
-    FragPos = vec3(model * vec4(aPos, 1.0));
+    vec3 position = positionOffset + aPos.xyz * positionScale;
+	gl_Position = projection * view * model * vec4(position, 1.0);
+    FragPos = vec3(model * vec4(position, 1.0));
+    ViewDepth = -(view * vec4(FragPos, 1.0)).z;
     /*
        Inversing matrices is a costly operation for shaders, 
        so wherever possible try to avoid doing inverse operations
@@ -22,5 +42,5 @@ void main()
        the normal matrix on the CPU and send it to the shaders via
        a uniform before drawing (just like the model matrix).  
     */ 
-    Normal = mat3(transpose(inverse(model))) * aNormal;  
+    Normal = mat3(transpose(inverse(model))) * decode_normal();  
 }
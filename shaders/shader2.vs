@@ -1,11 +1,16 @@
 #version 330 core
-layout (location = 0) in vec3 aPos;
+layout (location = 0) in vec4 aPos;
 
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
+// per mesh dequantization, see vertex_format.h
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+
 void main()
 {
-	gl_Position = projection * view * model * vec4(aPos, 1.0);
+    vec3 position = positionOffset + aPos.xyz * positionScale;
+	gl_Position = projection * view * model * vec4(position, 1.0);
 }
@@ -0,0 +1,36 @@
+// shared by the forward and deferred lighting shaders, spliced in by get_shader_program
+#define MAX_CASCADES 4
+
+uniform sampler2DArrayShadow shadowMap;
+uniform mat4 lightMatrix[MAX_CASCADES];
+uniform float cascadeSplits[MAX_CASCADES];
+uniform int cascadeCount;
+uniform int pcfRadius;
+
+float shadow_factor(vec3 worldPos, float viewDepth, float nDotL)
+{
+    int cascade = 0;
+    while(cascade < cascadeCount - 1 && viewDepth > cascadeSplits[cascade])
+        cascade++;
+
+    // behind a point light's projection the divide flips the point into the map, it is outside the frustum
+    vec4 lightSpace = lightMatrix[cascade] * vec4(worldPos, 1.0);
+    if(lightSpace.w <= 0.0)
+        return 1.0;
+    vec3 coords = lightSpace.xyz / lightSpace.w * 0.5 + 0.5;
+    if(coords.z > 1.0 || any(lessThan(coords.xy, vec2(0.0))) || any(greaterThan(coords.xy, vec2(1.0))))
+        return 1.0;
+
+    // slope scaled, grazing surfaces need the most
+    float bias = clamp(0.0005 * sqrt(1.0 - nDotL * nDotL) / nDotL, 0.0001, 0.005);
+    vec2 texel = 1.0 / vec2(textureSize(shadowMap, 0).xy);
+    float lit = 0.0;
+    for(int y = -pcfRadius; y <= pcfRadius; y++) {
+        for(int x = -pcfRadius; x <= pcfRadius; x++) {
+            vec2 uv = coords.xy + vec2(x, y) * texel;
+            lit += texture(shadowMap, vec4(uv, cascade, coords.z - bias));
+        }
+    }
+    float taps = float((2 * pcfRadius + 1) * (2 * pcfRadius + 1));
+    return lit / taps;
+}
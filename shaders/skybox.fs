@@ -0,0 +1,14 @@
+#version 330 core
+
+uniform samplerCube environment;
+uniform mat4 inverseViewProjection;   // of the camera's rotation alone
+
+in vec2 Position;
+out vec4 FragColor;
+
+void main()
+{
+    // per pixel, the direction doesn't interpolate linearly across the screen
+    vec4 world = inverseViewProjection * vec4(Position, 1.0, 1.0);
+    FragColor = vec4(textureLod(environment, world.xyz / world.w, 0.0).rgb, 1.0);
+}
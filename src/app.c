@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "app.h"
+#include "glad_lazy.h"
+#include "gpu_timer.h"
+#include "startup.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define APP_DEGREES 0.01745329f     /* radians in a degree */
+#define APP_WALK_SPEED 2.5f         /* units per second */
+
+/* A 3.3 core window, NULL when there is no display or no such context. */
+GLFWwindow *
+app_create_window(const char *title, int width, int height)
+{
+    double begin = startup_now();
+    if(!glfwInit()) {
+        fprintf(stderr, "Couldn't initialize GLFW\n");
+        return NULL;
+    }
+    startup_end(startup_begin("glfwInit"), begin);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    GLFWwindow *window;
+    STARTUP_PHASE("window and context", window = glfwCreateWindow(width, height, title, 0, 0));
+    if(!window) {
+        fprintf(stderr, "Couldn't create window\n");
+        glfwTerminate();
+    }
+    return window;
+}
+
+/* Makes the context current on the calling thread, the one that will draw. See glad_lazy.h for lazy. */
+void
+app_load_gl(GLFWwindow *window, bool lazy)
+{
+    STARTUP_PHASE("make current", glfwMakeContextCurrent(window));
+    GLADloadproc load = (GLADloadproc)glfwGetProcAddress;
+    int loaded;
+    STARTUP_PHASE("glad", loaded = lazy ? gladLoadGLLazy(load) : gladLoadGLLoader(load));
+    if(!loaded) {
+        ERROR_EXIT(1, "Failed to initialize GLAD\n");
+    }
+}
+
+/* ESC closes the window, Q recentres the mouse look. WASD come back as -1..1 axes. */
+void
+app_poll_keys(GLFWwindow *window, MouseLook *m, float *forward, float *right)
+{
+    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, true);
+    if(glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
+        m->first = true;
+
+    *forward = 0.0f;
+    *right = 0.0f;
+    if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+        *forward += 1.0f;
+    if(glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+        *forward -= 1.0f;
+    if(glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+        *right -= 1.0f;
+    if(glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+        *right += 1.0f;
+}
+
+void
+mouse_look_move(MouseLook *m, Camera *c, double x, double y)
+{
+    if(m->first) {
+        m->last_x = (float)x;
+        m->last_y = (float)y;
+        m->first = false;
+    }
+    float x_offset = (float)x - m->last_x;
+    float y_offset = m->last_y - (float)y;
+    m->last_x = (float)x;
+    m->last_y = (float)y;
+
+    float scale = m->sensitivity * APP_DEGREES;
+    camera_rotate(c, x_offset * scale, y_offset * scale);
+}
+
+/* Scroll wheel zoom, between 1 and 45 degrees of vertical field of view. */
+void
+mouse_look_zoom(Camera *c, double offset)
+{
+    float fov = c->fov + (float)offset * APP_DEGREES;
+    if(fov < 1.0f * APP_DEGREES)
+        fov = 1.0f * APP_DEGREES;
+    if(fov > 45.0f * APP_DEGREES)
+        fov = 45.0f * APP_DEGREES;
+    camera_set_lens(c, fov, c->aspect, c->near, c->far);
+}
+
+static void
+app_framebuffer_size(GLFWwindow *window, int width, int height)
+{
+    App *app = glfwGetWindowUserPointer(window);
+    app->width = width;
+    app->height = height;
+    glViewport(0, 0, width, height);
+    if(height > 0)
+        camera_set_lens(&app->camera, app->camera.fov, (float)width / (float)height, app->camera.near, app->camera.far);
+}
+
+static void
+app_cursor_pos(GLFWwindow *window, double x, double y)
+{
+    App *app = glfwGetWindowUserPointer(window);
+    mouse_look_move(&app->mouse, &app->camera, x, y);
+}
+
+static void
+app_scroll(GLFWwindow *window, double x_offset, double y_offset)
+{
+    (void)x_offset;
+    App *app = glfwGetWindowUserPointer(window);
+    mouse_look_zoom(&app->camera, y_offset);
+}
+
+/* Along the camera's front and right, kept on the ground plane. */
+static void
+app_walk(App *app, float forward, float right)
+{
+    if(forward == 0.0f && right == 0.0f)
+        return;
+    Camera *c = &app->camera;
+    float step = APP_WALK_SPEED * app->delta;
+    for(int i = 0; i < 3; i++)
+        c->position[i] += (c->front[i] * forward + c->right[i] * right) * step;
+    c->position[1] = 0.0f;
+}
+
+int
+app_run(const Scene *scene, int argc, char **argv)
+{
+    startup_init();
+    bool loose = false, lazy = false;
+    long frame_limit = 0;
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "--loose"))
+            loose = true;
+        else if(!strcmp(argv[i], "--lazy-gl"))
+            lazy = true;
+        else if(!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frame_limit = atol(argv[++i]);
+    }
+
+    static App app;
+    app.width = 800;
+    app.height = 600;
+    app.mouse = (MouseLook)MOUSE_LOOK_DEFAULT;
+    STARTUP_PHASE("assets", assets_init(&app.assets, loose));
+    app.window = app_create_window(scene->name, app.width, app.height);
+    if(!app.window)
+        return -1;
+    app_load_gl(app.window, lazy);
+    glfwSetWindowUserPointer(app.window, &app);
+    glfwSetFramebufferSizeCallback(app.window, app_framebuffer_size);
+    if(scene->walk) {
+        glfwSetCursorPosCallback(app.window, app_cursor_pos);
+        glfwSetScrollCallback(app.window, app_scroll);
+        glfwSetInputMode(app.window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    }
+
+    vec3 origin = { 0.0f, 0.0f, 0.0f };
+    camera_init(&app.camera, origin, -90.0f * APP_DEGREES, 0.0f, 45.0f * APP_DEGREES,
+                (float)app.width / (float)app.height, 0.01f, 100.0f);
+    arena_init(&app.arena, scene->name, 64 << 20);
+
+    double start = glfwGetTime();
+    STARTUP_PHASE("scene", scene->init(&app));
+    fprintf(stdout, "%s ready in %.3f ms, %u asset files (%.1f KB) read in %.3f ms from %s\n", scene->name,
+            (glfwGetTime() - start) * 1000.0, app.assets.reads, app.assets.bytes / 1024.0, app.assets.read_ms,
+            app.assets.packed ? ASSETS_PACK_NAME : "loose files");
+
+    GpuTimer timer;
+    gpu_timer_init(&timer);
+    double last = glfwGetTime(), run_start = last, last_report = last;
+    double cpu_ms = 0.0, run_cpu_ms = 0.0, run_gpu_ms = 0.0;
+    long frames = 0, run_frames = 0, run_gpu_samples = 0;
+
+    while(!glfwWindowShouldClose(app.window)) {
+        double now = glfwGetTime();
+        app.delta = (float)(now - last);
+        app.time = (float)now;
+        last = now;
+
+        float forward, right;
+        app_poll_keys(app.window, &app.mouse, &forward, &right);
+        if(scene->walk)
+            app_walk(&app, forward, right);
+        camera_update(&app.camera);
+
+        gpu_timer_begin(&timer);
+        scene->draw(&app);
+        gpu_timer_end(&timer);
+        cpu_ms += (glfwGetTime() - now) * 1000.0;
+        glfwSwapBuffers(app.window);
+        glfwPollEvents();
+        if(!frames && !run_frames) {
+            startup_first_frame(stdout);
+            if(lazy)
+                fprintf(stdout, "  %u GL entry points resolved lazily\n", glad_lazy_resolved);
+        }
+        frames++;
+
+        bool done = frame_limit && run_frames + frames >= frame_limit;
+        if(glfwGetTime() - last_report >= 1.0 || done) {
+            double elapsed = glfwGetTime() - last_report;
+            fprintf(stdout, "%s: %.1f frames/s, cpu %.3f ms, gpu %.3f ms per frame\n", scene->name,
+                    frames / elapsed, cpu_ms / frames, gpu_timer_average(&timer));
+            run_frames += frames;
+            run_cpu_ms += cpu_ms;
+            run_gpu_ms += timer.total_ms;
+            run_gpu_samples += timer.samples;
+            frames = 0;
+            cpu_ms = 0.0;
+            gpu_timer_reset(&timer);
+            last_report = glfwGetTime();
+        }
+        if(done)
+            break;
+    }
+
+    if(frame_limit && run_frames) {
+        double elapsed = glfwGetTime() - run_start;
+        fprintf(stdout, "%-24s %6ld frames %9.3f ms/frame  cpu %7.3f ms  gpu %7.3f ms\n", scene->name, run_frames,
+                elapsed * 1000.0 / run_frames, run_cpu_ms / run_frames,
+                run_gpu_samples ? run_gpu_ms / run_gpu_samples : 0.0);
+    }
+
+    gpu_timer_destroy(&timer);
+    arena_destroy(&app.arena);
+    assets_destroy(&app.assets);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,58 @@
+#ifndef __APP__H__
+#define __APP__H__
+
+#include <glad/glad.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include "untitled_types.h"
+#include "assets.h"
+#include "camera.h"
+#include "memory.h"
+
+/*
+ * The window, input and frame loop every program in the repository used
+ * to carry its own copy of. The engine takes the window, the mouse look
+ * and the key sampling and runs its own loop across two threads; the
+ * demos in prosli/ are only a Scene, an init that loads through the
+ * assets and a draw, and app_run does the rest.
+ *
+ * app_run times each frame, CPU time to record it and GPU time between
+ * timestamp queries, and prints both once a second. With --frames N it
+ * stops after N frames and prints the averages of the whole run, so the
+ * demos can be compared side by side (make bench-demos).
+ */
+
+typedef struct {
+    float last_x, last_y;
+    float sensitivity;          /* degrees per pixel */
+    bool first;                 /* the next event only records the position */
+} MouseLook;
+
+#define MOUSE_LOOK_DEFAULT { 400.0f, 300.0f, 0.1f, true }
+
+typedef struct {
+    GLFWwindow *window;
+    Assets assets;
+    Arena arena;                /* lives as long as the scene, scratch while loading */
+    Camera camera;              /* updated before every draw */
+    MouseLook mouse;
+    int width, height;
+    float time, delta;          /* seconds */
+} App;
+
+typedef struct {
+    const char *name;
+    bool walk;                  /* mouse look and WASD on the ground plane, otherwise only ESC */
+    void (*init)(App *app);
+    void (*draw)(App *app);
+} Scene;
+
+GLFWwindow *app_create_window(const char *title, int width, int height);
+void app_load_gl(GLFWwindow *window, bool lazy);
+void app_poll_keys(GLFWwindow *window, MouseLook *m, float *forward, float *right);
+void mouse_look_move(MouseLook *m, Camera *c, double x, double y);
+void mouse_look_zoom(Camera *c, double offset);
+int app_run(const Scene *scene, int argc, char **argv);
+
+#endif
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "assets.h"
+#include "timing.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+void
+assets_init(Assets *a, bool loose)
+{
+    double start = now_ms();
+    memset(a, 0, sizeof(*a));
+
+    // falls back to the working directory when /proc isn't there
+    ssize_t length = readlink("/proc/self/exe", a->root, sizeof(a->root) - 1);
+    if(length > 0) {
+        a->root[length] = '\0';
+        char *slash = strrchr(a->root, '/');
+        slash[1] = '\0';
+    } else {
+        a->root[0] = '\0';
+    }
+
+    if(!loose) {
+        char path[sizeof(a->root) + sizeof(ASSETS_PACK_NAME)];
+        snprintf(path, sizeof(path), "%s%s", a->root, ASSETS_PACK_NAME);
+        a->packed = pack_open(&a->pack, path);
+    }
+    a->open_ms = now_ms() - start;
+}
+
+/* Contents of an asset, NUL terminated. Packed and stored it points into the mapping, otherwise into the arena. */
+const char *
+assets_read(Assets *a, const char *name, Arena *arena, size_t *size)
+{
+    double start = now_ms();
+    const char *data;
+    size_t length;
+    const PackEntry *e;
+    if(a->packed && (e = pack_lookup(&a->pack, name))) {
+        PackView v = pack_view(&a->pack, e, arena);
+        data = (const char *)v.data;
+        length = v.size;
+    } else {
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%s%s", a->root, name);
+        FILE *file = fopen(path, "rb");
+        if(!file) {
+            ERROR_EXIT(1, "Couldn't open file %s\n", path);
+        }
+        fseek(file, 0, SEEK_END);
+        length = (size_t)ftell(file);
+        fseek(file, 0, SEEK_SET);
+        char *buffer = arena_push(arena, length + 1, 16);
+        if(fread(buffer, 1, length, file) != length) {
+            ERROR_EXIT(1, "Couldn't read file %s\n", path);
+        }
+        buffer[length] = '\0';
+        fclose(file);
+        data = buffer;
+    }
+    if(size)
+        *size = length;
+    a->reads++;
+    a->bytes += length;
+    a->read_ms += now_ms() - start;
+    return data;
+}
+
+void
+assets_destroy(Assets *a)
+{
+    if(a->packed)
+        pack_close(&a->pack);
+    a->packed = false;
+}
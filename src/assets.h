@@ -0,0 +1,33 @@
+#ifndef __ASSETS__H__
+#define __ASSETS__H__
+
+#include <limits.h>
+
+#include "untitled_types.h"
+#include "memory.h"
+#include "pack.h"
+
+/*
+ * Where shaders and textures come from. assets_init looks for
+ * assets.pak next to the executable and maps it; without one (or with
+ * loose set) files are read one by one, from paths relative to the
+ * executable rather than the working directory.
+ */
+
+#define ASSETS_PACK_NAME "assets.pak"
+
+typedef struct {
+    Pack pack;
+    bool packed;
+    char root[PATH_MAX];        /* directory of the executable, with the trailing slash */
+    u32 reads;
+    u64 bytes;
+    double read_ms;             /* spent in assets_read, lookups and decompression included */
+    double open_ms;
+} Assets;
+
+void assets_init(Assets *a, bool loose);
+const char *assets_read(Assets *a, const char *name, Arena *arena, size_t *size);
+void assets_destroy(Assets *a);
+
+#endif
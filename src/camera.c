@@ -0,0 +1,137 @@
+#include <math.h>
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "camera.h"
+
+void
+camera_init(Camera *c, vec3 position, float yaw, float pitch, float fov, float aspect, float near, float far)
+{
+    vec3_dup(c->position, position);
+    c->yaw = yaw;
+    c->pitch = pitch;
+    c->fov = fov;
+    c->aspect = aspect;
+    c->near = near;
+    c->far = far;
+    c->dirty = CAMERA_ORIENTATION_DIRTY | CAMERA_LENS_DIRTY;
+}
+
+/* Mouse look, the pitch stops short of straight up and down. */
+void
+camera_rotate(Camera *c, float yaw_delta, float pitch_delta)
+{
+    if(yaw_delta == 0.0f && pitch_delta == 0.0f)
+        return;
+    c->yaw += yaw_delta;
+    c->pitch += pitch_delta;
+    if(c->pitch > CAMERA_MAX_PITCH)
+        c->pitch = CAMERA_MAX_PITCH;
+    if(c->pitch < -CAMERA_MAX_PITCH)
+        c->pitch = -CAMERA_MAX_PITCH;
+    c->dirty |= CAMERA_ORIENTATION_DIRTY;
+}
+
+/* For cameras placed by the program, shadow and reflection views. The target must differ from the eye. */
+void
+camera_look_at(Camera *c, vec3 eye, vec3 target)
+{
+    vec3 forward;
+    vec3_sub(forward, target, eye);
+    vec3_norm(forward, forward);
+    vec3_dup(c->position, eye);
+    c->yaw = atan2f(forward[2], forward[0]);
+    c->pitch = asinf(forward[1]);
+    c->dirty |= CAMERA_ORIENTATION_DIRTY;
+}
+
+void
+camera_set_lens(Camera *c, float fov, float aspect, float near, float far)
+{
+    if(fov == c->fov && aspect == c->aspect && near == c->near && far == c->far)
+        return;
+    c->fov = fov;
+    c->aspect = aspect;
+    c->near = near;
+    c->far = far;
+    c->dirty |= CAMERA_LENS_DIRTY;
+}
+
+static void
+update_orientation(Camera *c)
+{
+    // yaw about the world up, then pitch about the camera's own right axis
+    const vec3 world_up = { 0.0f, 1.0f, 0.0f }, camera_right = { 1.0f, 0.0f, 0.0f };
+    quat yaw, pitch;
+    quat_rotate(yaw, -c->yaw - 1.57079632f, world_up);
+    quat_rotate(pitch, c->pitch, camera_right);
+    quat_mul(c->orientation, yaw, pitch);
+
+    // the columns of the rotation are the camera axes in world space
+    mat4x4 basis;
+    mat4x4_from_quat(basis, c->orientation);
+    vec3_dup(c->right, basis[0]);
+    vec3_dup(c->up, basis[1]);
+    vec3_scale(c->front, basis[2], -1.0f);
+}
+
+static void
+update_projection(Camera *c)
+{
+    mat4x4_perspective(c->projection, c->fov, c->aspect, c->near, c->far);
+}
+
+/*
+ * projection * view with the perspective matrix's zeros left out: row 0
+ * and 1 are scaled rows of the view, row 2 mixes in the translation and
+ * row 3 is the negated view row 2.
+ */
+static void
+fuse_view_projection(Camera *c)
+{
+    float p00 = c->projection[0][0], p11 = c->projection[1][1];
+    float p22 = c->projection[2][2], p32 = c->projection[3][2];
+#ifdef __SSE__
+    __m128 scale = _mm_setr_ps(p00, p11, p22, -1.0f);
+    __m128 offset = _mm_setr_ps(0.0f, 0.0f, p32, 0.0f);
+    for(int col = 0; col < 4; col++) {
+        __m128 v = _mm_loadu_ps(c->view[col]);
+        __m128 xyzz = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 1, 0));
+        __m128 wwww = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+        _mm_storeu_ps(c->view_projection[col], _mm_add_ps(_mm_mul_ps(xyzz, scale), _mm_mul_ps(wwww, offset)));
+    }
+#else
+    for(int col = 0; col < 4; col++) {
+        const float *v = c->view[col];
+        c->view_projection[col][0] = p00 * v[0];
+        c->view_projection[col][1] = p11 * v[1];
+        c->view_projection[col][2] = p22 * v[2] + p32 * v[3];
+        c->view_projection[col][3] = -v[2];
+    }
+#endif
+}
+
+/* Rebuilds whatever changed, then the view from the cached basis and the fused product. */
+void
+camera_update(Camera *c)
+{
+    if(c->dirty & CAMERA_ORIENTATION_DIRTY)
+        update_orientation(c);
+    if(c->dirty & CAMERA_LENS_DIRTY)
+        update_projection(c);
+    c->dirty = 0;
+
+    const float *r = c->right, *u = c->up, *f = c->front;
+    for(int i = 0; i < 3; i++) {
+        c->view[i][0] = r[i];
+        c->view[i][1] = u[i];
+        c->view[i][2] = -f[i];
+        c->view[i][3] = 0.0f;
+    }
+    c->view[3][0] = -vec3_mul_inner(r, c->position);
+    c->view[3][1] = -vec3_mul_inner(u, c->position);
+    c->view[3][2] = vec3_mul_inner(f, c->position);
+    c->view[3][3] = 1.0f;
+    fuse_view_projection(c);
+}
@@ -0,0 +1,44 @@
+#ifndef __CAMERA__H__
+#define __CAMERA__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+
+/*
+ * Perspective camera kept as a position and an orientation quaternion
+ * built from yaw and pitch. The basis vectors and the projection terms
+ * are cached and only rebuilt when camera_rotate, camera_look_at or
+ * camera_set_lens change them, so a frame where the mouse didn't move
+ * costs no trig at all. camera_update writes view, projection and
+ * view_projection in one go; the product skips the zeros of the
+ * projection instead of doing a full 4x4 multiply.
+ *
+ * Angles are in radians. Yaw 0 looks down +x, the default -pi/2 down -z.
+ */
+
+#define CAMERA_MAX_PITCH 1.55334f   /* 89 degrees, camera_rotate keeps away from the poles */
+
+enum { CAMERA_ORIENTATION_DIRTY = 1, CAMERA_LENS_DIRTY = 2 };
+
+typedef struct {
+    vec3 position;
+    float yaw, pitch;
+    float fov;                  /* vertical */
+    float aspect, near, far;
+
+    quat orientation;           /* camera space, looking down -z, to world space */
+    vec3 front, up, right;      /* cached from the orientation */
+    mat4x4 view;
+    mat4x4 projection;
+    mat4x4 view_projection;
+    u8 dirty;
+} Camera;
+
+void camera_init(Camera *c, vec3 position, float yaw, float pitch, float fov, float aspect, float near, float far);
+void camera_rotate(Camera *c, float yaw_delta, float pitch_delta);
+void camera_look_at(Camera *c, vec3 eye, vec3 target);
+void camera_set_lens(Camera *c, float fov, float aspect, float near, float far);
+void camera_update(Camera *c);
+
+#endif
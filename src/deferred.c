@@ -0,0 +1,241 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "deferred.h"
+#include "shadow.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+static void
+deferred_create_targets(Deferred *d)
+{
+    glGenFramebuffers(1, &d->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, d->fbo);
+
+    unsigned int *textures[] = { &d->material_tex, &d->normal_tex, &d->depth_tex };
+    GLenum internal_format[] = { GL_R16UI, GL_RG16, GL_DEPTH24_STENCIL8 };
+    GLenum format[]   = { GL_RED_INTEGER, GL_RG, GL_DEPTH_STENCIL };
+    GLenum type[]     = { GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT_24_8 };
+    GLenum attach[]   = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_DEPTH_STENCIL_ATTACHMENT };
+
+    for(int i = 0; i < 3; i++) {
+        glGenTextures(1, textures[i]);
+        glBindTexture(GL_TEXTURE_2D, *textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, internal_format[i], d->width, d->height, 0, format[i], type[i], NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attach[i], GL_TEXTURE_2D, *textures[i], 0);
+    }
+
+    GLenum draw_buffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, draw_buffers);
+
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        ERROR_EXIT(1, "G-buffer framebuffer is not complete\n");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void
+deferred_destroy_targets(Deferred *d)
+{
+    unsigned int textures[] = { d->material_tex, d->normal_tex, d->depth_tex };
+    glDeleteTextures(3, textures);
+    glDeleteFramebuffers(1, &d->fbo);
+}
+
+void
+deferred_init(Deferred *d, unsigned int geometry_program, unsigned int light_program, int width, int height)
+{
+    d->geometry_program = geometry_program;
+    d->light_program = light_program;
+    d->width = width;
+    d->height = height;
+    d->view_width = width;
+    d->view_height = height;
+    d->shadow_light = -1;
+    d->output_fbo = 0;
+
+    /* the light pass draws a single full screen triangle from gl_VertexID */
+    glGenVertexArrays(1, &d->empty_vao);
+
+    deferred_create_targets(d);
+
+    glUseProgram(light_program);
+    glUniform1i(glGetUniformLocation(light_program, "gMaterial"), 0);
+    glUniform1i(glGetUniformLocation(light_program, "gNormal"), 1);
+    glUniform1i(glGetUniformLocation(light_program, "gDepth"), 2);
+    glUniform1i(glGetUniformLocation(light_program, "shadowMap"), SHADOW_TEXTURE_UNIT);
+}
+
+/* The targets are only recreated when width or height change, a smaller view draws into their corner. */
+void
+deferred_resize(Deferred *d, int width, int height, int view_width, int view_height)
+{
+    if(width <= 0 || height <= 0)
+        return;
+    d->view_width = view_width < width ? view_width : width;
+    d->view_height = view_height < height ? view_height : height;
+    if(width == d->width && height == d->height)
+        return;
+
+    deferred_destroy_targets(d);
+    d->width = width;
+    d->height = height;
+    deferred_create_targets(d);
+}
+
+void
+deferred_begin_geometry(Deferred *d, mat4x4 view, mat4x4 projection)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, d->fbo);
+    glViewport(0, 0, d->view_width, d->view_height);
+    glEnable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    // glClear leaves integer targets undefined, the light pass discards what geometry didn't cover anyway
+    glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    glUseProgram(d->geometry_program);
+    glUniformMatrix4fv(glGetUniformLocation(d->geometry_program, "projection"), 1, GL_FALSE, (GLfloat*)projection);
+    glUniformMatrix4fv(glGetUniformLocation(d->geometry_program, "view"), 1, GL_FALSE, (GLfloat*)view);
+}
+
+void
+deferred_end_geometry(Deferred *d)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, d->output_fbo);
+}
+
+/*
+ * Screen space bounds of a light sphere. Each edge is projected with both
+ * the nearest and the farthest depth of the sphere and the wider one is
+ * kept, which stays conservative on both sides of the view axis.
+ * Returns 0 when the light is completely behind the camera.
+ */
+static int
+light_scissor(Deferred *d, vec3 center, float radius, mat4x4 projection, int rect[4])
+{
+    const float near = 0.01f;
+    float d_min = -(center[2] + radius);
+    float d_max = -(center[2] - radius);
+
+    if(d_max <= near)
+        return 0;
+
+    if(d_min <= near || vec3_len(center) <= radius) {
+        rect[0] = 0;
+        rect[1] = 0;
+        rect[2] = d->view_width;
+        rect[3] = d->view_height;
+        return 1;
+    }
+
+    float bounds[4];
+    float scale[2] = { projection[0][0], projection[1][1] };
+    for(int axis = 0; axis < 2; axis++) {
+        float lo = center[axis] - radius;
+        float hi = center[axis] + radius;
+        float a = lo / d_min, b = lo / d_max;
+        float c = hi / d_min, e = hi / d_max;
+        float ndc_lo = scale[axis] * (a < b ? a : b);
+        float ndc_hi = scale[axis] * (c > e ? c : e);
+        bounds[axis]     = ndc_lo < -1.0f ? -1.0f : ndc_lo;
+        bounds[axis + 2] = ndc_hi >  1.0f ?  1.0f : ndc_hi;
+    }
+    if(bounds[0] >= bounds[2] || bounds[1] >= bounds[3])
+        return 0;
+
+    int x0 = (int)((bounds[0] * 0.5f + 0.5f) * d->view_width);
+    int y0 = (int)((bounds[1] * 0.5f + 0.5f) * d->view_height);
+    int x1 = (int)((bounds[2] * 0.5f + 0.5f) * d->view_width) + 1;
+    int y1 = (int)((bounds[3] * 0.5f + 0.5f) * d->view_height) + 1;
+    rect[0] = x0;
+    rect[1] = y0;
+    rect[2] = x1 - x0;
+    rect[3] = y1 - y0;
+    return 1;
+}
+
+void
+deferred_light_pass(Deferred *d, const Light *lights, int count, mat4x4 view, mat4x4 projection)
+{
+    unsigned int program = d->light_program;
+    mat4x4 inv_projection, inv_view;
+    mat4x4_invert(inv_projection, projection);
+    mat4x4_invert(inv_view, view);
+
+    glViewport(0, 0, d->view_width, d->view_height);
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, d->material_tex);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, d->normal_tex);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, d->depth_tex);
+    glActiveTexture(GL_TEXTURE0);
+
+    glUseProgram(program);
+    glBindVertexArray(d->empty_vao);
+    glUniformMatrix4fv(glGetUniformLocation(program, "invProjection"), 1, GL_FALSE, (GLfloat*)inv_projection);
+    glUniformMatrix4fv(glGetUniformLocation(program, "invView"), 1, GL_FALSE, (GLfloat*)inv_view);
+
+    int loc_pos = glGetUniformLocation(program, "lightPos");
+    int loc_color = glGetUniformLocation(program, "lightColor");
+    int loc_radius = glGetUniformLocation(program, "lightRadius");
+    int loc_ambient = glGetUniformLocation(program, "ambientStrength");
+    int loc_shadow = glGetUniformLocation(program, "castsShadow");
+
+    /* ambient pass writes every covered pixel once, lights are added on top */
+    glUniform1f(loc_ambient, 0.2f);
+    glUniform3f(loc_color, 0.0f, 0.0f, 0.0f);
+    glUniform1f(loc_radius, 1.0f);
+    glUniform1i(loc_shadow, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glEnable(GL_SCISSOR_TEST);
+    glUniform1f(loc_ambient, 0.0f);
+
+    for(int i = 0; i < count; i++) {
+        int directional = lights[i].radius <= 0.0f;
+        vec4 world = { lights[i].position[0], lights[i].position[1], lights[i].position[2], directional ? 0.0f : 1.0f };
+        vec4 view_pos;
+        mat4x4_mul_vec4(view_pos, view, world);
+
+        int rect[4] = { 0, 0, d->view_width, d->view_height };
+        if(!directional && !light_scissor(d, view_pos, lights[i].radius, projection, rect))
+            continue;
+
+        glScissor(rect[0], rect[1], rect[2], rect[3]);
+        glUniform3fv(loc_pos, 1, view_pos);
+        glUniform3fv(loc_color, 1, lights[i].color);
+        glUniform1f(loc_radius, lights[i].radius);
+        glUniform1i(loc_shadow, i == d->shadow_light);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+
+    /* forward passes drawn after this (light markers) still need scene depth */
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, d->fbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, d->output_fbo);
+    glBlitFramebuffer(0, 0, d->view_width, d->view_height, 0, 0, d->view_width, d->view_height, GL_DEPTH_BUFFER_BIT,
+                      GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, d->output_fbo);
+}
+
+void
+deferred_destroy(Deferred *d)
+{
+    deferred_destroy_targets(d);
+    glDeleteVertexArrays(1, &d->empty_vao);
+}
@@ -0,0 +1,35 @@
+#ifndef __DEFERRED__H__
+#define __DEFERRED__H__
+
+#include <linmath.h>
+
+#include "light.h"
+
+/*
+ * G-buffer layout (8 bytes per pixel):
+ *   0: R16UI   material index, the light pass fetches the material
+ *   1: RG16    view space normal, octahedral encoded
+ *   depth: DEPTH24_STENCIL8, view space position is rebuilt from it
+ */
+typedef struct {
+    unsigned int fbo;
+    unsigned int material_tex;
+    unsigned int normal_tex;
+    unsigned int depth_tex;
+    unsigned int geometry_program;
+    unsigned int light_program;
+    unsigned int empty_vao;
+    int width, height;
+    int view_width, view_height;   /* the corner this frame draws into, smaller under dynamic resolution */
+    int shadow_light;   /* index into the light array, -1 for none */
+    unsigned int output_fbo;   /* the light pass draws here, 0 for the window */
+} Deferred;
+
+void deferred_init(Deferred *d, unsigned int geometry_program, unsigned int light_program, int width, int height);
+void deferred_resize(Deferred *d, int width, int height, int view_width, int view_height);
+void deferred_begin_geometry(Deferred *d, mat4x4 view, mat4x4 projection);
+void deferred_end_geometry(Deferred *d);
+void deferred_light_pass(Deferred *d, const Light *lights, int count, mat4x4 view, mat4x4 projection);
+void deferred_destroy(Deferred *d);
+
+#endif
@@ -0,0 +1,67 @@
+#include <math.h>
+
+#include "dynres.h"
+
+void
+dynres_init(DynamicResolution *d, float target_ms, float min_scale, float max_scale)
+{
+    d->target_ms = target_ms;
+    d->min_scale = min_scale;
+    d->max_scale = max_scale;
+    d->scale = max_scale;
+    d->average_ms = 0.0f;
+    d->cooldown = 0;
+    dynres_reset_stats(d);
+}
+
+/* Feeds the GPU time of one finished frame, returns the scale for the next. */
+float
+dynres_update(DynamicResolution *d, double gpu_ms)
+{
+    if(d->scale > d->max_scale || d->scale < d->min_scale) {
+        d->scale = d->scale > d->max_scale ? d->max_scale : d->min_scale;
+        d->cooldown = DYNRES_COOLDOWN;
+    }
+    if(gpu_ms <= 0.0)
+        return d->scale;
+    d->frames++;
+    d->over_target += gpu_ms > d->target_ms;
+    if(d->cooldown > 0) {
+        d->cooldown--;
+        return d->scale;
+    }
+
+    float ms = (float)gpu_ms;
+    if(d->average_ms <= 0.0f || ms > d->average_ms)
+        d->average_ms = ms;
+    else
+        d->average_ms += (ms - d->average_ms) * DYNRES_SMOOTHING;
+
+    float fit = d->scale * sqrtf(d->target_ms / d->average_ms);
+    float next = d->scale;
+    if(d->average_ms > d->target_ms)
+        next = floorf(fit / DYNRES_STEP) * DYNRES_STEP;
+    else if(d->average_ms < d->target_ms * DYNRES_HEADROOM && fit >= d->scale + DYNRES_STEP)
+        next = d->scale + DYNRES_STEP;
+    if(next > d->max_scale)
+        next = d->max_scale;
+    if(next < d->min_scale)
+        next = d->min_scale;
+    if(fabsf(next - d->scale) < DYNRES_STEP * 0.5f)
+        return d->scale;
+
+    // what the new scale should cost, until frames drawn at it are measured
+    d->average_ms *= (next * next) / (d->scale * d->scale);
+    d->scale = next;
+    d->cooldown = DYNRES_COOLDOWN;
+    d->changes++;
+    return d->scale;
+}
+
+void
+dynres_reset_stats(DynamicResolution *d)
+{
+    d->frames = 0;
+    d->over_target = 0;
+    d->changes = 0;
+}
@@ -0,0 +1,35 @@
+#ifndef __DYNRES__H__
+#define __DYNRES__H__
+
+#include "untitled_types.h"
+
+/*
+ * Dynamic resolution. Picks the scale the scene is drawn at, inside HDR
+ * targets allocated at max_scale, from the GPU time of recent frames. GPU time is taken to follow the pixel count,
+ * the square of the scale: over target the scale drops straight to what
+ * should fit, under target with DYNRES_HEADROOM to spare it climbs a step.
+ *
+ * The scale moves in steps so it doesn't chase every frame's noise, and
+ * after each change the timer results still in flight, measured at the
+ * old scale, are skipped.
+ */
+
+#define DYNRES_STEP 0.05f
+#define DYNRES_HEADROOM 0.8f      /* of the target, the time at which a step up is tried */
+#define DYNRES_COOLDOWN 6         /* frames, more than the GPU timer latency */
+#define DYNRES_SMOOTHING 0.1f     /* of a new sample under the average, one over it is taken whole */
+
+typedef struct {
+    float target_ms;
+    float min_scale, max_scale;
+    float scale;
+    float average_ms;         /* recent GPU frame time at the current scale */
+    int cooldown;             /* samples left to skip */
+    u32 frames, over_target, changes;
+} DynamicResolution;
+
+void dynres_init(DynamicResolution *d, float target_ms, float min_scale, float max_scale);
+float dynres_update(DynamicResolution *d, double gpu_ms);
+void dynres_reset_stats(DynamicResolution *d);
+
+#endif
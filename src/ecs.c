@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecs.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define POOL_MIN_CAPACITY 64
+
+static void
+ecs_pool_init(EcsPool *p, u32 max_entities, int column_count, const size_t *column_size)
+{
+    memset(p, 0, sizeof(*p));
+    p->sparse = malloc(sizeof(u32) * max_entities);
+    if(!p->sparse) {
+        ERROR_EXIT(1, "Couldn't allocate component pool\n");
+    }
+    memset(p->sparse, 0xff, sizeof(u32) * max_entities);
+    p->column_count = column_count;
+    for(int i = 0; i < column_count; i++)
+        p->column_size[i] = column_size[i];
+    p->aligned_to = -1;
+}
+
+static void
+ecs_pool_grow(EcsPool *p)
+{
+    u32 capacity = p->capacity ? p->capacity * 2 : POOL_MIN_CAPACITY;
+    p->entities = realloc(p->entities, sizeof(Entity) * capacity);
+    if(!p->entities) {
+        ERROR_EXIT(1, "Couldn't grow component pool\n");
+    }
+    for(int i = 0; i < p->column_count; i++) {
+        // 16 byte aligned so a loop over a column can start with aligned vector loads
+        void *column = aligned_alloc(16, (p->column_size[i] * capacity + 15) & ~(size_t)15);
+        if(!column) {
+            ERROR_EXIT(1, "Couldn't grow component pool\n");
+        }
+        if(p->columns[i])
+            memcpy(column, p->columns[i], p->column_size[i] * p->count);
+        free(p->columns[i]);
+        p->columns[i] = column;
+    }
+    p->capacity = capacity;
+}
+
+static void
+ecs_pool_swap(EcsPool *p, u32 a, u32 b)
+{
+    unsigned char tmp[sizeof(mat4x4)];
+    for(int i = 0; i < p->column_count; i++) {
+        size_t size = p->column_size[i];
+        unsigned char *column = p->columns[i];
+        memcpy(tmp, column + a * size, size);
+        memcpy(column + a * size, column + b * size, size);
+        memcpy(column + b * size, tmp, size);
+    }
+    Entity ea = p->entities[a], eb = p->entities[b];
+    p->entities[a] = eb;
+    p->entities[b] = ea;
+    p->sparse[ecs_index(ea)] = b;
+    p->sparse[ecs_index(eb)] = a;
+}
+
+void
+ecs_init(EcsWorld *w, u32 max_entities)
+{
+    if(max_entities > ECS_MAX_ENTITIES) {
+        ERROR_EXIT(1, "At most %u entities are supported\n", ECS_MAX_ENTITIES);
+    }
+    memset(w, 0, sizeof(*w));
+    w->max_entities = max_entities;
+    w->generation = calloc(max_entities, 1);
+    w->free_list = malloc(sizeof(u32) * max_entities);
+    if(!w->generation || !w->free_list) {
+        ERROR_EXIT(1, "Couldn't allocate entity tables\n");
+    }
+
+    const size_t transform[] = { sizeof(u32) };
+    const size_t mesh[] = { sizeof(u32), sizeof(float), sizeof(u32) };
+    const size_t material[] = { sizeof(u32) };
+    const size_t light[] = { sizeof(vec3), sizeof(float) };
+    ecs_pool_init(&w->pools[ECS_TRANSFORM], max_entities, 1, transform);
+    ecs_pool_init(&w->pools[ECS_MESH], max_entities, 3, mesh);
+    ecs_pool_init(&w->pools[ECS_MATERIAL], max_entities, 1, material);
+    ecs_pool_init(&w->pools[ECS_LIGHT], max_entities, 2, light);
+    hierarchy_init(&w->transforms, max_entities);
+}
+
+void
+ecs_destroy(EcsWorld *w)
+{
+    for(int c = 0; c < ECS_COMPONENT_COUNT; c++) {
+        EcsPool *p = &w->pools[c];
+        for(int i = 0; i < p->column_count; i++)
+            free(p->columns[i]);
+        free(p->entities);
+        free(p->sparse);
+    }
+    free(w->generation);
+    free(w->free_list);
+    hierarchy_destroy(&w->transforms);
+}
+
+Entity
+ecs_create(EcsWorld *w)
+{
+    u32 index;
+    if(w->free_count)
+        index = w->free_list[--w->free_count];
+    else if(w->next_index < w->max_entities)
+        index = w->next_index++;
+    else {
+        ERROR_EXIT(1, "Out of entities (%u)\n", w->max_entities);
+    }
+    w->entity_count++;
+    return ((Entity)w->generation[index] << ECS_INDEX_BITS) | index;
+}
+
+bool
+ecs_alive(const EcsWorld *w, Entity e)
+{
+    u32 index = ecs_index(e);
+    return index < w->next_index && w->generation[index] == (e >> ECS_INDEX_BITS);
+}
+
+void
+ecs_destroy_entity(EcsWorld *w, Entity e)
+{
+    if(!ecs_alive(w, e))
+        return;
+    for(int c = 0; c < ECS_COMPONENT_COUNT; c++)
+        ecs_remove(w, c, e);
+    // a stale handle to this slot no longer passes ecs_alive
+    u32 index = ecs_index(e);
+    w->generation[index]++;
+    w->free_list[w->free_count++] = index;
+    w->entity_count--;
+}
+
+/* A stale handle's index may already belong to another entity, whose components it would take over. */
+static void
+ecs_check_alive(const EcsWorld *w, Entity e)
+{
+    if(!ecs_alive(w, e)) {
+        ERROR_EXIT(1, "Component added to dead entity %u (index %u)\n", e, ecs_index(e));
+    }
+}
+
+/* Returns the dense slot, the caller fills the columns. */
+u32
+ecs_add(EcsWorld *w, EcsComponent c, Entity e)
+{
+    ecs_check_alive(w, e);
+    EcsPool *p = &w->pools[c];
+    u32 slot = p->sparse[ecs_index(e)];
+    if(slot != ECS_ABSENT)
+        return slot;
+    if(p->count == p->capacity)
+        ecs_pool_grow(p);
+    slot = p->count++;
+    p->entities[slot] = e;
+    p->sparse[ecs_index(e)] = slot;
+    p->version++;
+    return slot;
+}
+
+void
+ecs_remove(EcsWorld *w, EcsComponent c, Entity e)
+{
+    EcsPool *p = &w->pools[c];
+    u32 slot = p->sparse[ecs_index(e)];
+    if(slot == ECS_ABSENT)
+        return;
+    if(c == ECS_TRANSFORM)
+        hierarchy_remove(&w->transforms, ((u32 *)p->columns[TRANSFORM_NODE])[slot]);
+    u32 last = p->count - 1;
+    if(slot != last) {
+        for(int i = 0; i < p->column_count; i++) {
+            size_t size = p->column_size[i];
+            unsigned char *column = p->columns[i];
+            memcpy(column + slot * size, column + last * size, size);
+        }
+        p->entities[slot] = p->entities[last];
+        p->sparse[ecs_index(p->entities[slot])] = slot;
+    }
+    p->sparse[ecs_index(e)] = ECS_ABSENT;
+    p->count--;
+    p->version++;
+}
+
+/*
+ * Reorders the follower pool so entities it shares with the leader come
+ * first, in the leader's order. When every leader entity has the
+ * follower component, slot i of both pools is then the same entity and
+ * a system can walk both column sets in lockstep. Returns the length of
+ * that shared prefix. Does nothing if neither pool changed since the
+ * last call.
+ */
+u32
+ecs_align(EcsWorld *w, EcsComponent follower, EcsComponent leader)
+{
+    EcsPool *f = &w->pools[follower];
+    EcsPool *l = &w->pools[leader];
+    if(f->aligned_to == (int)leader && f->aligned_version[0] == f->version && f->aligned_version[1] == l->version)
+        return f->aligned_count;
+
+    u32 shared = 0;
+    for(u32 i = 0; i < l->count; i++) {
+        u32 slot = f->sparse[ecs_index(l->entities[i])];
+        if(slot == ECS_ABSENT)
+            continue;
+        if(slot != shared)
+            ecs_pool_swap(f, slot, shared);
+        shared++;
+    }
+    f->version++;
+    f->aligned_to = leader;
+    f->aligned_version[0] = f->version;
+    f->aligned_version[1] = l->version;
+    f->aligned_count = shared;
+    return shared;
+}
+
+/* parent is an entity with a Transform or ECS_NULL */
+u32
+ecs_add_transform(EcsWorld *w, Entity e, Entity parent, const vec3 position, float angle, const vec3 scale)
+{
+    ecs_check_alive(w, e);
+    if(ecs_has(w, ECS_TRANSFORM, e)) {
+        hierarchy_set_local(&w->transforms, ecs_node(w, e), position, angle, scale);
+        return ecs_slot(w, ECS_TRANSFORM, e);
+    }
+    u32 parent_node = parent == ECS_NULL ? HIERARCHY_NONE : ecs_node(w, parent);
+    u32 node = hierarchy_add(&w->transforms, parent_node, position, angle, scale);
+    u32 slot = ecs_add(w, ECS_TRANSFORM, e);
+    ((u32 *)ecs_column(w, ECS_TRANSFORM, TRANSFORM_NODE))[slot] = node;
+    return slot;
+}
+
+u32
+ecs_add_mesh(EcsWorld *w, Entity e, u32 mesh, float radius)
+{
+    u32 slot = ecs_add(w, ECS_MESH, e);
+    ((u32 *)ecs_column(w, ECS_MESH, MESH_ID))[slot] = mesh;
+    ((float *)ecs_column(w, ECS_MESH, MESH_RADIUS))[slot] = radius;
+    ((u32 *)ecs_column(w, ECS_MESH, MESH_LOD))[slot] = 0;
+    return slot;
+}
+
+u32
+ecs_add_material(EcsWorld *w, Entity e, u32 material)
+{
+    u32 slot = ecs_add(w, ECS_MATERIAL, e);
+    ((u32 *)ecs_column(w, ECS_MATERIAL, MATERIAL_ID))[slot] = material;
+    return slot;
+}
+
+u32
+ecs_add_light(EcsWorld *w, Entity e, const vec3 color, float radius)
+{
+    u32 slot = ecs_add(w, ECS_LIGHT, e);
+    vec3_dup(((vec3 *)ecs_column(w, ECS_LIGHT, LIGHT_COLOR))[slot], color);
+    ((float *)ecs_column(w, ECS_LIGHT, LIGHT_RADIUS))[slot] = radius;
+    return slot;
+}
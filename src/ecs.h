@@ -0,0 +1,125 @@
+#ifndef __ECS__H__
+#define __ECS__H__
+
+#include <stddef.h>
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "hierarchy.h"
+
+/*
+ * Entity-component store built on sparse sets. Every component type is
+ * a pool with a sparse entity -> slot table and dense SoA columns, one
+ * contiguous array per field, so systems walk plain arrays. Removal
+ * swaps the last slot into the hole, slots are not stable across
+ * structural changes.
+ *
+ * A Transform is a node in the world's hierarchy, the local TRS and the
+ * world matrix live there in breadth first order.
+ */
+
+typedef u32 Entity;   /* slot index in the low 24 bits, generation in the high 8 */
+
+#define ECS_INDEX_BITS 24
+#define ECS_INDEX_MASK ((1u << ECS_INDEX_BITS) - 1)
+#define ECS_MAX_ENTITIES (1u << ECS_INDEX_BITS)
+#define ECS_MAX_COLUMNS 4
+#define ECS_ABSENT 0xffffffffu
+#define ECS_NULL 0xffffffffu
+
+#define ecs_index(e) ((e) & ECS_INDEX_MASK)
+
+typedef enum {
+    ECS_TRANSFORM,
+    ECS_MESH,
+    ECS_MATERIAL,
+    ECS_LIGHT,
+    ECS_COMPONENT_COUNT
+} EcsComponent;
+
+/* column layout of each component */
+enum { TRANSFORM_NODE };                                                          /* u32 hierarchy handle */
+enum { MESH_ID, MESH_RADIUS, MESH_LOD };                                          /* u32, float, u32 */
+enum { MATERIAL_ID };                                                             /* u32 into the MaterialLibrary */
+enum { LIGHT_COLOR, LIGHT_RADIUS };                                               /* vec3, float, 0 = directional */
+
+typedef struct {
+    u32 count;
+    u32 capacity;
+    u32 *sparse;              /* entity index -> dense slot or ECS_ABSENT */
+    Entity *entities;         /* dense slot -> entity */
+    int column_count;
+    size_t column_size[ECS_MAX_COLUMNS];
+    void *columns[ECS_MAX_COLUMNS];
+    u32 version;              /* bumped on every add/remove/reorder */
+    int aligned_to;           /* pool this one was last aligned to, -1 if none */
+    u32 aligned_version[2];   /* own and leader version at that time */
+    u32 aligned_count;        /* shared prefix length at that time */
+} EcsPool;
+
+typedef struct {
+    u32 max_entities;
+    u32 entity_count;
+    u32 next_index;
+    u8 *generation;
+    u32 *free_list;
+    u32 free_count;
+    EcsPool pools[ECS_COMPONENT_COUNT];
+    Hierarchy transforms;
+} EcsWorld;
+
+void ecs_init(EcsWorld *w, u32 max_entities);
+void ecs_destroy(EcsWorld *w);
+
+Entity ecs_create(EcsWorld *w);
+void ecs_destroy_entity(EcsWorld *w, Entity e);
+bool ecs_alive(const EcsWorld *w, Entity e);
+
+u32 ecs_add(EcsWorld *w, EcsComponent c, Entity e);
+void ecs_remove(EcsWorld *w, EcsComponent c, Entity e);
+u32 ecs_align(EcsWorld *w, EcsComponent follower, EcsComponent leader);
+
+u32 ecs_add_transform(EcsWorld *w, Entity e, Entity parent, const vec3 position, float angle, const vec3 scale);
+u32 ecs_add_mesh(EcsWorld *w, Entity e, u32 mesh, float radius);
+u32 ecs_add_material(EcsWorld *w, Entity e, u32 material);
+u32 ecs_add_light(EcsWorld *w, Entity e, const vec3 color, float radius);
+
+/* dense slot of e in pool c, ECS_ABSENT if it has no such component */
+static inline u32
+ecs_slot(const EcsWorld *w, EcsComponent c, Entity e)
+{
+    return w->pools[c].sparse[ecs_index(e)];
+}
+
+static inline bool
+ecs_has(const EcsWorld *w, EcsComponent c, Entity e)
+{
+    return ecs_slot(w, c, e) != ECS_ABSENT;
+}
+
+static inline u32
+ecs_count(const EcsWorld *w, EcsComponent c)
+{
+    return w->pools[c].count;
+}
+
+static inline void *
+ecs_column(const EcsWorld *w, EcsComponent c, int column)
+{
+    return w->pools[c].columns[column];
+}
+
+/* hierarchy node of e's Transform */
+static inline u32
+ecs_node(const EcsWorld *w, Entity e)
+{
+    return ((const u32 *)w->pools[ECS_TRANSFORM].columns[TRANSFORM_NODE])[ecs_slot(w, ECS_TRANSFORM, e)];
+}
+
+static inline const Entity *
+ecs_entities(const EcsWorld *w, EcsComponent c)
+{
+    return w->pools[c].entities;
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef __FRAME_PACKET__H__
+#define __FRAME_PACKET__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "light.h"
+#include "camera.h"
+#include "shadow.h"
+#include "post.h"
+
+#define MAX_FRAME_OBJECTS 64
+
+/* F4 cycles these, by state puts draws of the same mesh and material together, nearest first among them */
+enum { DRAW_SORT_OFF, DRAW_SORT_DEPTH, DRAW_SORT_STATE, DRAW_SORT_MODES };
+
+typedef struct {
+    float depth;
+    int index;
+    u32 state;                /* mesh id above material index */
+} DrawItem;
+
+/*
+ * Everything the render thread needs for one frame. Built by the
+ * simulation thread and copied through the packet queue, so the render
+ * thread never touches simulation state directly.
+ */
+typedef struct {
+    u64 frame;
+    double build_time;
+    double input_time;        /* when input for it was sampled, latency is measured from here */
+    double pacing_wait;       /* the simulation thread's wait for the frame cap or a request, seconds */
+    float delta;              /* seconds since the previous packet, steps the particles */
+    u64 sim_steps;
+    int width, height;
+
+    Camera camera;            /* matrices already built */
+
+    Light lights[MAX_LIGHTS];
+    int light_count;
+    vec3 marker_pos;
+
+    mat4x4 models[MAX_FRAME_OBJECTS];
+    float radius[MAX_FRAME_OBJECTS];
+    u32 material_ids[MAX_FRAME_OBJECTS];     /* into the MaterialLibrary the renderer uploaded */
+    u8 mesh_ids[MAX_FRAME_OBJECTS];
+    u8 lods[MAX_FRAME_OBJECTS];
+    vec3 bounds_min[MAX_FRAME_OBJECTS];       /* world space boxes for the occlusion tests */
+    vec3 bounds_max[MAX_FRAME_OBJECTS];
+    DrawItem draw_items[MAX_FRAME_OBJECTS];   /* visible objects only */
+    int object_count;
+    int draw_count;
+    u32 transforms_updated;
+    u32 transform_count;
+    u32 triangles;            /* drawn by the camera passes */
+    u32 full_triangles;       /* the same objects at level 0 */
+    u32 occluded;             /* draws rejected by occlusion culling */
+    u32 occluder_triangles;   /* rasterized by the software variant */
+    double occlusion_ms;      /* CPU time of the software variant */
+    size_t sim_frame_bytes;   /* used from the simulation thread's frame arena */
+    u64 sim_heap_allocations; /* by the simulation thread building this packet, MEMORY_DEBUG only */
+
+    bool deferred;
+    bool depth_prepass;
+    bool overdraw;
+    bool shadows;
+    bool cascaded;
+    ShadowConfig shadow_config;
+    int vertex_format;
+    int occlusion;            /* OCCLUSION_* */
+    int pacing;               /* PACING_* */
+    int particles;            /* PARTICLES_* */
+    int post;                 /* POST_* */
+    PostConfig post_config;
+    bool dynamic_resolution;  /* the render thread picks render_scale, post_config's is the most it may use */
+    float resolution_target_ms;
+    bool ibl;                 /* sky cubemaps for ambient and reflections, and the sky drawn behind */
+} FramePacket;
+
+#endif
@@ -0,0 +1,108 @@
+#include <math.h>
+#include <stb_image.h>
+
+#include "frame_tasks.h"
+
+void
+task_build_transforms(void *data, u32 begin, u32 end)
+{
+    TransformTask *t = data;
+    for(u32 i = begin; i < end; i++) {
+        // translate * rotate_y * scale written out, no identity or temporaries
+        float c = cosf(t->angles[i]), s = sinf(t->angles[i]);
+        const float *k = t->scales[i];
+        float *m = &t->models[i][0][0];
+        m[0]  =  c * k[0]; m[1]  = 0.0f;  m[2]  = -s * k[0]; m[3]  = 0.0f;
+        m[4]  = 0.0f;      m[5]  = k[1];  m[6]  = 0.0f;      m[7]  = 0.0f;
+        m[8]  =  s * k[2]; m[9]  = 0.0f;  m[10] =  c * k[2]; m[11] = 0.0f;
+        m[12] = t->positions[i][0];
+        m[13] = t->positions[i][1];
+        m[14] = t->positions[i][2];
+        m[15] = 1.0f;
+    }
+}
+
+void
+task_cull(void *data, u32 begin, u32 end)
+{
+    CullTask *t = data;
+    for(u32 i = begin; i < end; i++)
+        t->visible[i] = (u8)frustum_test_sphere(t->planes, t->models[i][3], t->radius[i], FRUSTUM_ALL_PLANES);
+}
+
+/* First stage of binning, one conservative tile rectangle per light. */
+void
+task_light_rects(void *data, u32 begin, u32 end)
+{
+    LightBinTask *t = data;
+    for(u32 i = begin; i < end; i++) {
+        int *rect = t->rects[i];
+        float r = t->radius[i];
+        float min_x = 1.0f, min_y = 1.0f, max_x = -1.0f, max_y = -1.0f;
+        int behind = 0;
+
+        // project the 8 corners of the bounding box of the sphere
+        for(int c = 0; c < 8; c++) {
+            vec4 p = { t->positions[i][0] + ((c & 1) ? r : -r),
+                       t->positions[i][1] + ((c & 2) ? r : -r),
+                       t->positions[i][2] + ((c & 4) ? r : -r), 1.0f };
+            vec4 clip;
+            mat4x4_mul_vec4(clip, t->view_projection, p);
+            if(clip[3] <= 0.0f) {
+                behind = 1;
+                break;
+            }
+            float x = clip[0] / clip[3], y = clip[1] / clip[3];
+            min_x = fminf(min_x, x); max_x = fmaxf(max_x, x);
+            min_y = fminf(min_y, y); max_y = fmaxf(max_y, y);
+        }
+        if(behind) {
+            // straddles the camera plane, treat as covering the screen
+            min_x = min_y = -1.0f;
+            max_x = max_y = 1.0f;
+        }
+        min_x = fmaxf(min_x, -1.0f); min_y = fmaxf(min_y, -1.0f);
+        max_x = fminf(max_x,  1.0f); max_y = fminf(max_y,  1.0f);
+
+        if(min_x >= max_x || min_y >= max_y) {
+            rect[0] = rect[1] = rect[2] = rect[3] = 0;
+            continue;
+        }
+        rect[0] = (int)((min_x * 0.5f + 0.5f) * t->width) / LIGHT_TILE_SIZE;
+        rect[1] = (int)((min_y * 0.5f + 0.5f) * t->height) / LIGHT_TILE_SIZE;
+        rect[2] = (int)((max_x * 0.5f + 0.5f) * t->width) / LIGHT_TILE_SIZE + 1;
+        rect[3] = (int)((max_y * 0.5f + 0.5f) * t->height) / LIGHT_TILE_SIZE + 1;
+        if(rect[2] > t->tiles_x) rect[2] = t->tiles_x;
+        if(rect[3] > t->tiles_y) rect[3] = t->tiles_y;
+    }
+}
+
+/* Second stage, ranges are tile rows so no two jobs write the same tile. */
+void
+task_bin_lights(void *data, u32 begin, u32 end)
+{
+    LightBinTask *t = data;
+    for(u32 y = begin; y < end; y++) {
+        for(int x = 0; x < t->tiles_x; x++) {
+            int tile = (int)y * t->tiles_x + x;
+            u16 count = 0;
+            u16 *list = &t->tile_lights[tile * MAX_LIGHTS_PER_TILE];
+            for(int i = 0; i < t->light_count && count < MAX_LIGHTS_PER_TILE; i++) {
+                const int *rect = t->rects[i];
+                if(x >= rect[0] && x < rect[2] && (int)y >= rect[1] && (int)y < rect[3])
+                    list[count++] = (u16)i;
+            }
+            t->tile_counts[tile] = count;
+        }
+    }
+}
+
+void
+task_decode_images(void *data, u32 begin, u32 end)
+{
+    DecodeTask *t = data;
+    for(u32 i = begin; i < end; i++) {
+        t->pixels[i] = stbi_load_from_memory(t->files[i], t->file_sizes[i],
+                                             &t->widths[i], &t->heights[i], &t->channels[i], 0);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef __FRAME_TASKS__H__
+#define __FRAME_TASKS__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "frustum.h"
+
+/*
+ * Per frame work split into range kernels, each with the JobFunc
+ * signature so it can run inline or through job_parallel_for.
+ */
+
+typedef struct {
+    const vec3 *positions;
+    const float *angles;     /* rotation about y, radians */
+    const vec3 *scales;
+    mat4x4 *models;
+} TransformTask;
+
+typedef struct {
+    mat4x4 *models;          /* sphere centers are the translations */
+    const float *radius;
+    vec4 planes[FRUSTUM_PLANES];
+    u8 *visible;
+} CullTask;
+
+#define LIGHT_TILE_SIZE 32
+#define MAX_LIGHTS_PER_TILE 32
+
+typedef struct {
+    int light_count;
+    const vec3 *positions;   /* world space */
+    const float *radius;
+    mat4x4 view_projection;
+    int width, height;
+    int tiles_x, tiles_y;
+    int (*rects)[4];         /* per light tile rect, min inclusive, max exclusive */
+    u16 *tile_counts;
+    u16 *tile_lights;        /* MAX_LIGHTS_PER_TILE per tile */
+} LightBinTask;
+
+typedef struct {
+    const unsigned char **files;
+    const int *file_sizes;
+    unsigned char **pixels;
+    int *widths, *heights, *channels;
+} DecodeTask;
+
+void task_build_transforms(void *data, u32 begin, u32 end);
+void task_cull(void *data, u32 begin, u32 end);
+void task_light_rects(void *data, u32 begin, u32 end);
+void task_bin_lights(void *data, u32 begin, u32 end);
+void task_decode_images(void *data, u32 begin, u32 end);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef __FRUSTUM__H__
+#define __FRUSTUM__H__
+
+#include <linmath.h>
+
+enum {
+    FRUSTUM_LEFT,
+    FRUSTUM_RIGHT,
+    FRUSTUM_BOTTOM,
+    FRUSTUM_TOP,
+    FRUSTUM_NEAR,
+    FRUSTUM_FAR,
+    FRUSTUM_PLANES
+};
+
+/* Gribb/Hartmann plane extraction, planes point inwards and are normalized. */
+static inline void
+frustum_from_matrix(vec4 planes[FRUSTUM_PLANES], mat4x4 const m)
+{
+    for(int i = 0; i < 4; i++) {
+        planes[FRUSTUM_LEFT][i]   = m[i][3] + m[i][0];
+        planes[FRUSTUM_RIGHT][i]  = m[i][3] - m[i][0];
+        planes[FRUSTUM_BOTTOM][i] = m[i][3] + m[i][1];
+        planes[FRUSTUM_TOP][i]    = m[i][3] - m[i][1];
+        planes[FRUSTUM_NEAR][i]   = m[i][3] + m[i][2];
+        planes[FRUSTUM_FAR][i]    = m[i][3] - m[i][2];
+    }
+    for(int p = 0; p < FRUSTUM_PLANES; p++) {
+        float len = sqrtf(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+        vec4_scale(planes[p], planes[p], 1.0f / len);
+    }
+}
+
+/* plane_mask selects which planes take part, bit n is plane n */
+static inline int
+frustum_test_sphere(vec4 planes[FRUSTUM_PLANES], const float *center, float radius, unsigned int plane_mask)
+{
+    for(int p = 0; p < FRUSTUM_PLANES; p++) {
+        if(!(plane_mask & (1u << p)))
+            continue;
+        float dist = planes[p][0] * center[0] + planes[p][1] * center[1] + planes[p][2] * center[2] + planes[p][3];
+        if(dist < -radius)
+            return 0;
+    }
+    return 1;
+}
+
+#define FRUSTUM_ALL_PLANES 0x3fu
+
+#endif
@@ -0,0 +1,2665 @@
+/*
+    Lazy entry points for glad, generated by tools/glad_lazy.c from
+    include/glad/glad.h (374 functions). Do not edit, run make glad-lazy.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <glad/glad.h>
+
+#include "glad_lazy.h"
+
+static GLADloadproc glad_lazy_load;
+unsigned int glad_lazy_resolved;
+
+static void *
+glad_lazy_resolve(const char *name)
+{
+    void *proc = glad_lazy_load(name);
+    if(!proc) {
+        fprintf(stderr, "OpenGL entry point %s is missing\n", name);
+        exit(1);
+    }
+    glad_lazy_resolved++;
+    return proc;
+}
+
+static void APIENTRY glad_lazy_glCullFace(GLenum mode)
+{
+    glad_glCullFace = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace");
+    glad_glCullFace(mode);
+}
+
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode)
+{
+    glad_glFrontFace = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace");
+    glad_glFrontFace(mode);
+}
+
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode)
+{
+    glad_glHint = (PFNGLHINTPROC)glad_lazy_resolve("glHint");
+    glad_glHint(target, mode);
+}
+
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width)
+{
+    glad_glLineWidth = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth");
+    glad_glLineWidth(width);
+}
+
+static void APIENTRY glad_lazy_glPointSize(GLfloat size)
+{
+    glad_glPointSize = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize");
+    glad_glPointSize(size);
+}
+
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode)
+{
+    glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode");
+    glad_glPolygonMode(face, mode);
+}
+
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glad_glScissor = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor");
+    glad_glScissor(x, y, width, height);
+}
+
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf");
+    glad_glTexParameterf(target, pname, param);
+}
+
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+    glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv");
+    glad_glTexParameterfv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri");
+    glad_glTexParameteri(target, pname, param);
+}
+
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+    glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv");
+    glad_glTexParameteriv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D");
+    glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D");
+    glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf)
+{
+    glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer");
+    glad_glDrawBuffer(buf);
+}
+
+static void APIENTRY glad_lazy_glClear(GLbitfield mask)
+{
+    glad_glClear = (PFNGLCLEARPROC)glad_lazy_resolve("glClear");
+    glad_glClear(mask);
+}
+
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    glad_glClearColor = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor");
+    glad_glClearColor(red, green, blue, alpha);
+}
+
+static void APIENTRY glad_lazy_glClearStencil(GLint s)
+{
+    glad_glClearStencil = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil");
+    glad_glClearStencil(s);
+}
+
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth)
+{
+    glad_glClearDepth = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth");
+    glad_glClearDepth(depth);
+}
+
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask)
+{
+    glad_glStencilMask = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask");
+    glad_glStencilMask(mask);
+}
+
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    glad_glColorMask = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask");
+    glad_glColorMask(red, green, blue, alpha);
+}
+
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag)
+{
+    glad_glDepthMask = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask");
+    glad_glDepthMask(flag);
+}
+
+static void APIENTRY glad_lazy_glDisable(GLenum cap)
+{
+    glad_glDisable = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable");
+    glad_glDisable(cap);
+}
+
+static void APIENTRY glad_lazy_glEnable(GLenum cap)
+{
+    glad_glEnable = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable");
+    glad_glEnable(cap);
+}
+
+static void APIENTRY glad_lazy_glFinish(void)
+{
+    glad_glFinish = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish");
+    glad_glFinish();
+}
+
+static void APIENTRY glad_lazy_glFlush(void)
+{
+    glad_glFlush = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush");
+    glad_glFlush();
+}
+
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    glad_glBlendFunc = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc");
+    glad_glBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode)
+{
+    glad_glLogicOp = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp");
+    glad_glLogicOp(opcode);
+}
+
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc");
+    glad_glStencilFunc(func, ref, mask);
+}
+
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    glad_glStencilOp = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp");
+    glad_glStencilOp(fail, zfail, zpass);
+}
+
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func)
+{
+    glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc");
+    glad_glDepthFunc(func);
+}
+
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param)
+{
+    glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref");
+    glad_glPixelStoref(pname, param);
+}
+
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param)
+{
+    glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei");
+    glad_glPixelStorei(pname, param);
+}
+
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src)
+{
+    glad_glReadBuffer = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer");
+    glad_glReadBuffer(src);
+}
+
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    glad_glReadPixels = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels");
+    glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data)
+{
+    glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv");
+    glad_glGetBooleanv(pname, data);
+}
+
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data)
+{
+    glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev");
+    glad_glGetDoublev(pname, data);
+}
+
+static GLenum APIENTRY glad_lazy_glGetError(void)
+{
+    glad_glGetError = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError");
+    return glad_glGetError();
+}
+
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data)
+{
+    glad_glGetFloatv = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv");
+    glad_glGetFloatv(pname, data);
+}
+
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data)
+{
+    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv");
+    glad_glGetIntegerv(pname, data);
+}
+
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage");
+    glad_glGetTexImage(target, level, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+    glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv");
+    glad_glGetTexParameterfv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv");
+    glad_glGetTexParameteriv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv");
+    glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv");
+    glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap)
+{
+    glad_glIsEnabled = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled");
+    return glad_glIsEnabled(cap);
+}
+
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f)
+{
+    glad_glDepthRange = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange");
+    glad_glDepthRange(n, f);
+}
+
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glad_glViewport = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport");
+    glad_glViewport(x, y, width, height);
+}
+
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays");
+    glad_glDrawArrays(mode, first, count);
+}
+
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements");
+    glad_glDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units)
+{
+    glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset");
+    glad_glPolygonOffset(factor, units);
+}
+
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D");
+    glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D");
+    glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D");
+    glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D");
+    glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D");
+    glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D");
+    glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture)
+{
+    glad_glBindTexture = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture");
+    glad_glBindTexture(target, texture);
+}
+
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures");
+    glad_glDeleteTextures(n, textures);
+}
+
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures)
+{
+    glad_glGenTextures = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures");
+    glad_glGenTextures(n, textures);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture)
+{
+    glad_glIsTexture = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture");
+    return glad_glIsTexture(texture);
+}
+
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements");
+    glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D");
+    glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D");
+    glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D");
+    glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture)
+{
+    glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture");
+    glad_glActiveTexture(texture);
+}
+
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert)
+{
+    glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage");
+    glad_glSampleCoverage(value, invert);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D");
+    glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D");
+    glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D");
+    glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D");
+    glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D");
+    glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D");
+    glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img)
+{
+    glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage");
+    glad_glGetCompressedTexImage(target, level, img);
+}
+
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate");
+    glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays");
+    glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements");
+    glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param)
+{
+    glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf");
+    glad_glPointParameterf(pname, param);
+}
+
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params)
+{
+    glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv");
+    glad_glPointParameterfv(pname, params);
+}
+
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param)
+{
+    glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri");
+    glad_glPointParameteri(pname, param);
+}
+
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params)
+{
+    glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv");
+    glad_glPointParameteriv(pname, params);
+}
+
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    glad_glBlendColor = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor");
+    glad_glBlendColor(red, green, blue, alpha);
+}
+
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode)
+{
+    glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation");
+    glad_glBlendEquation(mode);
+}
+
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids)
+{
+    glad_glGenQueries = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries");
+    glad_glGenQueries(n, ids);
+}
+
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+    glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries");
+    glad_glDeleteQueries(n, ids);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id)
+{
+    glad_glIsQuery = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery");
+    return glad_glIsQuery(id);
+}
+
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id)
+{
+    glad_glBeginQuery = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery");
+    glad_glBeginQuery(target, id);
+}
+
+static void APIENTRY glad_lazy_glEndQuery(GLenum target)
+{
+    glad_glEndQuery = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery");
+    glad_glEndQuery(target);
+}
+
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+    glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv");
+    glad_glGetQueryiv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+    glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv");
+    glad_glGetQueryObjectiv(id, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+    glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv");
+    glad_glGetQueryObjectuiv(id, pname, params);
+}
+
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer)
+{
+    glad_glBindBuffer = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer");
+    glad_glBindBuffer(target, buffer);
+}
+
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers");
+    glad_glDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+    glad_glGenBuffers = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers");
+    glad_glGenBuffers(n, buffers);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer)
+{
+    glad_glIsBuffer = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer");
+    return glad_glIsBuffer(buffer);
+}
+
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    glad_glBufferData = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData");
+    glad_glBufferData(target, size, data, usage);
+}
+
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData");
+    glad_glBufferSubData(target, offset, size, data);
+}
+
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData");
+    glad_glGetBufferSubData(target, offset, size, data);
+}
+
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access)
+{
+    glad_glMapBuffer = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer");
+    return glad_glMapBuffer(target, access);
+}
+
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target)
+{
+    glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer");
+    return glad_glUnmapBuffer(target);
+}
+
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv");
+    glad_glGetBufferParameteriv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+    glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv");
+    glad_glGetBufferPointerv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate");
+    glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+    glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers");
+    glad_glDrawBuffers(n, bufs);
+}
+
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate");
+    glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate");
+    glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask)
+{
+    glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate");
+    glad_glStencilMaskSeparate(face, mask);
+}
+
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader)
+{
+    glad_glAttachShader = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader");
+    glad_glAttachShader(program, shader);
+}
+
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation");
+    glad_glBindAttribLocation(program, index, name);
+}
+
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader)
+{
+    glad_glCompileShader = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader");
+    glad_glCompileShader(shader);
+}
+
+static GLuint APIENTRY glad_lazy_glCreateProgram(void)
+{
+    glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram");
+    return glad_glCreateProgram();
+}
+
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type)
+{
+    glad_glCreateShader = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader");
+    return glad_glCreateShader(type);
+}
+
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program)
+{
+    glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram");
+    glad_glDeleteProgram(program);
+}
+
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader)
+{
+    glad_glDeleteShader = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader");
+    glad_glDeleteShader(shader);
+}
+
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader)
+{
+    glad_glDetachShader = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader");
+    glad_glDetachShader(program, shader);
+}
+
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index)
+{
+    glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray");
+    glad_glDisableVertexAttribArray(index);
+}
+
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index)
+{
+    glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray");
+    glad_glEnableVertexAttribArray(index);
+}
+
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib");
+    glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform");
+    glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders");
+    glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name)
+{
+    glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation");
+    return glad_glGetAttribLocation(program, name);
+}
+
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv");
+    glad_glGetProgramiv(program, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog");
+    glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv");
+    glad_glGetShaderiv(shader, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog");
+    glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource");
+    glad_glGetShaderSource(shader, bufSize, length, source);
+}
+
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+    glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation");
+    return glad_glGetUniformLocation(program, name);
+}
+
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+    glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv");
+    glad_glGetUniformfv(program, location, params);
+}
+
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params)
+{
+    glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv");
+    glad_glGetUniformiv(program, location, params);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+{
+    glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv");
+    glad_glGetVertexAttribdv(index, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+    glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv");
+    glad_glGetVertexAttribfv(index, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+    glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv");
+    glad_glGetVertexAttribiv(index, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+    glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv");
+    glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program)
+{
+    glad_glIsProgram = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram");
+    return glad_glIsProgram(program);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader)
+{
+    glad_glIsShader = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader");
+    return glad_glIsShader(shader);
+}
+
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program)
+{
+    glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram");
+    glad_glLinkProgram(program);
+}
+
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    glad_glShaderSource = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource");
+    glad_glShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY glad_lazy_glUseProgram(GLuint program)
+{
+    glad_glUseProgram = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram");
+    glad_glUseProgram(program);
+}
+
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0)
+{
+    glad_glUniform1f = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f");
+    glad_glUniform1f(location, v0);
+}
+
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    glad_glUniform2f = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f");
+    glad_glUniform2f(location, v0, v1);
+}
+
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    glad_glUniform3f = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f");
+    glad_glUniform3f(location, v0, v1, v2);
+}
+
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    glad_glUniform4f = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f");
+    glad_glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0)
+{
+    glad_glUniform1i = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i");
+    glad_glUniform1i(location, v0);
+}
+
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1)
+{
+    glad_glUniform2i = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i");
+    glad_glUniform2i(location, v0, v1);
+}
+
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    glad_glUniform3i = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i");
+    glad_glUniform3i(location, v0, v1, v2);
+}
+
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    glad_glUniform4i = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i");
+    glad_glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv");
+    glad_glUniform1fv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv");
+    glad_glUniform2fv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv");
+    glad_glUniform3fv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv");
+    glad_glUniform4fv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+    glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv");
+    glad_glUniform1iv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+    glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv");
+    glad_glUniform2iv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+    glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv");
+    glad_glUniform3iv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+    glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv");
+    glad_glUniform4iv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv");
+    glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv");
+    glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv");
+    glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program)
+{
+    glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram");
+    glad_glValidateProgram(program);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x)
+{
+    glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d");
+    glad_glVertexAttrib1d(index, x);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+{
+    glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv");
+    glad_glVertexAttrib1dv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x)
+{
+    glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f");
+    glad_glVertexAttrib1f(index, x);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+    glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv");
+    glad_glVertexAttrib1fv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x)
+{
+    glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s");
+    glad_glVertexAttrib1s(index, x);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv");
+    glad_glVertexAttrib1sv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+{
+    glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d");
+    glad_glVertexAttrib2d(index, x, y);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+{
+    glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv");
+    glad_glVertexAttrib2dv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+    glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f");
+    glad_glVertexAttrib2f(index, x, y);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+    glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv");
+    glad_glVertexAttrib2fv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+{
+    glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s");
+    glad_glVertexAttrib2s(index, x, y);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv");
+    glad_glVertexAttrib2sv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d");
+    glad_glVertexAttrib3d(index, x, y, z);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+{
+    glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv");
+    glad_glVertexAttrib3dv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f");
+    glad_glVertexAttrib3f(index, x, y, z);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+    glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv");
+    glad_glVertexAttrib3fv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s");
+    glad_glVertexAttrib3s(index, x, y, z);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv");
+    glad_glVertexAttrib3sv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+{
+    glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv");
+    glad_glVertexAttrib4Nbv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv");
+    glad_glVertexAttrib4Niv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv");
+    glad_glVertexAttrib4Nsv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub");
+    glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+{
+    glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv");
+    glad_glVertexAttrib4Nubv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv");
+    glad_glVertexAttrib4Nuiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+{
+    glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv");
+    glad_glVertexAttrib4Nusv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+{
+    glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv");
+    glad_glVertexAttrib4bv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d");
+    glad_glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+{
+    glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv");
+    glad_glVertexAttrib4dv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f");
+    glad_glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+    glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv");
+    glad_glVertexAttrib4fv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv");
+    glad_glVertexAttrib4iv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s");
+    glad_glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv");
+    glad_glVertexAttrib4sv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+{
+    glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv");
+    glad_glVertexAttrib4ubv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv");
+    glad_glVertexAttrib4uiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v)
+{
+    glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv");
+    glad_glVertexAttrib4usv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer");
+    glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv");
+    glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv");
+    glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv");
+    glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv");
+    glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv");
+    glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv");
+    glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    glad_glColorMaski = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski");
+    glad_glColorMaski(index, r, g, b, a);
+}
+
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+{
+    glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v");
+    glad_glGetBooleani_v(target, index, data);
+}
+
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v");
+    glad_glGetIntegeri_v(target, index, data);
+}
+
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index)
+{
+    glad_glEnablei = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei");
+    glad_glEnablei(target, index);
+}
+
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index)
+{
+    glad_glDisablei = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei");
+    glad_glDisablei(target, index);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index)
+{
+    glad_glIsEnabledi = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi");
+    return glad_glIsEnabledi(target, index);
+}
+
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode)
+{
+    glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback");
+    glad_glBeginTransformFeedback(primitiveMode);
+}
+
+static void APIENTRY glad_lazy_glEndTransformFeedback(void)
+{
+    glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback");
+    glad_glEndTransformFeedback();
+}
+
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange");
+    glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase");
+    glad_glBindBufferBase(target, index, buffer);
+}
+
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings");
+    glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying");
+    glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp)
+{
+    glad_glClampColor = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor");
+    glad_glClampColor(target, clamp);
+}
+
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode)
+{
+    glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender");
+    glad_glBeginConditionalRender(id, mode);
+}
+
+static void APIENTRY glad_lazy_glEndConditionalRender(void)
+{
+    glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender");
+    glad_glEndConditionalRender();
+}
+
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer");
+    glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+    glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv");
+    glad_glGetVertexAttribIiv(index, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+    glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv");
+    glad_glGetVertexAttribIuiv(index, pname, params);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x)
+{
+    glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i");
+    glad_glVertexAttribI1i(index, x);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+{
+    glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i");
+    glad_glVertexAttribI2i(index, x, y);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+{
+    glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i");
+    glad_glVertexAttribI3i(index, x, y, z);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i");
+    glad_glVertexAttribI4i(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x)
+{
+    glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui");
+    glad_glVertexAttribI1ui(index, x);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+{
+    glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui");
+    glad_glVertexAttribI2ui(index, x, y);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui");
+    glad_glVertexAttribI3ui(index, x, y, z);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui");
+    glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv");
+    glad_glVertexAttribI1iv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv");
+    glad_glVertexAttribI2iv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv");
+    glad_glVertexAttribI3iv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v)
+{
+    glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv");
+    glad_glVertexAttribI4iv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv");
+    glad_glVertexAttribI1uiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv");
+    glad_glVertexAttribI2uiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv");
+    glad_glVertexAttribI3uiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+    glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv");
+    glad_glVertexAttribI4uiv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+{
+    glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv");
+    glad_glVertexAttribI4bv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v)
+{
+    glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv");
+    glad_glVertexAttribI4sv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+{
+    glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv");
+    glad_glVertexAttribI4ubv(index, v);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v)
+{
+    glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv");
+    glad_glVertexAttribI4usv(index, v);
+}
+
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+    glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv");
+    glad_glGetUniformuiv(program, location, params);
+}
+
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+    glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation");
+    glad_glBindFragDataLocation(program, color, name);
+}
+
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name)
+{
+    glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation");
+    return glad_glGetFragDataLocation(program, name);
+}
+
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0)
+{
+    glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui");
+    glad_glUniform1ui(location, v0);
+}
+
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+    glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui");
+    glad_glUniform2ui(location, v0, v1);
+}
+
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui");
+    glad_glUniform3ui(location, v0, v1, v2);
+}
+
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui");
+    glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv");
+    glad_glUniform1uiv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv");
+    glad_glUniform2uiv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv");
+    glad_glUniform3uiv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv");
+    glad_glUniform4uiv(location, count, value);
+}
+
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+{
+    glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv");
+    glad_glTexParameterIiv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+{
+    glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv");
+    glad_glTexParameterIuiv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+{
+    glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv");
+    glad_glGetTexParameterIiv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+{
+    glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv");
+    glad_glGetTexParameterIuiv(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv");
+    glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv");
+    glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv");
+    glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi");
+    glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index)
+{
+    glad_glGetStringi = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi");
+    return glad_glGetStringi(name, index);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer)
+{
+    glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer");
+    return glad_glIsRenderbuffer(renderbuffer);
+}
+
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer");
+    glad_glBindRenderbuffer(target, renderbuffer);
+}
+
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers");
+    glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers");
+    glad_glGenRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage");
+    glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv");
+    glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer)
+{
+    glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer");
+    return glad_glIsFramebuffer(framebuffer);
+}
+
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer");
+    glad_glBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers");
+    glad_glDeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers");
+    glad_glGenFramebuffers(n, framebuffers);
+}
+
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target)
+{
+    glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus");
+    return glad_glCheckFramebufferStatus(target);
+}
+
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D");
+    glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D");
+    glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D");
+    glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer");
+    glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv");
+    glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target)
+{
+    glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap");
+    glad_glGenerateMipmap(target);
+}
+
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer");
+    glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample");
+    glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer");
+    glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange");
+    return glad_glMapBufferRange(target, offset, length, access);
+}
+
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange");
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array)
+{
+    glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray");
+    glad_glBindVertexArray(array);
+}
+
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays");
+    glad_glDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays");
+    glad_glGenVertexArrays(n, arrays);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array)
+{
+    glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray");
+    return glad_glIsVertexArray(array);
+}
+
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced");
+    glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced");
+    glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    glad_glTexBuffer = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer");
+    glad_glTexBuffer(target, internalformat, buffer);
+}
+
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index)
+{
+    glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex");
+    glad_glPrimitiveRestartIndex(index);
+}
+
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData");
+    glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices");
+    glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv");
+    glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName");
+    glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+    glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex");
+    return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv");
+    glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName");
+    glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding");
+    glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex");
+    glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex");
+    glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex");
+    glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex");
+    glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode)
+{
+    glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex");
+    glad_glProvokingVertex(mode);
+}
+
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags)
+{
+    glad_glFenceSync = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync");
+    return glad_glFenceSync(condition, flags);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync)
+{
+    glad_glIsSync = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync");
+    return glad_glIsSync(sync);
+}
+
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync)
+{
+    glad_glDeleteSync = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync");
+    glad_glDeleteSync(sync);
+}
+
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync");
+    return glad_glClientWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    glad_glWaitSync = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync");
+    glad_glWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data)
+{
+    glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v");
+    glad_glGetInteger64v(pname, data);
+}
+
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+    glad_glGetSynciv = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv");
+    glad_glGetSynciv(sync, pname, count, length, values);
+}
+
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+    glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v");
+    glad_glGetInteger64i_v(target, index, data);
+}
+
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+    glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v");
+    glad_glGetBufferParameteri64v(target, pname, params);
+}
+
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture");
+    glad_glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample");
+    glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample");
+    glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+{
+    glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv");
+    glad_glGetMultisamplefv(pname, index, val);
+}
+
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+{
+    glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski");
+    glad_glSampleMaski(maskNumber, mask);
+}
+
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed");
+    glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name)
+{
+    glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex");
+    return glad_glGetFragDataIndex(program, name);
+}
+
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+    glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers");
+    glad_glGenSamplers(count, samplers);
+}
+
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+    glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers");
+    glad_glDeleteSamplers(count, samplers);
+}
+
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler)
+{
+    glad_glIsSampler = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler");
+    return glad_glIsSampler(sampler);
+}
+
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler)
+{
+    glad_glBindSampler = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler");
+    glad_glBindSampler(unit, sampler);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri");
+    glad_glSamplerParameteri(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+    glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv");
+    glad_glSamplerParameteriv(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf");
+    glad_glSamplerParameterf(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv");
+    glad_glSamplerParameterfv(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+{
+    glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv");
+    glad_glSamplerParameterIiv(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+{
+    glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv");
+    glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+    glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv");
+    glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+{
+    glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv");
+    glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+    glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv");
+    glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+{
+    glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv");
+    glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target)
+{
+    glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter");
+    glad_glQueryCounter(id, target);
+}
+
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+{
+    glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v");
+    glad_glGetQueryObjecti64v(id, pname, params);
+}
+
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+    glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v");
+    glad_glGetQueryObjectui64v(id, pname, params);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor");
+    glad_glVertexAttribDivisor(index, divisor);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui");
+    glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv");
+    glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui");
+    glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv");
+    glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui");
+    glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv");
+    glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui");
+    glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv");
+    glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value)
+{
+    glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui");
+    glad_glVertexP2ui(type, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value)
+{
+    glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv");
+    glad_glVertexP2uiv(type, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value)
+{
+    glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui");
+    glad_glVertexP3ui(type, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value)
+{
+    glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv");
+    glad_glVertexP3uiv(type, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value)
+{
+    glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui");
+    glad_glVertexP4ui(type, value);
+}
+
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value)
+{
+    glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv");
+    glad_glVertexP4uiv(type, value);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords)
+{
+    glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui");
+    glad_glTexCoordP1ui(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+{
+    glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv");
+    glad_glTexCoordP1uiv(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords)
+{
+    glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui");
+    glad_glTexCoordP2ui(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+{
+    glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv");
+    glad_glTexCoordP2uiv(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords)
+{
+    glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui");
+    glad_glTexCoordP3ui(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+{
+    glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv");
+    glad_glTexCoordP3uiv(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords)
+{
+    glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui");
+    glad_glTexCoordP4ui(type, coords);
+}
+
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+{
+    glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv");
+    glad_glTexCoordP4uiv(type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+{
+    glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui");
+    glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv");
+    glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+{
+    glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui");
+    glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv");
+    glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+{
+    glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui");
+    glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv");
+    glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+{
+    glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui");
+    glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+{
+    glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv");
+    glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords)
+{
+    glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui");
+    glad_glNormalP3ui(type, coords);
+}
+
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords)
+{
+    glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv");
+    glad_glNormalP3uiv(type, coords);
+}
+
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color)
+{
+    glad_glColorP3ui = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui");
+    glad_glColorP3ui(type, color);
+}
+
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color)
+{
+    glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv");
+    glad_glColorP3uiv(type, color);
+}
+
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color)
+{
+    glad_glColorP4ui = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui");
+    glad_glColorP4ui(type, color);
+}
+
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color)
+{
+    glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv");
+    glad_glColorP4uiv(type, color);
+}
+
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color)
+{
+    glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui");
+    glad_glSecondaryColorP3ui(type, color);
+}
+
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+{
+    glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv");
+    glad_glSecondaryColorP3uiv(type, color);
+}
+
+int
+gladLoadGLLazy(GLADloadproc load)
+{
+    glad_lazy_load = load;
+    glad_lazy_resolved = 0;
+    GLVersion.major = 0;
+    GLVersion.minor = 0;
+    glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(!glad_glGetString)
+        return 0;
+    const char *version = (const char *)glad_glGetString(GL_VERSION);
+    if(!version || sscanf(version, "%d.%d", &GLVersion.major, &GLVersion.minor) != 2)
+        return 0;
+    GLAD_GL_VERSION_1_0 = (GLVersion.major == 1 && GLVersion.minor >= 0) || GLVersion.major > 1;
+    GLAD_GL_VERSION_1_1 = (GLVersion.major == 1 && GLVersion.minor >= 1) || GLVersion.major > 1;
+    GLAD_GL_VERSION_1_2 = (GLVersion.major == 1 && GLVersion.minor >= 2) || GLVersion.major > 1;
+    GLAD_GL_VERSION_1_3 = (GLVersion.major == 1 && GLVersion.minor >= 3) || GLVersion.major > 1;
+    GLAD_GL_VERSION_1_4 = (GLVersion.major == 1 && GLVersion.minor >= 4) || GLVersion.major > 1;
+    GLAD_GL_VERSION_1_5 = (GLVersion.major == 1 && GLVersion.minor >= 5) || GLVersion.major > 1;
+    GLAD_GL_VERSION_2_0 = (GLVersion.major == 2 && GLVersion.minor >= 0) || GLVersion.major > 2;
+    GLAD_GL_VERSION_2_1 = (GLVersion.major == 2 && GLVersion.minor >= 1) || GLVersion.major > 2;
+    GLAD_GL_VERSION_3_0 = (GLVersion.major == 3 && GLVersion.minor >= 0) || GLVersion.major > 3;
+    GLAD_GL_VERSION_3_1 = (GLVersion.major == 3 && GLVersion.minor >= 1) || GLVersion.major > 3;
+    GLAD_GL_VERSION_3_2 = (GLVersion.major == 3 && GLVersion.minor >= 2) || GLVersion.major > 3;
+    GLAD_GL_VERSION_3_3 = (GLVersion.major == 3 && GLVersion.minor >= 3) || GLVersion.major > 3;
+
+    glad_glCullFace = glad_lazy_glCullFace;
+    glad_glFrontFace = glad_lazy_glFrontFace;
+    glad_glHint = glad_lazy_glHint;
+    glad_glLineWidth = glad_lazy_glLineWidth;
+    glad_glPointSize = glad_lazy_glPointSize;
+    glad_glPolygonMode = glad_lazy_glPolygonMode;
+    glad_glScissor = glad_lazy_glScissor;
+    glad_glTexParameterf = glad_lazy_glTexParameterf;
+    glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+    glad_glTexParameteri = glad_lazy_glTexParameteri;
+    glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+    glad_glTexImage1D = glad_lazy_glTexImage1D;
+    glad_glTexImage2D = glad_lazy_glTexImage2D;
+    glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+    glad_glClear = glad_lazy_glClear;
+    glad_glClearColor = glad_lazy_glClearColor;
+    glad_glClearStencil = glad_lazy_glClearStencil;
+    glad_glClearDepth = glad_lazy_glClearDepth;
+    glad_glStencilMask = glad_lazy_glStencilMask;
+    glad_glColorMask = glad_lazy_glColorMask;
+    glad_glDepthMask = glad_lazy_glDepthMask;
+    glad_glDisable = glad_lazy_glDisable;
+    glad_glEnable = glad_lazy_glEnable;
+    glad_glFinish = glad_lazy_glFinish;
+    glad_glFlush = glad_lazy_glFlush;
+    glad_glBlendFunc = glad_lazy_glBlendFunc;
+    glad_glLogicOp = glad_lazy_glLogicOp;
+    glad_glStencilFunc = glad_lazy_glStencilFunc;
+    glad_glStencilOp = glad_lazy_glStencilOp;
+    glad_glDepthFunc = glad_lazy_glDepthFunc;
+    glad_glPixelStoref = glad_lazy_glPixelStoref;
+    glad_glPixelStorei = glad_lazy_glPixelStorei;
+    glad_glReadBuffer = glad_lazy_glReadBuffer;
+    glad_glReadPixels = glad_lazy_glReadPixels;
+    glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+    glad_glGetDoublev = glad_lazy_glGetDoublev;
+    glad_glGetError = glad_lazy_glGetError;
+    glad_glGetFloatv = glad_lazy_glGetFloatv;
+    glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+    glad_glGetTexImage = glad_lazy_glGetTexImage;
+    glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+    glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+    glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+    glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+    glad_glIsEnabled = glad_lazy_glIsEnabled;
+    glad_glDepthRange = glad_lazy_glDepthRange;
+    glad_glViewport = glad_lazy_glViewport;
+    glad_glDrawArrays = glad_lazy_glDrawArrays;
+    glad_glDrawElements = glad_lazy_glDrawElements;
+    glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+    glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+    glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+    glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+    glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+    glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+    glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+    glad_glBindTexture = glad_lazy_glBindTexture;
+    glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+    glad_glGenTextures = glad_lazy_glGenTextures;
+    glad_glIsTexture = glad_lazy_glIsTexture;
+    glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+    glad_glTexImage3D = glad_lazy_glTexImage3D;
+    glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+    glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+    glad_glActiveTexture = glad_lazy_glActiveTexture;
+    glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+    glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+    glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+    glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+    glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+    glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+    glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+    glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+    glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+    glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+    glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+    glad_glPointParameterf = glad_lazy_glPointParameterf;
+    glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+    glad_glPointParameteri = glad_lazy_glPointParameteri;
+    glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+    glad_glBlendColor = glad_lazy_glBlendColor;
+    glad_glBlendEquation = glad_lazy_glBlendEquation;
+    glad_glGenQueries = glad_lazy_glGenQueries;
+    glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+    glad_glIsQuery = glad_lazy_glIsQuery;
+    glad_glBeginQuery = glad_lazy_glBeginQuery;
+    glad_glEndQuery = glad_lazy_glEndQuery;
+    glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+    glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+    glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+    glad_glBindBuffer = glad_lazy_glBindBuffer;
+    glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+    glad_glGenBuffers = glad_lazy_glGenBuffers;
+    glad_glIsBuffer = glad_lazy_glIsBuffer;
+    glad_glBufferData = glad_lazy_glBufferData;
+    glad_glBufferSubData = glad_lazy_glBufferSubData;
+    glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+    glad_glMapBuffer = glad_lazy_glMapBuffer;
+    glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+    glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+    glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+    glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+    glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+    glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+    glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+    glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+    glad_glAttachShader = glad_lazy_glAttachShader;
+    glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+    glad_glCompileShader = glad_lazy_glCompileShader;
+    glad_glCreateProgram = glad_lazy_glCreateProgram;
+    glad_glCreateShader = glad_lazy_glCreateShader;
+    glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+    glad_glDeleteShader = glad_lazy_glDeleteShader;
+    glad_glDetachShader = glad_lazy_glDetachShader;
+    glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+    glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+    glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+    glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+    glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+    glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+    glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+    glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+    glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+    glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+    glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+    glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+    glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+    glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+    glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+    glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+    glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+    glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+    glad_glIsProgram = glad_lazy_glIsProgram;
+    glad_glIsShader = glad_lazy_glIsShader;
+    glad_glLinkProgram = glad_lazy_glLinkProgram;
+    glad_glShaderSource = glad_lazy_glShaderSource;
+    glad_glUseProgram = glad_lazy_glUseProgram;
+    glad_glUniform1f = glad_lazy_glUniform1f;
+    glad_glUniform2f = glad_lazy_glUniform2f;
+    glad_glUniform3f = glad_lazy_glUniform3f;
+    glad_glUniform4f = glad_lazy_glUniform4f;
+    glad_glUniform1i = glad_lazy_glUniform1i;
+    glad_glUniform2i = glad_lazy_glUniform2i;
+    glad_glUniform3i = glad_lazy_glUniform3i;
+    glad_glUniform4i = glad_lazy_glUniform4i;
+    glad_glUniform1fv = glad_lazy_glUniform1fv;
+    glad_glUniform2fv = glad_lazy_glUniform2fv;
+    glad_glUniform3fv = glad_lazy_glUniform3fv;
+    glad_glUniform4fv = glad_lazy_glUniform4fv;
+    glad_glUniform1iv = glad_lazy_glUniform1iv;
+    glad_glUniform2iv = glad_lazy_glUniform2iv;
+    glad_glUniform3iv = glad_lazy_glUniform3iv;
+    glad_glUniform4iv = glad_lazy_glUniform4iv;
+    glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+    glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+    glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+    glad_glValidateProgram = glad_lazy_glValidateProgram;
+    glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+    glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+    glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+    glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+    glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+    glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+    glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+    glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+    glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+    glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+    glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+    glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+    glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+    glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+    glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+    glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+    glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+    glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+    glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+    glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+    glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+    glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+    glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+    glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+    glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+    glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+    glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+    glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+    glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+    glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+    glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+    glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+    glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+    glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+    glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+    glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+    glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+    glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+    glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+    glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+    glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+    glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+    glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+    glad_glColorMaski = glad_lazy_glColorMaski;
+    glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+    glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+    glad_glEnablei = glad_lazy_glEnablei;
+    glad_glDisablei = glad_lazy_glDisablei;
+    glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+    glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+    glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+    glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+    glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+    glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+    glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+    glad_glClampColor = glad_lazy_glClampColor;
+    glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+    glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+    glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+    glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+    glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+    glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+    glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+    glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+    glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+    glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+    glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+    glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+    glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+    glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+    glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+    glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+    glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+    glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+    glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+    glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+    glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+    glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+    glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+    glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+    glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+    glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+    glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+    glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+    glad_glUniform1ui = glad_lazy_glUniform1ui;
+    glad_glUniform2ui = glad_lazy_glUniform2ui;
+    glad_glUniform3ui = glad_lazy_glUniform3ui;
+    glad_glUniform4ui = glad_lazy_glUniform4ui;
+    glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+    glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+    glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+    glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+    glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+    glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+    glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+    glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+    glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+    glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+    glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+    glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+    glad_glGetStringi = glad_lazy_glGetStringi;
+    glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+    glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+    glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+    glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+    glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+    glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+    glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+    glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+    glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+    glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+    glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+    glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+    glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+    glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+    glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+    glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+    glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+    glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+    glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+    glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+    glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+    glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+    glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+    glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+    glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+    glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+    glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+    glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+    glad_glTexBuffer = glad_lazy_glTexBuffer;
+    glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+    glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+    glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+    glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+    glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+    glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+    glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+    glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+    glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+    glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+    glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+    glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+    glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+    glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+    glad_glFenceSync = glad_lazy_glFenceSync;
+    glad_glIsSync = glad_lazy_glIsSync;
+    glad_glDeleteSync = glad_lazy_glDeleteSync;
+    glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+    glad_glWaitSync = glad_lazy_glWaitSync;
+    glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+    glad_glGetSynciv = glad_lazy_glGetSynciv;
+    glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+    glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+    glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+    glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+    glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+    glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+    glad_glSampleMaski = glad_lazy_glSampleMaski;
+    glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+    glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+    glad_glGenSamplers = glad_lazy_glGenSamplers;
+    glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+    glad_glIsSampler = glad_lazy_glIsSampler;
+    glad_glBindSampler = glad_lazy_glBindSampler;
+    glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+    glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+    glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+    glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+    glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+    glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+    glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+    glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+    glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+    glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+    glad_glQueryCounter = glad_lazy_glQueryCounter;
+    glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+    glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+    glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+    glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+    glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+    glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+    glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+    glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+    glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+    glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+    glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+    glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+    glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+    glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+    glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+    glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+    glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+    glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+    glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+    glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+    glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+    glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+    glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+    glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+    glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+    glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+    glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+    glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+    glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+    glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+    glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+    glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+    glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+    glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+    glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+    glad_glColorP3ui = glad_lazy_glColorP3ui;
+    glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+    glad_glColorP4ui = glad_lazy_glColorP4ui;
+    glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+    glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+    glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+    return 1;
+}
@@ -0,0 +1,21 @@
+#ifndef __GLAD_LAZY__H__
+#define __GLAD_LAZY__H__
+
+#include <glad/glad.h>
+
+/*
+ * gladLoadGLLoader looks up every entry point up to 3.3 before the first
+ * draw. gladLoadGLLazy only looks up glGetString for the version check
+ * and leaves each glad_gl* pointing at a stub that resolves the function
+ * the first time it is called, so a program pays for the few dozen it
+ * uses. A function the driver doesn't have exits with its name on first
+ * call instead of crashing on a NULL pointer. Generated by
+ * tools/glad_lazy.c, the context must be current on first call just as
+ * it must be for gladLoadGLLoader.
+ */
+
+extern unsigned int glad_lazy_resolved;     /* entry points looked up so far */
+
+int gladLoadGLLazy(GLADloadproc load);
+
+#endif
@@ -0,0 +1,63 @@
+#include <glad/glad.h>
+
+#include "gpu_timer.h"
+
+void
+gpu_timer_init(GpuTimer *t)
+{
+    glGenQueries(GPU_TIMER_LATENCY, t->begin);
+    glGenQueries(GPU_TIMER_LATENCY, t->end);
+    t->frame = 0;
+    t->last_ms = 0.0;
+    gpu_timer_reset(t);
+}
+
+void
+gpu_timer_begin(GpuTimer *t)
+{
+    glQueryCounter(t->begin[t->frame % GPU_TIMER_LATENCY], GL_TIMESTAMP);
+}
+
+void
+gpu_timer_end(GpuTimer *t)
+{
+    glQueryCounter(t->end[t->frame % GPU_TIMER_LATENCY], GL_TIMESTAMP);
+    t->frame++;
+
+    if(t->frame < GPU_TIMER_LATENCY)
+        return;
+
+    /* oldest slot, the one that will be overwritten next */
+    unsigned int slot = t->frame % GPU_TIMER_LATENCY;
+    GLint available = 0;
+    glGetQueryObjectiv(t->end[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+    if(!available)
+        return;
+
+    GLuint64 begin, end;
+    glGetQueryObjectui64v(t->begin[slot], GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(t->end[slot], GL_QUERY_RESULT, &end);
+    t->last_ms = (double)(end - begin) / 1000000.0;
+    t->total_ms += t->last_ms;
+    t->samples++;
+}
+
+double
+gpu_timer_average(GpuTimer *t)
+{
+    return t->samples ? t->total_ms / t->samples : 0.0;
+}
+
+void
+gpu_timer_reset(GpuTimer *t)
+{
+    t->total_ms = 0.0;
+    t->samples = 0;
+}
+
+void
+gpu_timer_destroy(GpuTimer *t)
+{
+    glDeleteQueries(GPU_TIMER_LATENCY, t->begin);
+    glDeleteQueries(GPU_TIMER_LATENCY, t->end);
+}
@@ -0,0 +1,24 @@
+#ifndef __GPU_TIMER__H__
+#define __GPU_TIMER__H__
+
+/* Timestamp queries are read back GPU_TIMER_LATENCY frames late so that
+ * asking for the result never stalls the pipeline. */
+#define GPU_TIMER_LATENCY 4
+
+typedef struct {
+    unsigned int begin[GPU_TIMER_LATENCY];
+    unsigned int end[GPU_TIMER_LATENCY];
+    unsigned int frame;
+    double last_ms;
+    double total_ms;
+    unsigned int samples;
+} GpuTimer;
+
+void gpu_timer_init(GpuTimer *t);
+void gpu_timer_begin(GpuTimer *t);
+void gpu_timer_end(GpuTimer *t);
+double gpu_timer_average(GpuTimer *t);
+void gpu_timer_reset(GpuTimer *t);
+void gpu_timer_destroy(GpuTimer *t);
+
+#endif
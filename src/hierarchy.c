@@ -0,0 +1,293 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hierarchy.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+static void *
+checked_alloc(size_t size)
+{
+    void *p = aligned_alloc(16, (size + 15) & ~(size_t)15);
+    if(!p) {
+        ERROR_EXIT(1, "Couldn't allocate transform hierarchy\n");
+    }
+    return p;
+}
+
+void
+hierarchy_init(Hierarchy *h, u32 capacity)
+{
+    memset(h, 0, sizeof(*h));
+    h->capacity = capacity;
+    h->parent = checked_alloc(sizeof(u32) * capacity);
+    h->depth = checked_alloc(capacity);
+    h->dirty = checked_alloc(capacity);
+    h->position = checked_alloc(sizeof(vec3) * capacity);
+    h->angle = checked_alloc(sizeof(float) * capacity);
+    h->scale = checked_alloc(sizeof(vec3) * capacity);
+    h->world = checked_alloc(sizeof(mat4x4) * capacity);
+    h->handle_of = checked_alloc(sizeof(u32) * capacity);
+    h->slot_of = checked_alloc(sizeof(u32) * capacity);
+    h->parent_handle = checked_alloc(sizeof(u32) * capacity);
+    h->first_child = checked_alloc(sizeof(u32) * capacity);
+    h->next_sibling = checked_alloc(sizeof(u32) * capacity);
+    h->prev_sibling = checked_alloc(sizeof(u32) * capacity);
+    h->free_handles = checked_alloc(sizeof(u32) * capacity);
+}
+
+void
+hierarchy_destroy(Hierarchy *h)
+{
+    free(h->parent);
+    free(h->depth);
+    free(h->dirty);
+    free(h->position);
+    free(h->angle);
+    free(h->scale);
+    free(h->world);
+    free(h->handle_of);
+    free(h->slot_of);
+    free(h->parent_handle);
+    free(h->first_child);
+    free(h->next_sibling);
+    free(h->prev_sibling);
+    free(h->free_handles);
+}
+
+static void
+hierarchy_link(Hierarchy *h, u32 node, u32 parent)
+{
+    h->parent_handle[node] = parent;
+    h->prev_sibling[node] = HIERARCHY_NONE;
+    h->next_sibling[node] = HIERARCHY_NONE;
+    if(parent == HIERARCHY_NONE)
+        return;
+    u32 next = h->first_child[parent];
+    h->next_sibling[node] = next;
+    if(next != HIERARCHY_NONE)
+        h->prev_sibling[next] = node;
+    h->first_child[parent] = node;
+}
+
+static void
+hierarchy_unlink(Hierarchy *h, u32 node)
+{
+    u32 parent = h->parent_handle[node];
+    if(parent == HIERARCHY_NONE)
+        return;
+    u32 prev = h->prev_sibling[node], next = h->next_sibling[node];
+    if(prev != HIERARCHY_NONE)
+        h->next_sibling[prev] = next;
+    else
+        h->first_child[parent] = next;
+    if(next != HIERARCHY_NONE)
+        h->prev_sibling[next] = prev;
+    h->parent_handle[node] = HIERARCHY_NONE;
+}
+
+static void sort_breadth_first(Hierarchy *h);
+
+u32
+hierarchy_add(Hierarchy *h, u32 parent, const vec3 position, float angle, const vec3 scale)
+{
+    // holes left by removes this frame still take slots, compact them early instead of failing
+    if(h->count == h->capacity && h->free_count)
+        sort_breadth_first(h);
+    if(h->count == h->capacity) {
+        ERROR_EXIT(1, "Transform hierarchy is full (%u nodes)\n", h->capacity);
+    }
+    u32 node = h->free_count ? h->free_handles[--h->free_count] : h->next_handle++;
+    u32 slot = h->count++;
+    u32 depth = parent == HIERARCHY_NONE ? 0 : h->depth[h->slot_of[parent]] + 1u;
+    if(depth >= HIERARCHY_MAX_DEPTH) {
+        ERROR_EXIT(1, "Transform hierarchy deeper than %d\n", HIERARCHY_MAX_DEPTH);
+    }
+
+    // appending keeps breadth first order only if nothing deeper precedes it
+    if(slot > 0 && depth < h->depth[slot - 1])
+        h->needs_sort = true;
+    if(!h->needs_sort) {
+        if(depth == h->level_count)
+            h->level_start[h->level_count++] = slot;
+        h->level_start[h->level_count] = h->count;
+    }
+
+    h->slot_of[node] = slot;
+    h->first_child[node] = HIERARCHY_NONE;
+    hierarchy_link(h, node, parent);
+    h->handle_of[slot] = node;
+    h->parent[slot] = parent == HIERARCHY_NONE ? HIERARCHY_NONE : h->slot_of[parent];
+    h->depth[slot] = (u8)depth;
+    h->dirty[slot] = 1;
+    vec3_dup(h->position[slot], position);
+    h->angle[slot] = angle;
+    vec3_dup(h->scale[slot], scale);
+    return node;
+}
+
+/*
+ * Children of a removed node are attached to its parent with their
+ * local transform unchanged.
+ */
+void
+hierarchy_remove(Hierarchy *h, u32 node)
+{
+    u32 slot = h->slot_of[node];
+    u32 parent = h->parent_handle[node];
+    for(u32 child = h->first_child[node], next; child != HIERARCHY_NONE; child = next) {
+        next = h->next_sibling[child];
+        hierarchy_link(h, child, parent);
+        h->dirty[h->slot_of[child]] = 1;
+    }
+    h->first_child[node] = HIERARCHY_NONE;
+    hierarchy_unlink(h, node);
+
+    // leave a hole, the next update compacts
+    h->handle_of[slot] = HIERARCHY_NONE;
+    h->slot_of[node] = HIERARCHY_NONE;
+    h->free_handles[h->free_count++] = node;
+    h->needs_sort = true;
+}
+
+void
+hierarchy_set_parent(Hierarchy *h, u32 node, u32 parent)
+{
+    for(u32 p = parent; p != HIERARCHY_NONE; p = h->parent_handle[p]) {
+        if(p == node) {
+            ERROR_EXIT(1, "Transform hierarchy cycle through node %u\n", node);
+        }
+    }
+    hierarchy_unlink(h, node);
+    hierarchy_link(h, node, parent);
+    h->dirty[h->slot_of[node]] = 1;
+    h->needs_sort = true;
+}
+
+void
+hierarchy_set_local(Hierarchy *h, u32 node, const vec3 position, float angle, const vec3 scale)
+{
+    u32 slot = h->slot_of[node];
+    vec3_dup(h->position[slot], position);
+    h->angle[slot] = angle;
+    vec3_dup(h->scale[slot], scale);
+    h->dirty[slot] = 1;
+}
+
+void
+hierarchy_set_position(Hierarchy *h, u32 node, const vec3 position)
+{
+    u32 slot = h->slot_of[node];
+    vec3_dup(h->position[slot], position);
+    h->dirty[slot] = 1;
+}
+
+#define PERMUTE(field, type)                                          \
+    do {                                                              \
+        type *out = checked_alloc(sizeof(type) * h->capacity);        \
+        for(u32 i = 0; i < old_count; i++)                            \
+            if(order[i] != HIERARCHY_NONE)                            \
+                memcpy(&out[order[i]], &h->field[i], sizeof(type));   \
+        free(h->field);                                               \
+        h->field = out;                                               \
+    } while(0)
+
+/* Counting sort of the live slots by depth, stable so siblings keep their order. */
+static void
+sort_breadth_first(Hierarchy *h)
+{
+    u32 old_count = h->count;
+    u32 *order = checked_alloc(sizeof(u32) * (old_count + 1));
+    u32 level_size[HIERARCHY_MAX_DEPTH] = { 0 };
+
+    h->level_count = 0;
+    for(u32 i = 0; i < old_count; i++) {
+        u32 node = h->handle_of[i];
+        if(node == HIERARCHY_NONE)
+            continue;
+        u32 depth = 0;
+        for(u32 p = h->parent_handle[node]; p != HIERARCHY_NONE; p = h->parent_handle[p])
+            depth++;
+        if(depth >= HIERARCHY_MAX_DEPTH) {
+            ERROR_EXIT(1, "Transform hierarchy deeper than %d\n", HIERARCHY_MAX_DEPTH);
+        }
+        h->depth[i] = (u8)depth;
+        level_size[depth]++;
+        if(depth + 1 > h->level_count)
+            h->level_count = depth + 1;
+    }
+    u32 next[HIERARCHY_MAX_DEPTH];
+    u32 total = 0;
+    for(u32 d = 0; d < h->level_count; d++) {
+        h->level_start[d] = next[d] = total;
+        total += level_size[d];
+    }
+    h->level_start[h->level_count] = total;
+    for(u32 i = 0; i < old_count; i++)
+        order[i] = h->handle_of[i] == HIERARCHY_NONE ? HIERARCHY_NONE : next[h->depth[i]]++;
+
+    PERMUTE(depth, u8);
+    PERMUTE(dirty, u8);
+    PERMUTE(position, vec3);
+    PERMUTE(angle, float);
+    PERMUTE(scale, vec3);
+    PERMUTE(world, mat4x4);
+    PERMUTE(handle_of, u32);
+    free(order);
+
+    h->count = total;
+    for(u32 i = 0; i < total; i++)
+        h->slot_of[h->handle_of[i]] = i;
+    for(u32 i = 0; i < total; i++) {
+        u32 parent = h->parent_handle[h->handle_of[i]];
+        h->parent[i] = parent == HIERARCHY_NONE ? HIERARCHY_NONE : h->slot_of[parent];
+    }
+    h->needs_sort = false;
+}
+
+/*
+ * Recomputes the world matrices of dirty nodes and everything below
+ * them. Returns how many were recomputed.
+ */
+u32
+hierarchy_update(Hierarchy *h)
+{
+    if(h->needs_sort)
+        sort_breadth_first(h);
+
+    h->updated = 0;
+    h->dirty_begin = h->count;
+    h->dirty_end = 0;
+    for(u32 i = 0; i < h->count; i++) {
+        u32 parent = h->parent[i];
+        if(parent != HIERARCHY_NONE && h->dirty[parent])
+            h->dirty[i] = 1;
+        if(!h->dirty[i])
+            continue;
+
+        // translate * rotate_y * scale written out
+        float c = cosf(h->angle[i]), s = sinf(h->angle[i]);
+        const float *k = h->scale[i];
+        mat4x4 local = {
+            {  c * k[0], 0.0f, -s * k[0], 0.0f },
+            {  0.0f,     k[1],  0.0f,     0.0f },
+            {  s * k[2], 0.0f,  c * k[2], 0.0f },
+            { h->position[i][0], h->position[i][1], h->position[i][2], 1.0f },
+        };
+        if(parent == HIERARCHY_NONE)
+            mat4x4_dup(h->world[i], local);
+        else
+            mat4x4_mul(h->world[i], h->world[parent], local);
+
+        if(i < h->dirty_begin)
+            h->dirty_begin = i;
+        h->dirty_end = i + 1;
+        h->updated++;
+    }
+    // cleared only after the pass, children above read their parent's flag
+    if(h->updated)
+        memset(h->dirty + h->dirty_begin, 0, h->dirty_end - h->dirty_begin);
+    return h->updated;
+}
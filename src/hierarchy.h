@@ -0,0 +1,72 @@
+#ifndef __HIERARCHY__H__
+#define __HIERARCHY__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+
+/*
+ * Parent/child transforms stored breadth first: all roots, then all
+ * depth 1 nodes and so on, so a parent always sits before its children
+ * and one linear pass propagates changes. Nodes are addressed by stable
+ * handles, slots move when the structure changes.
+ *
+ * Only nodes marked dirty, and their subtrees, are recomputed. World
+ * matrices are one contiguous 16 byte aligned array in slot order,
+ * [dirty_begin, dirty_end) is the range the last update wrote, so an
+ * upload can be limited to it.
+ */
+
+#define HIERARCHY_NONE 0xffffffffu
+#define HIERARCHY_MAX_DEPTH 32
+
+typedef struct {
+    u32 count;
+    u32 capacity;
+
+    /* per slot, breadth first */
+    u32 *parent;              /* slot of the parent, HIERARCHY_NONE for roots */
+    u8 *depth;
+    u8 *dirty;
+    vec3 *position;           /* local translate * rotate about y * scale */
+    float *angle;
+    vec3 *scale;
+    mat4x4 *world;
+    u32 *handle_of;
+
+    /* per handle */
+    u32 *slot_of;             /* HIERARCHY_NONE for free handles */
+    u32 *parent_handle;
+    u32 *first_child;         /* children of a node as a doubly linked list, roots are not linked */
+    u32 *next_sibling;
+    u32 *prev_sibling;
+    u32 *free_handles;
+    u32 free_count;
+    u32 next_handle;
+
+    u32 level_count;
+    u32 level_start[HIERARCHY_MAX_DEPTH + 1];
+    bool needs_sort;
+
+    /* results of the last hierarchy_update */
+    u32 dirty_begin, dirty_end;
+    u32 updated;
+} Hierarchy;
+
+void hierarchy_init(Hierarchy *h, u32 capacity);
+void hierarchy_destroy(Hierarchy *h);
+
+u32 hierarchy_add(Hierarchy *h, u32 parent, const vec3 position, float angle, const vec3 scale);
+void hierarchy_remove(Hierarchy *h, u32 node);
+void hierarchy_set_parent(Hierarchy *h, u32 node, u32 parent);
+void hierarchy_set_local(Hierarchy *h, u32 node, const vec3 position, float angle, const vec3 scale);
+void hierarchy_set_position(Hierarchy *h, u32 node, const vec3 position);
+u32 hierarchy_update(Hierarchy *h);
+
+static inline float *
+hierarchy_world(Hierarchy *h, u32 node)
+{
+    return &h->world[h->slot_of[node]][0][0];
+}
+
+#endif
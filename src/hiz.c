@@ -0,0 +1,254 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hiz.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+static void
+hiz_create_targets(HiZ *h, int width, int height)
+{
+    h->width = width;
+    h->height = height;
+    h->levels = 1;
+    while((width | height) >> h->levels)
+        h->levels++;
+
+    glGenTextures(1, &h->pyramid_tex);
+    glBindTexture(GL_TEXTURE_2D, h->pyramid_tex);
+    for(int level = 0; level < h->levels; level++) {
+        int w = width >> level > 0 ? width >> level : 1, hh = height >> level > 0 ? height >> level : 1;
+        glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, w, hh, 0, GL_RED, GL_FLOAT, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, h->levels - 1);
+    glGenFramebuffers(1, &h->pyramid_fbo);
+
+    // the default framebuffer's depth can't be sampled, it is blitted here first
+    glGenTextures(1, &h->depth_tex);
+    glBindTexture(GL_TEXTURE_2D, h->depth_tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, width, height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glGenFramebuffers(1, &h->depth_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, h->depth_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, h->depth_tex, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        ERROR_EXIT(1, "Hi-Z depth framebuffer is not complete\n");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void
+hiz_destroy_targets(HiZ *h)
+{
+    unsigned int textures[] = { h->pyramid_tex, h->depth_tex };
+    unsigned int framebuffers[] = { h->pyramid_fbo, h->depth_fbo };
+    glDeleteTextures(2, textures);
+    glDeleteFramebuffers(2, framebuffers);
+}
+
+void
+hiz_init(HiZ *h, unsigned int copy_program, unsigned int reduce_program, unsigned int test_shader, int capacity,
+         Arena *arena)
+{
+    memset(h, 0, sizeof(*h));
+    h->copy_program = copy_program;
+    h->reduce_program = reduce_program;
+    h->capacity = capacity;
+    h->boxes = ARENA_ARRAY(arena, float, 6 * capacity);
+    h->objects = ARENA_ARRAY(arena, int, capacity);
+
+    // a vertex shader alone, its only output is captured
+    const char *varyings[] = { "visible" };
+    h->test_program = glCreateProgram();
+    glAttachShader(h->test_program, test_shader);
+    glTransformFeedbackVaryings(h->test_program, 1, varyings, GL_INTERLEAVED_ATTRIBS);
+    glLinkProgram(h->test_program);
+    int success;
+    char info[512];
+    glGetProgramiv(h->test_program, GL_LINK_STATUS, &success);
+    if(!success) {
+        glGetProgramInfoLog(h->test_program, sizeof(info), NULL, info);
+        ERROR_EXIT(1, "Hi-Z test program link failed %s\n", info);
+    }
+    glDeleteShader(test_shader);
+
+    glGenVertexArrays(1, &h->empty_vao);
+    glGenVertexArrays(1, &h->box_vao);
+    glGenBuffers(1, &h->box_vbo);
+    glGenBuffers(1, &h->result_vbo);
+    glBindVertexArray(h->box_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, h->box_vbo);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+
+    gpu_timer_init(&h->timer);
+}
+
+/*
+ * depth_texture is a sampleable depth buffer of width x height, 0 takes
+ * the default framebuffer's. The frame covered view_width x view_height
+ * of it, which is stretched over the pyramid, so the pyramid keeps its
+ * size while dynamic resolution moves. Leaves framebuffer 0 bound.
+ */
+void
+hiz_build(HiZ *h, unsigned int depth_texture, int width, int height, int view_width, int view_height)
+{
+    if(width != h->width || height != h->height) {
+        if(h->pyramid_tex)
+            hiz_destroy_targets(h);
+        hiz_create_targets(h, width, height);
+        h->tested = 0;
+    }
+    gpu_timer_begin(&h->timer);
+
+    unsigned int source = depth_texture;
+    if(!source) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, h->depth_fbo);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        source = h->depth_tex;
+    }
+
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(h->empty_vao);
+    glBindFramebuffer(GL_FRAMEBUFFER, h->pyramid_fbo);
+    glActiveTexture(GL_TEXTURE0);
+
+    glUseProgram(h->copy_program);
+    glUniform1i(glGetUniformLocation(h->copy_program, "depthTexture"), 0);
+    glUniform2f(glGetUniformLocation(h->copy_program, "viewScale"), (float)view_width / width, (float)view_height / height);
+    glBindTexture(GL_TEXTURE_2D, source);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, h->pyramid_tex, 0);
+    glViewport(0, 0, width, height);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glUseProgram(h->reduce_program);
+    glUniform1i(glGetUniformLocation(h->reduce_program, "depthPyramid"), 0);
+    glBindTexture(GL_TEXTURE_2D, h->pyramid_tex);
+    for(int level = 1; level < h->levels; level++) {
+        // only the level above is visible to the pass, so it never samples what it renders to
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, h->pyramid_tex, level);
+        glViewport(0, 0, width >> level > 0 ? width >> level : 1, height >> level > 0 ? height >> level : 1);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, h->levels - 1);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, width, height);
+    glEnable(GL_DEPTH_TEST);
+}
+
+/* Tests the boxes against the pyramid just built, view_projection must be the one that rendered its depth. */
+void
+hiz_test(HiZ *h, const vec3 *box_min, const vec3 *box_max, const int *objects, int count, mat4x4 view_projection,
+         u64 frame)
+{
+    if(count > h->capacity)
+        count = h->capacity;    // the rest stay visible
+    for(int i = 0; i < count; i++) {
+        int object = objects[i];
+        memcpy(&h->boxes[i * 6], box_min[object], sizeof(vec3));
+        memcpy(&h->boxes[i * 6 + 3], box_max[object], sizeof(vec3));
+        h->objects[i] = object;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, h->box_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * count, h->boxes, GL_STREAM_DRAW);
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, h->result_vbo);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, sizeof(float) * count, NULL, GL_STREAM_READ);
+
+    glUseProgram(h->test_program);
+    glUniformMatrix4fv(glGetUniformLocation(h->test_program, "viewProjection"), 1, GL_FALSE, (GLfloat *)view_projection);
+    glUniform1i(glGetUniformLocation(h->test_program, "depthPyramid"), 0);
+    glUniform1i(glGetUniformLocation(h->test_program, "levelCount"), h->levels);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, h->pyramid_tex);
+    glBindVertexArray(h->box_vao);
+
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, h->result_vbo);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, count);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(0);
+
+    if(h->fence)
+        glDeleteSync(h->fence);
+    h->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    h->tested = count;
+    h->tested_frame = frame;
+    gpu_timer_end(&h->timer);
+}
+
+/*
+ * Marks the objects the test of the previous frame found hidden. Never
+ * waits, returns false (and marks nothing) when there is no such test
+ * or the GPU hasn't finished it.
+ */
+bool
+hiz_results(HiZ *h, u64 frame, u8 *occluded, int object_count)
+{
+    memset(occluded, 0, object_count);
+    if(!h->fence || !h->tested || h->tested_frame + 1 != frame)
+        return false;
+    GLenum status = glClientWaitSync(h->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return false;
+
+    glBindBuffer(GL_ARRAY_BUFFER, h->result_vbo);
+    const float *visible = glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(float) * h->tested, GL_MAP_READ_BIT);
+    if(!visible)
+        return false;
+    for(int i = 0; i < h->tested; i++) {
+        if(visible[i] == 0.0f && h->objects[i] < object_count)
+            occluded[h->objects[i]] = 1;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    return true;
+}
+
+size_t
+hiz_memory(const HiZ *h)
+{
+    size_t bytes = (size_t)h->width * h->height * 4;
+    for(int level = 0; level < h->levels; level++) {
+        size_t w = h->width >> level > 0 ? h->width >> level : 1, hh = h->height >> level > 0 ? h->height >> level : 1;
+        bytes += w * hh * sizeof(float);
+    }
+    return bytes;
+}
+
+void
+hiz_destroy(HiZ *h)
+{
+    if(h->pyramid_tex)
+        hiz_destroy_targets(h);
+    if(h->fence)
+        glDeleteSync(h->fence);
+    glDeleteProgram(h->copy_program);
+    glDeleteProgram(h->reduce_program);
+    glDeleteProgram(h->test_program);
+    unsigned int vaos[] = { h->empty_vao, h->box_vao };
+    unsigned int buffers[] = { h->box_vbo, h->result_vbo };
+    glDeleteVertexArrays(2, vaos);
+    glDeleteBuffers(2, buffers);
+    gpu_timer_destroy(&h->timer);
+}
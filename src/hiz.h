@@ -0,0 +1,54 @@
+#ifndef __HIZ__H__
+#define __HIZ__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "gpu_timer.h"
+#include "memory.h"
+
+/*
+ * Hierarchical Z on the GPU. At the end of a frame hiz_build copies the
+ * depth buffer into level 0 of an R32F texture and reduces it to a max
+ * pyramid with fragment passes, then hiz_test runs the box tests of
+ * occlusion.h in a vertex shader, one point per box, and captures the
+ * answers with transform feedback. There is no compute in GL 3.3.
+ *
+ * The answers are read after the swap, when the GPU is done with them,
+ * and decide which objects the next frame draws. An object that comes
+ * out from behind an occluder therefore shows up one frame late.
+ */
+
+typedef struct {
+    unsigned int copy_program;
+    unsigned int reduce_program;
+    unsigned int test_program;
+    unsigned int pyramid_tex;
+    unsigned int pyramid_fbo;
+    unsigned int depth_tex;       /* copy of the default framebuffer's depth */
+    unsigned int depth_fbo;
+    unsigned int empty_vao;
+    unsigned int box_vao;
+    unsigned int box_vbo;
+    unsigned int result_vbo;
+    int width, height, levels;
+
+    float *boxes;                 /* staging, 6 floats per box */
+    int *objects;                 /* object index of every tested box */
+    int capacity;                 /* boxes per test */
+    int tested;
+    u64 tested_frame;
+    void *fence;
+    GpuTimer timer;
+} HiZ;
+
+void hiz_init(HiZ *h, unsigned int copy_program, unsigned int reduce_program, unsigned int test_shader, int capacity,
+              Arena *arena);
+void hiz_build(HiZ *h, unsigned int depth_texture, int width, int height, int view_width, int view_height);
+void hiz_test(HiZ *h, const vec3 *box_min, const vec3 *box_max, const int *objects, int count,
+              mat4x4 view_projection, u64 frame);
+bool hiz_results(HiZ *h, u64 frame, u8 *occluded, int object_count);
+size_t hiz_memory(const HiZ *h);
+void hiz_destroy(HiZ *h);
+
+#endif
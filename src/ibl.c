@@ -0,0 +1,314 @@
+#include <glad/glad.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ibl.h"
+#include "shader.h"
+#include "timing.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+#define ALIGN16(x) (((x) + 15u) & ~15u)
+
+/* the cache is stale once any of these change */
+static const char *ibl_generators[] = { "shaders/ibl_sky.fs", "shaders/ibl_irradiance.fs", "shaders/ibl_prefilter.fs" };
+
+static int
+ibl_level_size(int size, int level)
+{
+    return size >> level > 0 ? size >> level : 1;
+}
+
+static u32
+ibl_cube_bytes(int size, int levels)
+{
+    u32 bytes = 0;
+    for(int level = 0; level < levels; level++)
+        bytes += 6u * ibl_level_size(size, level) * ibl_level_size(size, level) * 8u;
+    return bytes;
+}
+
+/* FNV-1a over the generating shaders. */
+static u32
+ibl_source_hash(Assets *assets, Arena *scratch)
+{
+    u32 hash = 2166136261u;
+    size_t mark = arena_mark(scratch);
+    for(size_t i = 0; i < sizeof(ibl_generators) / sizeof(ibl_generators[0]); i++) {
+        size_t size;
+        const char *source = assets_read(assets, ibl_generators[i], scratch, &size);
+        for(size_t k = 0; k < size; k++)
+            hash = (hash ^ (u8)source[k]) * 16777619u;
+    }
+    arena_pop_to(scratch, mark);
+    return hash;
+}
+
+static unsigned int
+ibl_cubemap(int size, int levels, const u8 *data)
+{
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, texture);
+    for(int level = 0; level < levels; level++) {
+        int s = ibl_level_size(size, level);
+        for(int face = 0; face < 6; face++) {
+            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, GL_RGBA16F, s, s, 0, GL_RGBA, GL_HALF_FLOAT, data);
+            if(data)
+                data += (size_t)s * s * 8;
+        }
+    }
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    return texture;
+}
+
+/* One full screen triangle per face, the shader turns its face and UV into a direction. */
+static void
+ibl_render_faces(unsigned int program, unsigned int cubemap, int level, int size)
+{
+    int loc_face = glGetUniformLocation(program, "face");
+    glViewport(0, 0, ibl_level_size(size, level), ibl_level_size(size, level));
+    for(int face = 0; face < 6; face++) {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, cubemap, level);
+        glUniform1i(loc_face, face);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
+static void
+ibl_generate(Ibl *ibl, Assets *assets, Arena *scratch)
+{
+    unsigned int sky = get_shader_program(assets, scratch, "shaders/deferred_light.vs", "shaders/ibl_sky.fs");
+    unsigned int irradiance = get_shader_program(assets, scratch, "shaders/deferred_light.vs", "shaders/ibl_irradiance.fs");
+    unsigned int prefilter = get_shader_program(assets, scratch, "shaders/deferred_light.vs", "shaders/ibl_prefilter.fs");
+
+    unsigned int fbo;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glBindVertexArray(ibl->empty_vao);
+
+    // the convolutions read the sky's mips for the wide lobes, they aren't kept
+    int environment_levels = 1;
+    while(IBL_ENVIRONMENT_SIZE >> environment_levels)
+        environment_levels++;
+    ibl->environment = ibl_cubemap(IBL_ENVIRONMENT_SIZE, environment_levels, NULL);
+    glUseProgram(sky);
+    ibl_render_faces(sky, ibl->environment, 0, IBL_ENVIRONMENT_SIZE);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->environment);
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+
+    glActiveTexture(GL_TEXTURE0);
+    ibl->irradiance = ibl_cubemap(IBL_IRRADIANCE_SIZE, 1, NULL);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->environment);
+    glUseProgram(irradiance);
+    glUniform1i(glGetUniformLocation(irradiance, "environment"), 0);
+    ibl_render_faces(irradiance, ibl->irradiance, 0, IBL_IRRADIANCE_SIZE);
+
+    ibl->prefiltered = ibl_cubemap(IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS, NULL);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->environment);
+    glUseProgram(prefilter);
+    glUniform1i(glGetUniformLocation(prefilter, "environment"), 0);
+    glUniform1f(glGetUniformLocation(prefilter, "environmentSize"), (float)IBL_ENVIRONMENT_SIZE);
+    for(int level = 0; level < IBL_PREFILTERED_LEVELS; level++) {
+        glUniform1f(glGetUniformLocation(prefilter, "roughness"), (float)level / (IBL_PREFILTERED_LEVELS - 1));
+        ibl_render_faces(prefilter, ibl->prefiltered, level, IBL_PREFILTERED_SIZE);
+    }
+
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->environment);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &fbo);
+    glDeleteProgram(sky);
+    glDeleteProgram(irradiance);
+    glDeleteProgram(prefilter);
+    glEnable(GL_DEPTH_TEST);
+}
+
+static void
+ibl_read_cube(unsigned int cubemap, int size, int levels, u8 *data)
+{
+    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap);
+    for(int level = 0; level < levels; level++) {
+        int s = ibl_level_size(size, level);
+        for(int face = 0; face < 6; face++) {
+            glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, GL_RGBA, GL_HALF_FLOAT, data);
+            data += (size_t)s * s * 8;
+        }
+    }
+}
+
+static void
+ibl_write_cache(const Ibl *ibl, const char *path, u32 hash)
+{
+    IblCacheHeader h = { 0 };
+    h.magic = IBL_CACHE_MAGIC;
+    h.version = IBL_CACHE_VERSION;
+    h.source_hash = hash;
+    h.environment_size = IBL_ENVIRONMENT_SIZE;
+    h.irradiance_size = IBL_IRRADIANCE_SIZE;
+    h.prefiltered_size = IBL_PREFILTERED_SIZE;
+    h.prefiltered_levels = IBL_PREFILTERED_LEVELS;
+    h.environment_offset = ALIGN16((u32)sizeof(IblCacheHeader));
+    h.irradiance_offset = ALIGN16(h.environment_offset + ibl_cube_bytes(IBL_ENVIRONMENT_SIZE, 1));
+    h.prefiltered_offset = ALIGN16(h.irradiance_offset + ibl_cube_bytes(IBL_IRRADIANCE_SIZE, 1));
+    h.file_size = ALIGN16(h.prefiltered_offset + ibl_cube_bytes(IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS));
+
+    u8 *data = calloc(h.file_size, 1);
+    if(!data) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    memcpy(data, &h, sizeof(h));
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    ibl_read_cube(ibl->environment, IBL_ENVIRONMENT_SIZE, 1, data + h.environment_offset);
+    ibl_read_cube(ibl->irradiance, IBL_IRRADIANCE_SIZE, 1, data + h.irradiance_offset);
+    ibl_read_cube(ibl->prefiltered, IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS, data + h.prefiltered_offset);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    // a cache that can't be written only costs the next start the generation again
+    FILE *file = fopen(path, "wb");
+    if(!file || fwrite(data, 1, h.file_size, file) != h.file_size)
+        fprintf(stderr, "Couldn't write IBL cache %s\n", path);
+    if(file)
+        fclose(file);
+    free(data);
+}
+
+/* A section has to lie past the header and inside the file. */
+static bool
+ibl_cache_section(const IblCacheHeader *h, u32 offset, u32 bytes)
+{
+    return offset >= sizeof(IblCacheHeader) && (u64)offset + bytes <= h->file_size;
+}
+
+/* False if the cache is missing, from another version, other shaders or other sizes, or inconsistent. */
+static bool
+ibl_load_cache(Ibl *ibl, const char *path, u32 hash)
+{
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(IblCacheHeader)) {
+        close(fd);
+        return false;
+    }
+    void *mapping = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+        return false;
+
+    const IblCacheHeader *h = mapping;
+    if(h->magic != IBL_CACHE_MAGIC || h->version != IBL_CACHE_VERSION || h->source_hash != hash ||
+       h->file_size != (u64)st.st_size || h->environment_size != IBL_ENVIRONMENT_SIZE ||
+       h->irradiance_size != IBL_IRRADIANCE_SIZE || h->prefiltered_size != IBL_PREFILTERED_SIZE ||
+       h->prefiltered_levels != IBL_PREFILTERED_LEVELS ||
+       !ibl_cache_section(h, h->environment_offset, ibl_cube_bytes(IBL_ENVIRONMENT_SIZE, 1)) ||
+       !ibl_cache_section(h, h->irradiance_offset, ibl_cube_bytes(IBL_IRRADIANCE_SIZE, 1)) ||
+       !ibl_cache_section(h, h->prefiltered_offset, ibl_cube_bytes(IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS))) {
+        munmap(mapping, (size_t)st.st_size);
+        return false;
+    }
+    const u8 *base = mapping;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    ibl->environment = ibl_cubemap(IBL_ENVIRONMENT_SIZE, 1, base + h->environment_offset);
+    ibl->irradiance = ibl_cubemap(IBL_IRRADIANCE_SIZE, 1, base + h->irradiance_offset);
+    ibl->prefiltered = ibl_cubemap(IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS, base + h->prefiltered_offset);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    munmap(mapping, (size_t)st.st_size);
+    return true;
+}
+
+/* Loads the maps from cache_path, or renders them and writes it. */
+void
+ibl_init(Ibl *ibl, Assets *assets, Arena *scratch, const char *cache_path)
+{
+    double start = now_ms();
+    memset(ibl, 0, sizeof(*ibl));
+    glGenVertexArrays(1, &ibl->empty_vao);
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+    u32 hash = ibl_source_hash(assets, scratch);
+    ibl->from_cache = ibl_load_cache(ibl, cache_path, hash);
+    if(!ibl->from_cache) {
+        ibl_generate(ibl, assets, scratch);
+        ibl_write_cache(ibl, cache_path, hash);
+    }
+    ibl->sky_program = get_shader_program(assets, scratch, "shaders/skybox.vs", "shaders/skybox.fs");
+    glUseProgram(ibl->sky_program);
+    glUniform1i(glGetUniformLocation(ibl->sky_program, "environment"), 0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    ibl->build_ms = now_ms() - start;
+}
+
+/*
+ * Binds the maps to their units, program must be current and declare
+ * irradianceMap, prefilteredMap and prefilteredMaxLod. Needed even when the
+ * program doesn't use them, its cube samplers would share unit 0 with
+ * 2D ones otherwise.
+ */
+void
+ibl_bind(const Ibl *ibl, unsigned int program)
+{
+    glUniform1i(glGetUniformLocation(program, "irradianceMap"), IBL_IRRADIANCE_UNIT);
+    glUniform1i(glGetUniformLocation(program, "prefilteredMap"), IBL_PREFILTERED_UNIT);
+    glUniform1f(glGetUniformLocation(program, "prefilteredMaxLod"), (float)(IBL_PREFILTERED_LEVELS - 1));
+    glActiveTexture(GL_TEXTURE0 + IBL_IRRADIANCE_UNIT);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->irradiance);
+    glActiveTexture(GL_TEXTURE0 + IBL_PREFILTERED_UNIT);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->prefiltered);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+/* Fills what the scene left at the far plane, after opaque geometry so it is only shaded there. */
+void
+ibl_draw_sky(Ibl *ibl, mat4x4 view, mat4x4 projection)
+{
+    // rotation only, the sky is infinitely far away
+    mat4x4 rotation, view_projection, inverse;
+    mat4x4_dup(rotation, view);
+    rotation[3][0] = rotation[3][1] = rotation[3][2] = 0.0f;
+    mat4x4_mul(view_projection, projection, rotation);
+    mat4x4_invert(inverse, view_projection);
+
+    glUseProgram(ibl->sky_program);
+    glUniformMatrix4fv(glGetUniformLocation(ibl->sky_program, "inverseViewProjection"), 1, GL_FALSE, (GLfloat *)inverse);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, ibl->environment);
+    glBindVertexArray(ibl->empty_vao);
+    glDepthFunc(GL_LEQUAL);
+    glDepthMask(GL_FALSE);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDepthMask(GL_TRUE);
+    glDepthFunc(GL_LESS);
+    glBindVertexArray(0);
+}
+
+size_t
+ibl_memory(const Ibl *ibl)
+{
+    (void)ibl;
+    return (size_t)ibl_cube_bytes(IBL_ENVIRONMENT_SIZE, 1) + ibl_cube_bytes(IBL_IRRADIANCE_SIZE, 1) +
+           ibl_cube_bytes(IBL_PREFILTERED_SIZE, IBL_PREFILTERED_LEVELS);
+}
+
+void
+ibl_destroy(Ibl *ibl)
+{
+    unsigned int textures[] = { ibl->environment, ibl->irradiance, ibl->prefiltered };
+    glDeleteTextures(3, textures);
+    glDeleteProgram(ibl->sky_program);
+    glDeleteVertexArrays(1, &ibl->empty_vao);
+}
@@ -0,0 +1,62 @@
+#ifndef __IBL__H__
+#define __IBL__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "assets.h"
+#include "memory.h"
+
+/*
+ * Image based lighting from a sky. Three RGBA16F cubemaps:
+ *   environment  the sky itself, drawn behind the scene
+ *   irradiance   cosine convolved, the diffuse ambient in a direction
+ *   prefiltered  GGX importance sampled, roughness rising down the mips,
+ *                the specular reflection in a direction
+ * All three are rendered on the GPU once, read back and written to a
+ * cache file, which later runs upload as they are. The cache records a
+ * hash of the shaders that made it and is rebuilt when they change.
+ */
+
+#define IBL_CACHE_MAGIC 0x304c4249   /* "IBL0" */
+#define IBL_CACHE_VERSION 2
+#define IBL_ENVIRONMENT_SIZE 128
+#define IBL_IRRADIANCE_SIZE 32
+#define IBL_PREFILTERED_SIZE 128
+#define IBL_PREFILTERED_LEVELS 6      /* 128 down to 4, roughness 0 to 1 */
+
+#define IBL_IRRADIANCE_UNIT 4
+#define IBL_PREFILTERED_UNIT 5
+
+/* Offsets are from the start of the file and 16 byte aligned, faces in GL order, half floats. */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 source_hash;          /* of the generating shaders */
+    u32 file_size;
+    u32 environment_size;     /* the sizes it was made at, a cache from other sizes is rebuilt */
+    u32 irradiance_size;
+    u32 prefiltered_size;
+    u32 prefiltered_levels;
+    u32 environment_offset;   /* level 0 only */
+    u32 irradiance_offset;
+    u32 prefiltered_offset;   /* every level, largest first */
+} IblCacheHeader;
+
+typedef struct {
+    unsigned int environment;
+    unsigned int irradiance;
+    unsigned int prefiltered;
+    unsigned int sky_program;
+    unsigned int empty_vao;
+    bool from_cache;
+    double build_ms;          /* generating or loading, readback and cache write included */
+} Ibl;
+
+void ibl_init(Ibl *ibl, Assets *assets, Arena *scratch, const char *cache_path);
+void ibl_bind(const Ibl *ibl, unsigned int program);
+void ibl_draw_sky(Ibl *ibl, mat4x4 view, mat4x4 projection);
+size_t ibl_memory(const Ibl *ibl);
+void ibl_destroy(Ibl *ibl);
+
+#endif
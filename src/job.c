@@ -0,0 +1,292 @@
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "job.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+/* failed steal rounds before a worker goes to sleep */
+#define IDLE_SPINS 64
+
+// -1 on threads the job system doesn't own, they have no deque
+static _Thread_local int thread_index = -1;
+
+typedef struct {
+    JobSystem *js;
+    int index;
+} WorkerStart;
+
+static WorkerStart worker_starts[JOB_MAX_THREADS];
+
+static void
+deque_push(JobDeque *d, const Job *job)
+{
+    long b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&d->top, memory_order_acquire);
+    if(b - t >= JOB_QUEUE_SIZE) {
+        ERROR_EXIT(1, "Job queue overflow\n");
+    }
+
+    d->slots[b & (JOB_QUEUE_SIZE - 1)] = *job;
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+}
+
+/* Copies the bottom job into out, false when the deque is empty or a thief won the last one. */
+static bool
+deque_take(JobDeque *d, Job *out)
+{
+    long b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+    if(t > b) {
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *out = d->slots[b & (JOB_QUEUE_SIZE - 1)];
+    bool taken = true;
+    if(t == b) {
+        // last item, race the thieves for it
+        taken = atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+    }
+    return taken;
+}
+
+/* The copy is made before the CAS, once top moves on the owner may reuse the slot. */
+static bool
+deque_steal(JobDeque *d, Job *out)
+{
+    long t = atomic_load_explicit(&d->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+    if(t >= b)
+        return false;
+
+    *out = d->slots[t & (JOB_QUEUE_SIZE - 1)];
+    return atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+}
+
+static JobDeque *
+own_deque(JobSystem *js)
+{
+    if(thread_index < 0) {
+        ERROR_EXIT(1, "Jobs scheduled or waited for from a thread the job system doesn't own\n");
+    }
+    return &js->deques[thread_index];
+}
+
+static void
+wake_sleepers(JobSystem *js)
+{
+    if(atomic_load_explicit(&js->sleepers, memory_order_acquire) == 0)
+        return;
+    pthread_mutex_lock(&js->sleep_lock);
+    pthread_cond_broadcast(&js->wake);
+    pthread_mutex_unlock(&js->sleep_lock);
+}
+
+static void
+schedule(JobSystem *js, const Job *job)
+{
+    deque_push(own_deque(js), job);
+    wake_sleepers(js);
+}
+
+static void
+execute(JobSystem *js, const Job *job)
+{
+    job->func(job->data, job->begin, job->end);
+    atomic_fetch_add_explicit(&js->executed, 1, memory_order_relaxed);
+
+    JobCounter *counter = job->counter;
+    if(counter && atomic_fetch_sub_explicit(&counter->value, 1, memory_order_acq_rel) == 1) {
+        if(counter->has_continuation)
+            schedule(js, &counter->continuation);
+    }
+}
+
+/* Own deque first, then sweep the others starting at a rotating victim. */
+static bool
+find_job(JobSystem *js, u32 *victim, Job *out)
+{
+    if(deque_take(own_deque(js), out))
+        return true;
+
+    for(int i = 0; i < js->thread_count; i++) {
+        int other = (int)((*victim)++ % (u32)js->thread_count);
+        if(other == thread_index)
+            continue;
+        if(deque_steal(&js->deques[other], out)) {
+            atomic_fetch_add_explicit(&js->steals, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void *
+worker_main(void *arg)
+{
+    WorkerStart *start = arg;
+    JobSystem *js = start->js;
+    thread_index = start->index;
+    u32 victim = (u32)thread_index * 7u;
+    int idle = 0;
+
+    while(atomic_load_explicit(&js->running, memory_order_acquire)) {
+        Job job;
+        if(find_job(js, &victim, &job)) {
+            execute(js, &job);
+            idle = 0;
+            continue;
+        }
+        if(++idle < IDLE_SPINS) {
+            sched_yield();
+            continue;
+        }
+
+        pthread_mutex_lock(&js->sleep_lock);
+        atomic_fetch_add(&js->sleepers, 1);
+        if(atomic_load(&js->running)) {
+            struct timespec until;
+            clock_gettime(CLOCK_REALTIME, &until);
+            until.tv_nsec += 1000000;
+            if(until.tv_nsec >= 1000000000) {
+                until.tv_sec++;
+                until.tv_nsec -= 1000000000;
+            }
+            // timed, a push that raced past the sleepers check is picked up within 1 ms
+            pthread_cond_timedwait(&js->wake, &js->sleep_lock, &until);
+        }
+        atomic_fetch_sub(&js->sleepers, 1);
+        pthread_mutex_unlock(&js->sleep_lock);
+        idle = 0;
+    }
+    return NULL;
+}
+
+void
+job_system_init(JobSystem *js, int thread_count)
+{
+    if(thread_count < 1)
+        thread_count = 1;
+    if(thread_count > JOB_MAX_THREADS)
+        thread_count = JOB_MAX_THREADS;
+
+    js->thread_count = thread_count;
+    js->deques = aligned_alloc(64, sizeof(JobDeque) * thread_count);
+    if(!js->deques) {
+        ERROR_EXIT(1, "Couldn't allocate job queues\n");
+    }
+    memset(js->deques, 0, sizeof(JobDeque) * thread_count);
+
+    atomic_init(&js->running, 1);
+    atomic_init(&js->sleepers, 0);
+    atomic_init(&js->steals, 0);
+    atomic_init(&js->executed, 0);
+    pthread_mutex_init(&js->sleep_lock, NULL);
+    pthread_cond_init(&js->wake, NULL);
+
+    // the calling thread is index 0 and helps out whenever it waits
+    thread_index = 0;
+    for(int i = 1; i < thread_count; i++) {
+        worker_starts[i].js = js;
+        worker_starts[i].index = i;
+        if(pthread_create(&js->threads[i], NULL, worker_main, &worker_starts[i]) != 0) {
+            ERROR_EXIT(1, "Couldn't start job worker %d\n", i);
+        }
+    }
+}
+
+void
+job_system_shutdown(JobSystem *js)
+{
+    atomic_store(&js->running, 0);
+    pthread_mutex_lock(&js->sleep_lock);
+    pthread_cond_broadcast(&js->wake);
+    pthread_mutex_unlock(&js->sleep_lock);
+    for(int i = 1; i < js->thread_count; i++)
+        pthread_join(js->threads[i], NULL);
+
+    pthread_mutex_destroy(&js->sleep_lock);
+    pthread_cond_destroy(&js->wake);
+    free(js->deques);
+}
+
+void
+job_counter_init(JobCounter *counter)
+{
+    atomic_init(&counter->value, 0);
+    counter->has_continuation = 0;
+}
+
+/*
+ * Runs func once every job counted by counter has finished. Must be set
+ * before the counted jobs are scheduled. The continuation itself is
+ * counted by continuation_counter (may be NULL).
+ */
+void
+job_counter_then(JobCounter *counter, JobFunc func, void *data, JobCounter *continuation_counter)
+{
+    counter->continuation.func = func;
+    counter->continuation.data = data;
+    counter->continuation.begin = 0;
+    counter->continuation.end = 0;
+    counter->continuation.counter = continuation_counter;
+    counter->has_continuation = 1;
+    if(continuation_counter)
+        atomic_fetch_add(&continuation_counter->value, 1);
+}
+
+void
+job_run(JobSystem *js, JobFunc func, void *data, u32 begin, u32 end, JobCounter *counter)
+{
+    Job job = { func, data, begin, end, counter };
+    if(counter)
+        atomic_fetch_add_explicit(&counter->value, 1, memory_order_relaxed);
+    schedule(js, &job);
+}
+
+/* Splits [0, count) into grain sized jobs. */
+void
+job_parallel_for(JobSystem *js, JobFunc func, void *data, u32 count, u32 grain, JobCounter *counter)
+{
+    if(grain == 0)
+        grain = 1;
+    u32 jobs = (count + grain - 1) / grain;
+    if(counter)
+        atomic_fetch_add_explicit(&counter->value, (int)jobs, memory_order_relaxed);
+
+    for(u32 begin = 0; begin < count; begin += grain) {
+        u32 end = begin + grain < count ? begin + grain : count;
+        Job job = { func, data, begin, end, counter };
+        deque_push(own_deque(js), &job);
+    }
+    wake_sleepers(js);
+}
+
+/* Executes other jobs until the counter reaches zero, the waiting thread is never idle. */
+void
+job_wait(JobSystem *js, JobCounter *counter)
+{
+    u32 victim = (u32)thread_index * 7u + 1u;
+    while(atomic_load_explicit(&counter->value, memory_order_acquire) > 0) {
+        Job job;
+        if(find_job(js, &victim, &job))
+            execute(js, &job);
+        else
+            sched_yield();
+    }
+}
+
+int
+job_thread_index(void)
+{
+    return thread_index;
+}
@@ -0,0 +1,68 @@
+#ifndef __JOB__H__
+#define __JOB__H__
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "untitled_types.h"
+
+#define JOB_MAX_THREADS 64
+/* per thread deque; jobs queued by one thread and not yet taken must stay below this */
+#define JOB_QUEUE_SIZE 4096
+
+typedef void (*JobFunc)(void *data, u32 begin, u32 end);
+
+typedef struct JobCounter JobCounter;
+
+typedef struct {
+    JobFunc func;
+    void *data;
+    u32 begin, end;
+    JobCounter *counter;
+} Job;
+
+/*
+ * Counts unfinished jobs. When it drops to zero the continuation, if
+ * any, is scheduled, which is how dependent work is chained without a
+ * thread blocking on it.
+ */
+struct JobCounter {
+    atomic_int value;
+    Job continuation;
+    int has_continuation;
+};
+
+/* Chase-Lev work-stealing deque, the owner pushes and takes at the bottom, thieves steal the top. */
+typedef struct {
+    _Alignas(64) atomic_long top;
+    _Alignas(64) atomic_long bottom;
+    _Alignas(64) Job slots[JOB_QUEUE_SIZE];   /* by value, a slot is only rewritten once top has passed it */
+} JobDeque;
+
+typedef struct {
+    int thread_count;              /* workers + the thread that called job_system_init */
+    JobDeque *deques;
+    pthread_t threads[JOB_MAX_THREADS];
+    atomic_int running;
+    atomic_int sleepers;
+    pthread_mutex_t sleep_lock;
+    pthread_cond_t wake;
+    atomic_ullong steals;
+    atomic_ullong executed;
+} JobSystem;
+
+/*
+ * Only the thread that called job_system_init and running jobs may
+ * schedule or wait for work, each of them owns one deque. Any other
+ * thread doing so is a fatal error, job_thread_index is -1 there.
+ */
+void job_system_init(JobSystem *js, int thread_count);
+void job_system_shutdown(JobSystem *js);
+void job_counter_init(JobCounter *counter);
+void job_counter_then(JobCounter *counter, JobFunc func, void *data, JobCounter *continuation_counter);
+void job_run(JobSystem *js, JobFunc func, void *data, u32 begin, u32 end, JobCounter *counter);
+void job_parallel_for(JobSystem *js, JobFunc func, void *data, u32 count, u32 grain, JobCounter *counter);
+void job_wait(JobSystem *js, JobCounter *counter);
+int job_thread_index(void);
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef __LIGHT__H__
+#define __LIGHT__H__
+
+#include <linmath.h>
+
+#define MAX_LIGHTS 16
+
+/* radius 0 marks a directional light, position is then the direction towards it */
+typedef struct {
+    vec3 position;
+    vec3 color;
+    float radius;
+} Light;
+
+#endif
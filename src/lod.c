@@ -0,0 +1,503 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lod.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+/* Border and seam edges are held in place by planes this much stronger than the faces. */
+#define BORDER_WEIGHT 10.0
+#define LOD_MIN_TRIANGLES 8
+
+static void *
+lod_malloc(size_t size)
+{
+    void *p = malloc(size ? size : 1);
+    if(!p) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    return p;
+}
+
+/*
+ * Symmetric 4x4 error quadric, the weighted sum of squared distances to
+ * a set of planes: xx xy xz xw yy yz yw zz zw ww. Faces weigh by their
+ * area, so the sum over the total weight is a mean squared distance that
+ * doesn't depend on how finely the surface was tessellated.
+ */
+typedef struct {
+    double q[10];
+    double weight;
+} Quadric;
+
+static void
+quadric_add_plane(Quadric *q, const double *n, double d, double weight)
+{
+    double a = n[0], b = n[1], c = n[2];
+    q->q[0] += weight * a * a;
+    q->q[1] += weight * a * b;
+    q->q[2] += weight * a * c;
+    q->q[3] += weight * a * d;
+    q->q[4] += weight * b * b;
+    q->q[5] += weight * b * c;
+    q->q[6] += weight * b * d;
+    q->q[7] += weight * c * c;
+    q->q[8] += weight * c * d;
+    q->q[9] += weight * d * d;
+    q->weight += weight;
+}
+
+static void
+quadric_add(Quadric *q, const Quadric *r)
+{
+    for(int i = 0; i < 10; i++)
+        q->q[i] += r->q[i];
+    q->weight += r->weight;
+}
+
+static double
+quadric_eval(const Quadric *q, const float *p)
+{
+    double x = p[0], y = p[1], z = p[2];
+    const double *a = q->q;
+    double e = a[0] * x * x + 2.0 * a[1] * x * y + 2.0 * a[2] * x * z + 2.0 * a[3] * x
+             + a[4] * y * y + 2.0 * a[5] * y * z + 2.0 * a[6] * y
+             + a[7] * z * z + 2.0 * a[8] * z + a[9];
+    return e > 0.0 && q->weight > 0.0 ? e / q->weight : 0.0;
+}
+
+/* Unit plane through p with normal along n, false if n is degenerate. */
+static bool
+plane_from(const float *p, const double *n_in, double *n, double *d)
+{
+    double len = sqrt(n_in[0] * n_in[0] + n_in[1] * n_in[1] + n_in[2] * n_in[2]);
+    if(len == 0.0)
+        return false;
+    for(int k = 0; k < 3; k++)
+        n[k] = n_in[k] / len;
+    *d = -(n[0] * p[0] + n[1] * p[1] + n[2] * p[2]);
+    return true;
+}
+
+static void
+triangle_normal(const float *a, const float *b, const float *c, double *n)
+{
+    double ab[3], ac[3];
+    for(int k = 0; k < 3; k++) {
+        ab[k] = (double)b[k] - a[k];
+        ac[k] = (double)c[k] - a[k];
+    }
+    n[0] = ab[1] * ac[2] - ab[2] * ac[1];
+    n[1] = ab[2] * ac[0] - ab[0] * ac[2];
+    n[2] = ab[0] * ac[1] - ab[1] * ac[0];
+}
+
+/*
+ * Open addressing set of directed edges, keys are (from << 32 | to),
+ * an all ones key marks an empty slot.
+ */
+typedef struct {
+    u64 *keys;
+    u32 mask;
+} EdgeSet;
+
+static u32
+edge_hash(u64 key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return (u32)key;
+}
+
+static void
+edge_set_init(EdgeSet *s, u32 count)
+{
+    u32 size = 16;
+    while(size < count * 2)
+        size *= 2;
+    s->keys = lod_malloc(sizeof(u64) * size);
+    memset(s->keys, 0xff, sizeof(u64) * size);
+    s->mask = size - 1;
+}
+
+static void
+edge_set_insert(EdgeSet *s, u32 a, u32 b)
+{
+    u64 key = (u64)a << 32 | b;
+    for(u32 i = edge_hash(key) & s->mask;; i = (i + 1) & s->mask) {
+        if(s->keys[i] == key)
+            return;
+        if(s->keys[i] == ~0ull) {
+            s->keys[i] = key;
+            return;
+        }
+    }
+}
+
+static bool
+edge_set_has(const EdgeSet *s, u32 a, u32 b)
+{
+    u64 key = (u64)a << 32 | b;
+    for(u32 i = edge_hash(key) & s->mask;; i = (i + 1) & s->mask) {
+        if(s->keys[i] == key)
+            return true;
+        if(s->keys[i] == ~0ull)
+            return false;
+    }
+}
+
+/*
+ * The edge a -> b of some triangle is on a border when no triangle has
+ * the welded edge the other way round, and on an attribute seam when one
+ * does but with other vertices.
+ */
+static bool
+edge_constrained(const EdgeSet *wedge_edges, const EdgeSet *welded_edges, const u32 *weld, u32 a, u32 b)
+{
+    return !edge_set_has(welded_edges, weld[b], weld[a]) || !edge_set_has(wedge_edges, b, a);
+}
+
+/*
+ * Fills both edge sets from the triangles and counts border and seam
+ * edges per welded vertex: 0 is free, 1 or 2 may slide along them,
+ * 0xff is a corner that stays.
+ */
+static void
+classify_edges(const u32 *indices, u32 index_count, const u32 *weld, u32 vertex_count,
+               EdgeSet *wedge_edges, EdgeSet *welded_edges, u8 *constrained)
+{
+    memset(wedge_edges->keys, 0xff, sizeof(u64) * (wedge_edges->mask + 1));
+    memset(welded_edges->keys, 0xff, sizeof(u64) * (welded_edges->mask + 1));
+    for(u32 i = 0; i < index_count; i += 3)
+        for(int k = 0; k < 3; k++) {
+            u32 a = indices[i + k], b = indices[i + (k + 1) % 3];
+            edge_set_insert(wedge_edges, a, b);
+            edge_set_insert(welded_edges, weld[a], weld[b]);
+        }
+
+    // borders are seen from one side and count twice, seams once from each side
+    u32 *count = calloc(vertex_count, sizeof(u32));
+    if(!count) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    for(u32 i = 0; i < index_count; i += 3)
+        for(int k = 0; k < 3; k++) {
+            u32 a = indices[i + k], b = indices[i + (k + 1) % 3];
+            if(!edge_constrained(wedge_edges, welded_edges, weld, a, b))
+                continue;
+            u32 n = edge_set_has(welded_edges, weld[b], weld[a]) ? 1 : 2;
+            count[weld[a]] += n;
+            count[weld[b]] += n;
+        }
+    for(u32 v = 0; v < vertex_count; v++)
+        constrained[v] = count[v] > 4 ? 0xff : (u8)(count[v] / 2);
+    free(count);
+}
+
+/* Vertices with equal positions (attribute seams) map to the first of them. */
+static u32 *
+weld_positions(const Mesh *m)
+{
+    u32 size = 16;
+    while(size < m->vertex_count * 2)
+        size *= 2;
+    u32 *table = lod_malloc(sizeof(u32) * size);
+    memset(table, 0xff, sizeof(u32) * size);
+    u32 *remap = lod_malloc(sizeof(u32) * m->vertex_count);
+
+    for(u32 v = 0; v < m->vertex_count; v++) {
+        const float *p = &m->positions[v * 3];
+        u32 bits[3];
+        memcpy(bits, p, sizeof(bits));
+        u32 h = (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+        for(u32 i = h & (size - 1);; i = (i + 1) & (size - 1)) {
+            if(table[i] == 0xffffffffu) {
+                table[i] = v;
+                remap[v] = v;
+                break;
+            }
+            if(memcmp(&m->positions[table[i] * 3], p, sizeof(float) * 3) == 0) {
+                remap[v] = table[i];
+                break;
+            }
+        }
+    }
+    free(table);
+    return remap;
+}
+
+typedef struct {
+    u32 from, to;             /* welded vertices */
+    float cost;
+} Collapse;
+
+static int
+compare_collapses(const void *a, const void *b)
+{
+    float ca = ((const Collapse *)a)->cost, cb = ((const Collapse *)b)->cost;
+    return (ca > cb) - (ca < cb);
+}
+
+/* Moving from onto to must not turn any of from's remaining triangles over. */
+static bool
+collapse_flips(const Mesh *m, const u32 *indices, const u32 *weld, const u32 *adjacency, const u32 *adjacency_start,
+               u32 from, u32 to)
+{
+    const float *target = &m->positions[to * 3];
+    for(u32 a = adjacency_start[from]; a < adjacency_start[from + 1]; a++) {
+        const u32 *tri = &indices[adjacency[a] * 3];
+        u32 w[3] = { weld[tri[0]], weld[tri[1]], weld[tri[2]] };
+        if(w[0] == to || w[1] == to || w[2] == to)
+            continue;
+        const float *p[3], *q[3];
+        for(int k = 0; k < 3; k++) {
+            p[k] = &m->positions[w[k] * 3];
+            q[k] = w[k] == from ? target : p[k];
+        }
+        double before[3], after[3];
+        triangle_normal(p[0], p[1], p[2], before);
+        triangle_normal(q[0], q[1], q[2], after);
+        if(before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0.0)
+            return true;
+    }
+    return false;
+}
+
+/*
+ * Greedy edge collapse in passes. Each pass sorts all candidate
+ * collapses by error and applies the cheapest ones whose neighbourhood
+ * hasn't been touched yet in this pass, until the target is reached or
+ * the cheapest remaining collapse is more than max_error off. Vertices
+ * on open borders or attribute seams may only slide along them, corners
+ * where more than two of those edges meet never move. Returns the number
+ * of indices written to out, which must hold index_count.
+ */
+u32
+mesh_simplify(const Mesh *m, const u32 *indices, u32 index_count, u32 target_index_count, float max_error,
+              u32 *out, float *error)
+{
+    u32 vertex_count = m->vertex_count;
+    u32 *weld = weld_positions(m);
+    memcpy(out, indices, sizeof(u32) * index_count);
+    *error = 0.0f;
+
+    EdgeSet wedge_edges, welded_edges;
+    edge_set_init(&wedge_edges, index_count);
+    edge_set_init(&welded_edges, index_count);
+    u8 *constrained = lod_malloc(vertex_count);
+    Quadric *quadrics = calloc(vertex_count, sizeof(Quadric));
+    if(!quadrics) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    classify_edges(out, index_count, weld, vertex_count, &wedge_edges, &welded_edges, constrained);
+
+    // face planes, plus a plane through every border or seam edge standing on its triangle
+    for(u32 i = 0; i < index_count; i += 3) {
+        u32 w[3] = { weld[out[i]], weld[out[i + 1]], weld[out[i + 2]] };
+        const float *p[3] = { &m->positions[w[0] * 3], &m->positions[w[1] * 3], &m->positions[w[2] * 3] };
+        double normal[3], n[3], d;
+        triangle_normal(p[0], p[1], p[2], normal);
+        if(!plane_from(p[0], normal, n, &d))
+            continue;
+        double area = 0.5 * sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        for(int k = 0; k < 3; k++)
+            quadric_add_plane(&quadrics[w[k]], n, d, area);
+
+        for(int k = 0; k < 3; k++) {
+            u32 a = out[i + k], b = out[i + (k + 1) % 3];
+            if(!edge_constrained(&wedge_edges, &welded_edges, weld, a, b))
+                continue;
+            const float *pa = &m->positions[weld[a] * 3], *pb = &m->positions[weld[b] * 3];
+            double edge[3] = { (double)pb[0] - pa[0], (double)pb[1] - pa[1], (double)pb[2] - pa[2] };
+            double side[3] = {
+                edge[1] * n[2] - edge[2] * n[1],
+                edge[2] * n[0] - edge[0] * n[2],
+                edge[0] * n[1] - edge[1] * n[0],
+            };
+            double sn[3], sd;
+            double weight = BORDER_WEIGHT * (edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2]);
+            if(plane_from(pa, side, sn, &sd)) {
+                quadric_add_plane(&quadrics[weld[a]], sn, sd, weight);
+                quadric_add_plane(&quadrics[weld[b]], sn, sd, weight);
+            }
+        }
+    }
+
+    u32 *adjacency_start = lod_malloc(sizeof(u32) * (vertex_count + 1));
+    u32 *adjacency = lod_malloc(sizeof(u32) * index_count);
+    u32 *wedge_target = lod_malloc(sizeof(u32) * vertex_count);
+    u8 *locked = lod_malloc(vertex_count);
+    Collapse *collapses = lod_malloc(sizeof(Collapse) * index_count * 2);
+    double max_cost = (double)max_error * max_error;
+
+    for(bool first = true; index_count > target_index_count; first = false) {
+        // collapses make new edges, what is a border or seam is looked up again
+        if(!first)
+            classify_edges(out, index_count, weld, vertex_count, &wedge_edges, &welded_edges, constrained);
+
+        // triangles around each welded vertex
+        memset(adjacency_start, 0, sizeof(u32) * (vertex_count + 1));
+        for(u32 i = 0; i < index_count; i++)
+            adjacency_start[weld[out[i]] + 1]++;
+        for(u32 v = 0; v < vertex_count; v++)
+            adjacency_start[v + 1] += adjacency_start[v];
+        for(u32 i = 0; i < index_count; i++)
+            adjacency[adjacency_start[weld[out[i]]]++] = i / 3;
+        for(u32 v = vertex_count; v > 0; v--)
+            adjacency_start[v] = adjacency_start[v - 1];
+        adjacency_start[0] = 0;
+
+        u32 collapse_count = 0;
+        for(u32 i = 0; i < index_count; i += 3)
+            for(int k = 0; k < 3; k++) {
+                u32 a = weld[out[i + k]], b = weld[out[i + (k + 1) % 3]];
+                bool along = edge_constrained(&wedge_edges, &welded_edges, weld, out[i + k], out[i + (k + 1) % 3]);
+                for(int dir = 0; dir < 2; dir++) {
+                    u32 from = dir ? b : a, to = dir ? a : b;
+                    // a constrained vertex only slides along its own border or seam
+                    if(constrained[from] == 0xff || (constrained[from] && !along))
+                        continue;
+                    Quadric q = quadrics[from];
+                    quadric_add(&q, &quadrics[to]);
+                    double cost = quadric_eval(&q, &m->positions[to * 3]);
+                    if(cost > max_cost)
+                        continue;
+                    collapses[collapse_count++] = (Collapse){ from, to, (float)cost };
+                }
+            }
+        if(!collapse_count)
+            break;
+        qsort(collapses, collapse_count, sizeof(Collapse), compare_collapses);
+
+        for(u32 v = 0; v < vertex_count; v++)
+            wedge_target[v] = v;
+        memset(locked, 0, vertex_count);
+        u32 triangles_left = (index_count - target_index_count) / 3, removed = 0, applied = 0;
+        for(u32 c = 0; c < collapse_count && removed < triangles_left; c++) {
+            u32 from = collapses[c].from, to = collapses[c].to;
+            if(locked[from] || locked[to])
+                continue;
+            if(collapse_flips(m, out, weld, adjacency, adjacency_start, from, to))
+                continue;
+
+            // every wedge of from follows the wedge of to it shares a triangle with
+            for(u32 a = adjacency_start[from]; a < adjacency_start[from + 1]; a++) {
+                const u32 *tri = &out[adjacency[a] * 3];
+                int from_corner = -1, to_corner = -1;
+                for(int k = 0; k < 3; k++) {
+                    if(weld[tri[k]] == from)
+                        from_corner = k;
+                    if(weld[tri[k]] == to)
+                        to_corner = k;
+                    locked[weld[tri[k]]] = 1;
+                }
+                if(to_corner >= 0) {
+                    wedge_target[tri[from_corner]] = tri[to_corner];
+                    removed++;
+                }
+            }
+            for(u32 a = adjacency_start[from]; a < adjacency_start[from + 1]; a++) {
+                const u32 *tri = &out[adjacency[a] * 3];
+                for(int k = 0; k < 3; k++)
+                    if(weld[tri[k]] == from && wedge_target[tri[k]] == tri[k])
+                        wedge_target[tri[k]] = to;
+            }
+            quadric_add(&quadrics[to], &quadrics[from]);
+            if(collapses[c].cost > *error)
+                *error = collapses[c].cost;
+            applied++;
+        }
+        if(!applied)
+            break;
+
+        u32 written = 0;
+        for(u32 i = 0; i < index_count; i += 3) {
+            u32 a = wedge_target[out[i]], b = wedge_target[out[i + 1]], c = wedge_target[out[i + 2]];
+            if(weld[a] == weld[b] || weld[b] == weld[c] || weld[a] == weld[c])
+                continue;
+            out[written++] = a;
+            out[written++] = b;
+            out[written++] = c;
+        }
+        index_count = written;
+    }
+    *error = sqrtf(*error);
+
+    free(collapses);
+    free(locked);
+    free(wedge_target);
+    free(adjacency);
+    free(adjacency_start);
+    free(constrained);
+    free(quadrics);
+    free(welded_edges.keys);
+    free(wedge_edges.keys);
+    free(weld);
+    return index_count;
+}
+
+/*
+ * Each level is simplified from the one before with what is left of the
+ * error budget, so errors add up along the chain and stay conservative.
+ */
+void
+mesh_build_lods(Mesh *m, float max_error)
+{
+    while(m->lod_count < MESH_MAX_LODS) {
+        const MeshLod *previous = &m->lods[m->lod_count - 1];
+        u32 target = previous->index_count / 6 * 3;
+        if(target < LOD_MIN_TRIANGLES * 3 || previous->error >= max_error)
+            break;
+
+        u32 *level = lod_malloc(sizeof(u32) * previous->index_count);
+        float error;
+        u32 count = mesh_simplify(m, m->indices + previous->index_offset, previous->index_count, target,
+                                  max_error - previous->error, level, &error);
+        // not worth another draw range
+        if(count == 0 || count > previous->index_count / 20 * 17) {
+            free(level);
+            break;
+        }
+
+        u32 *indices = realloc(m->indices, sizeof(u32) * (m->index_count + count));
+        if(!indices) {
+            ERROR_EXIT(1, "Couldn't malloc\n");
+        }
+        m->indices = indices;
+        memcpy(m->indices + m->index_count, level, sizeof(u32) * count);
+        m->lods[m->lod_count++] = (MeshLod){ m->index_count, count, previous->error + error };
+        m->index_count += count;
+        free(level);
+    }
+}
+
+/* Screen pixels covered by one world unit at distance along the view. */
+float
+lod_pixels_per_unit(float distance, float fov_y, int screen_height)
+{
+    if(distance < 0.01f)
+        distance = 0.01f;
+    return screen_height / (2.0f * tanf(fov_y * 0.5f) * distance);
+}
+
+u32
+lod_select(const MeshLod *lods, u32 lod_count, u32 current, float pixels_per_unit, float threshold,
+           float hysteresis)
+{
+    if(current >= lod_count)
+        current = lod_count - 1;
+    // errors grow along the chain, so the first level over the threshold ends the search
+    u32 lod = 0;
+    while(lod + 1 < lod_count && lods[lod + 1].error * pixels_per_unit <= threshold)
+        lod++;
+    if(lod <= current)
+        return lod;
+
+    u32 coarser = current;
+    while(coarser < lod && lods[coarser + 1].error * pixels_per_unit <= threshold * (1.0f - hysteresis))
+        coarser++;
+    return coarser;
+}
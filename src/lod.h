@@ -0,0 +1,32 @@
+#ifndef __LOD__H__
+#define __LOD__H__
+
+#include "untitled_types.h"
+#include "mesh.h"
+
+/*
+ * Level of detail. mesh_simplify collapses edges in order of quadric
+ * error (Garland & Heckbert) onto existing vertices, so a simplified
+ * level is just another index range into the same vertex buffer.
+ * mesh_build_lods appends such ranges to m->indices, halving the
+ * triangle count each time, until the next level would be off by more
+ * than max_error or stops getting smaller.
+ *
+ * At runtime lod_select takes the coarsest level whose error projects
+ * to at most threshold pixels. Going coarser additionally requires the
+ * error to be below threshold * (1 - hysteresis), so an object sitting
+ * at a switching distance doesn't pop back and forth every frame.
+ */
+
+#define LOD_HYSTERESIS 0.25f
+#define MESH_LOD_MAX_ERROR 0.05f    /* of the bounding radius, for imported meshes */
+
+u32 mesh_simplify(const Mesh *m, const u32 *indices, u32 index_count, u32 target_index_count, float max_error,
+                  u32 *out, float *error);
+void mesh_build_lods(Mesh *m, float max_error);
+
+float lod_pixels_per_unit(float distance, float fov_y, int screen_height);
+u32 lod_select(const MeshLod *lods, u32 lod_count, u32 current, float pixels_per_unit, float threshold,
+               float hysteresis);
+
+#endif
@@ -2,15 +2,45 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#include <unistd.h>
 #include <linmath.h>
 
 #include "untitled_types.h"
+#include "light.h"
+#include "deferred.h"
+#include "gpu_timer.h"
+#include "shadow.h"
+#include "sim.h"
+#include "spsc.h"
+#include "frame_packet.h"
+#include "job.h"
+#include "frame_tasks.h"
+#include "ecs.h"
+#include "hierarchy.h"
+#include "mesh.h"
+#include "vertex_format.h"
+#include "lod.h"
+#include "occlusion.h"
+#include "hiz.h"
+#include "memory.h"
+#include "assets.h"
+#include "camera.h"
+#include "shader.h"
+#include "app.h"
+#include "startup.h"
+#include "glad_lazy.h"
+#include "pacing.h"
+#include "particles.h"
+#include "post.h"
+#include "dynres.h"
+#include "ibl.h"
+#include "material.h"
 
 #define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
 #define ERROR_RETURN(R, ...) fprintf(stderr, __VA_ARGS__); return R
@@ -29,415 +59,1306 @@
 
 
 /*GLOBALS*/
-vec3 cameraPos   = {0.0f, 0.0f,  3.0f};
-vec3 cameraFront = {0.0f, 0.0f, 0.0f};
-vec3 cameraUp    = {0.0f, 1.0f,  0.0f};
-float delta_time = 0;
-float lastX = 400, lastY = 300;
-bool firstMouse = true;
-float yaw = -90.0f, pitch = 0.0f, fov = 45.0f;
+// only touched by the main thread, the packet carries a copy
+Camera camera;
+MouseLook mouse_look = MOUSE_LOOK_DEFAULT;
+int screen_width = 800, screen_height = 600;
+bool deferred_mode = false;
+bool depth_prepass = false;
+bool overdraw_view = false;
+int draw_sort = DRAW_SORT_DEPTH;
+bool shadows_enabled = true;
+bool cascaded_shadows = false;
+ShadowConfig shadow_config = {
+    .resolution = 2048,
+    .cascade_count = 3,
+    .pcf_radius = 1,
+    .split_lambda = 0.75f,
+    .max_distance = 40.0f,
+};
+// F9 cycles these, 0 uploads the mesh cache as mapped
+int vertex_format = 0;
+const VertexFormat vertex_formats[] = {
+    { POSITION_UNORM16, NORMAL_OCTAHEDRAL },
+    { POSITION_FLOAT, NORMAL_FLOAT },
+    { POSITION_HALF, NORMAL_INT_2_10_10_10 },
+    { POSITION_SNORM16, NORMAL_OCTAHEDRAL },
+};
+#define VERTEX_FORMAT_COUNT (int)(sizeof(vertex_formats) / sizeof(vertex_formats[0]))
+// F10 toggles levels of detail, F11 cycles the pixel error they may show
+bool lod_enabled = true;
+float lod_threshold = 1.0f;
+// F12 cycles off, hi-z from last frame's depth on the GPU and software occlusion on the CPU
+int occlusion_mode = OCCLUSION_OFF;
+// shaders and textures, from assets.pak next to the executable unless --loose
+Assets assets;
+// P cycles the pacing modes, --pacing <mode> and --cap <hz> pick them at start
+int pacing_mode = PACING_VSYNC;
+double frame_cap_hz = 60.0;
+// G cycles the particles off, stepped on the GPU and stepped on the CPU, --particles <count> sizes them
+int particles_mode = PARTICLES_OFF;
+int particle_count = 16384;
+// M cycles the anti-aliasing of the post chain, --aa <mode> picks it at start
+// H cycles tone mapping with bloom, without, and drawing straight to the window; --render-scale sizes the HDR target
+int post_mode = POST_BLOOM;
+PostConfig post_config = {
+    .render_scale = 1.0f,
+    .bloom_levels = 5,
+    .bloom_threshold = 1.0f,
+    .bloom_knee = 0.5f,
+    .bloom_intensity = 0.5f,
+    .exposure = 1.0f,
+    .sharpness = 0.5f,
+    .aa = POST_AA_OFF,
+    .taa_feedback = 0.1f,
+};
+// R toggles a render scale that follows GPU frame time, --dynamic-res <ms> turns it on with that target
+bool dynamic_resolution = false;
+float resolution_target_ms = 14.0f;
+// I toggles lighting from the sky's cubemaps against a flat ambient, the maps are cached in IBL_CACHE_FILE next to the assets
+bool ibl_enabled = true;
+#define IBL_CACHE_FILE "sky.ibl"
+// --lazy-gl resolves GL entry points on first call instead of all of them up front
+bool lazy_gl = false;
+
+/* mesh ids of the scene, MESH_ID in the ECS */
+enum { MESH_CUBE, MESH_TORUS, MESH_COUNT };
 
 
-typedef  struct {
-    const char *vertex_shader_source;
-    const char *fragment_shader_source;
-} Shader;
-
-typedef struct {
-    char *data;
-    size_t length;
-    size_t capacity;
-} String;
+void 
+framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    // the render thread owns the context and picks the size up from the next packet
+    screen_width = width;
+    screen_height = height;
+}
 
-String 
-string_init() 
+void
+key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
-    String t;
-    t.capacity = 256;
-    t.length = 0;
-    t.data = (char *)malloc(t.capacity * sizeof(char));
-    
-    if(!t.data) {
-        ERROR_EXIT(1, "Couldn't malloc\n");
+    (void)window;
+    (void)scancode;
+    (void)mods;
+    if(action != GLFW_PRESS)
+        return;
+
+    if(key == GLFW_KEY_F1) {
+        deferred_mode = !deferred_mode;
+        fprintf(stdout, "Lighting: %s\n", deferred_mode ? "deferred" : "forward");
+    }
+    if(key == GLFW_KEY_F2) {
+        depth_prepass = !depth_prepass;
+        fprintf(stdout, "Depth pre-pass: %s\n", depth_prepass ? "on" : "off");
+    }
+    if(key == GLFW_KEY_F3) {
+        overdraw_view = !overdraw_view;
+        fprintf(stdout, "Overdraw view: %s\n", overdraw_view ? "on" : "off");
+    }
+    if(key == GLFW_KEY_F4) {
+        static const char *names[DRAW_SORT_MODES] = { "off", "front to back", "by mesh and material" };
+        draw_sort = (draw_sort + 1) % DRAW_SORT_MODES;
+        fprintf(stdout, "Draw sort: %s\n", names[draw_sort]);
+    }
+    if(key == GLFW_KEY_F5) {
+        shadows_enabled = !shadows_enabled;
+        fprintf(stdout, "Shadows: %s\n", shadows_enabled ? "on" : "off");
+    }
+    if(key == GLFW_KEY_F6) {
+        cascaded_shadows = !cascaded_shadows;
+        fprintf(stdout, "Shadows: %s\n", cascaded_shadows ? "cascaded (directional)" : "single map (point)");
+    }
+    if(key == GLFW_KEY_F7) {
+        shadow_config.resolution = shadow_config.resolution >= 4096 ? 512 : shadow_config.resolution * 2;
+        fprintf(stdout, "Shadow map resolution: %d\n", shadow_config.resolution);
+    }
+    if(key == GLFW_KEY_F8) {
+        shadow_config.pcf_radius = (shadow_config.pcf_radius + 1) % 3;
+        fprintf(stdout, "Shadow PCF taps: %d\n", (2 * shadow_config.pcf_radius + 1) * (2 * shadow_config.pcf_radius + 1));
+    }
+    if(key == GLFW_KEY_F9) {
+        vertex_format = (vertex_format + 1) % VERTEX_FORMAT_COUNT;
+        fprintf(stdout, "Vertex format: %s\n", vertex_format_name(vertex_formats[vertex_format]));
+    }
+    if(key == GLFW_KEY_F10) {
+        lod_enabled = !lod_enabled;
+        fprintf(stdout, "Levels of detail: %s\n", lod_enabled ? "on" : "off");
+    }
+    if(key == GLFW_KEY_F11) {
+        lod_threshold = lod_threshold >= 8.0f ? 0.5f : lod_threshold * 2.0f;
+        fprintf(stdout, "LOD error threshold: %.1f px\n", lod_threshold);
+    }
+    if(key == GLFW_KEY_F12) {
+        occlusion_mode = (occlusion_mode + 1) % OCCLUSION_MODES;
+        fprintf(stdout, "Occlusion culling: %s\n", occlusion_mode_name(occlusion_mode));
+    }
+    if(key == GLFW_KEY_P) {
+        pacing_mode = (pacing_mode + 1) % PACING_MODES;
+        fprintf(stdout, "Frame pacing: %s\n", pacing_mode_name(pacing_mode));
+    }
+    if(key == GLFW_KEY_G) {
+        particles_mode = (particles_mode + 1) % PARTICLES_MODES;
+        fprintf(stdout, "Particles: %s\n", particles_mode_name(particles_mode));
+    }
+    if(key == GLFW_KEY_H) {
+        post_mode = (post_mode + 1) % POST_MODES;
+        fprintf(stdout, "Post processing: %s\n", post_mode_name(post_mode));
     }
+    if(key == GLFW_KEY_M) {
+        post_config.aa = (post_config.aa + 1) % POST_AA_MODES;
+        fprintf(stdout, "Anti-aliasing: %s\n", post_aa_name(post_config.aa));
+    }
+    if(key == GLFW_KEY_R) {
+        dynamic_resolution = !dynamic_resolution;
+        fprintf(stdout, "Dynamic resolution: %s\n", dynamic_resolution ? "on" : "off");
+    }
+    if(key == GLFW_KEY_I) {
+        ibl_enabled = !ibl_enabled;
+        fprintf(stdout, "Image based lighting: %s\n", ibl_enabled ? "on" : "off");
+    }
+}
 
-    return t;
+int
+compare_draw_items(const void *a, const void *b)
+{
+    float da = ((const DrawItem *)a)->depth;
+    float db = ((const DrawItem *)b)->depth;
+    return (da > db) - (da < db);
 }
 
-void
-string_free(String *s) 
+int
+compare_draw_states(const void *a, const void *b)
 {
-    free(s->data);
-    s->capacity = 0;
-    s->length = 0;
+    u32 sa = ((const DrawItem *)a)->state;
+    u32 sb = ((const DrawItem *)b)->state;
+    return sa != sb ? (sa > sb) - (sa < sb) : compare_draw_items(a, b);
 }
 
-char 
-*get_file_data(const char *filename, const char *r)
+/* Drops the marked draws and keeps the order of the rest, returns how many were dropped. */
+u32
+remove_occluded(FramePacket *p, const u8 *occluded)
 {
-    FILE *file = fopen(filename, r);
-    if(!file) {
-        ERROR_EXIT(1, "Couldn't open file %s\n", filename);
-    }
-    String tmp = string_init();
-    char c;
-    while((c = fgetc(file)) != EOF) {
-        tmp.data[tmp.length++] = c;
-
-        if(tmp.length > tmp.capacity - 1) {
-            tmp.capacity *= 2;
-            tmp.data = realloc(tmp.data, tmp.capacity * sizeof(char));
-        }
+    int kept = 0;
+    for(int i = 0; i < p->draw_count; i++) {
+        if(!occluded[p->draw_items[i].index])
+            p->draw_items[kept++] = p->draw_items[i];
     }
-    fclose(file);
-    tmp.data[tmp.length - 1] = '\0';
-    return tmp.data;
+    u32 removed = (u32)(p->draw_count - kept);
+    p->draw_count = kept;
+    return removed;
 }
 
-Shader 
-load_shader_source(const char *f_vertex_shader, const char * f_fragment_shader) 
+void
+draw_meshes(unsigned int program, const GpuMeshUniforms *mesh_uniforms, const FramePacket *p, const GpuMesh *meshes)
 {
-
-    
-    Shader ret;
-
-    ret.vertex_shader_source = get_file_data(f_vertex_shader, "r");
-    ret.fragment_shader_source = get_file_data(f_fragment_shader, "r");
-
-    return ret;
+    // the packet is read only, the matrix helpers want mutable pointers
+    mat4x4 *models = (mat4x4 *)p->models;
+    const DrawItem *items = p->draw_items;
+    int model_loc = glGetUniformLocation(program, "model");
+    int material_loc = glGetUniformLocation(program, "materialIndex");
+    int bound = -1;
+    u32 material = MATERIAL_NONE;
+    for(int i = 0; i < p->draw_count; i++) {
+        int index = items[i].index;
+        if(p->mesh_ids[index] != bound) {
+            bound = p->mesh_ids[index];
+            gpu_mesh_bind(&meshes[bound], mesh_uniforms);
+        }
+        // the shaders fetch the material, draws only say which
+        if(p->material_ids[index] != material) {
+            material = p->material_ids[index];
+            glUniform1i(material_loc, (int)material);
+        }
+        glUniformMatrix4fv(model_loc, 1, GL_FALSE, (GLfloat*)models[index]);
+        gpu_mesh_draw_lod(&meshes[bound], p->lods[index]);
+    }
 }
 
-unsigned int
-compile_shader(const char *shader_src, GLenum shader_type) 
+/*
+ * Fills the depth buffer with a position only program so the lit pass
+ * that follows (with GL_EQUAL) shades every pixel exactly once.
+ */
+void
+depth_prepass_begin(unsigned int depth_program, const GpuMeshUniforms *mesh_uniforms, mat4x4 view, mat4x4 projection, const FramePacket *p, const GpuMesh *meshes)
 {
-    unsigned int vf_shader = glCreateShader(shader_type);
-
-    glShaderSource(vf_shader, 1, &shader_src, NULL);
-    glCompileShader(vf_shader);
-
-    int  success;
-    char infoLog[512];
-    glGetShaderiv(vf_shader, GL_COMPILE_STATUS, &success);
-
-    if(!success) {
-        glGetShaderInfoLog(vf_shader, 512, NULL, infoLog);
-        ERROR_EXIT(1, "ERROR SHADER VERTEX COMPILATION_FAILED %s\n", infoLog);
-    }
-    return vf_shader;
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glUseProgram(depth_program);
+    glUniformMatrix4fv(glGetUniformLocation(depth_program, "projection"), 1, GL_FALSE, (GLfloat*)projection);
+    glUniformMatrix4fv(glGetUniformLocation(depth_program, "view"), 1, GL_FALSE, (GLfloat*)view);
+    draw_meshes(depth_program, mesh_uniforms, p, meshes);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    glDepthFunc(GL_EQUAL);
+    glDepthMask(GL_FALSE);
 }
 
-void 
-framebuffer_size_callback(GLFWwindow* window, int width, int height)
+void
+depth_prepass_end(void)
 {
-    glViewport(0, 0, width, height);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
 }
 
 void 
-processInput(GLFWwindow *window)
+processInput(GLFWwindow *window, SimInput *input)
 {
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-        glfwSetWindowShouldClose(window, true);
-    if(glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS) 
-        firstMouse = true;
-    const float cameraSpeed = 2.5f * delta_time; // adjust accordingly
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS){
-        vec3 temp;
-        vec3_scale(temp, cameraFront, cameraSpeed);
-        vec3_add(cameraPos, cameraPos, temp);
-        //cameraPos += cameraSpeed * cameraFront;
-    }
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS){
-        vec3 temp;
-        vec3_scale(temp, cameraFront, cameraSpeed);
-        vec3_sub(cameraPos, cameraPos, temp);
-    }
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) {
-        vec3 temp;
-        vec3 cross;
-        vec3_mul_cross(cross, cameraFront, cameraUp);
-        vec3_norm(temp, cross);
-        vec3 temp2;
-        vec3_scale(temp2, temp, cameraSpeed);
-        vec3_sub(cameraPos, cameraPos, temp2);
-        //cameraPos -= glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
-    }
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS){
-        vec3 temp;
-        vec3 cross;
-        vec3_mul_cross(cross, cameraFront, cameraUp);
-        vec3_norm(temp, cross);
-        vec3 temp2;
-        vec3_scale(temp2, temp, cameraSpeed);
-        vec3_add(cameraPos, cameraPos, temp2);
-    }
-    //cameraPos[1] = 0.0f;
+    // only sampled here, the fixed step simulation applies the movement
+    app_poll_keys(window, &mouse_look, &input->move_forward, &input->move_right);
+    vec3_dup(input->front, camera.front);
+    vec3_dup(input->right, camera.right);
+}
 
+void
+mouse_callback(GLFWwindow* window, double xpos, double ypos)
+{
+    mouse_look_move(&mouse_look, &camera, xpos, ypos);
 }
 
-    unsigned int 
-get_shader_program(const char *vertex_filename, const char *fragment_filename) 
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 {
-    Shader shader = load_shader_source(vertex_filename, fragment_filename);
-    unsigned int vertexShader = compile_shader(shader.vertex_shader_source, GL_VERTEX_SHADER);
-    unsigned int fragmentShader = compile_shader(shader.fragment_shader_source, GL_FRAGMENT_SHADER);
-    unsigned int shaderProgram = glCreateProgram();
-
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    int  success;
-    char infoLog[512];
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if(!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        ERROR_EXIT(1,"ERROR SHADER Program COMPILATION_FAILED %s\n", infoLog);
-   }
-
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    free((char*)shader.vertex_shader_source);
-    free((char*)shader.fragment_shader_source);
-
-    fprintf(stdout, "Shader program loaded\n");
-    return shaderProgram;
+    mouse_look_zoom(&camera, yoffset);
 }
 
+#define PACKET_QUEUE_SIZE 2
 
+typedef struct {
+    unsigned int shaderProgram;
+    int light_count_loc, light_pos_loc, light_color_loc, light_radius_loc;  /* in shaderProgram, looked up once after linking */
+    GpuMeshUniforms shader_mesh, shader2_mesh, gbuffer_mesh, depth_mesh, overdraw_mesh;  /* the same, per program */
+    unsigned int shader2;
+    unsigned int gbufferProgram;
+    unsigned int deferredLightProgram;
+    unsigned int depthProgram;
+    unsigned int overdrawProgram;
+    const MeshView *cube_view;
+    const Mesh *sources;      /* owned by the main thread, read only */
+    GpuMesh meshes[MESH_COUNT];
+    int vertex_format;
+    Deferred deferred;
+    Shadow shadow;
+    HiZ hiz;
+    ParticleSystem particles;
+    Post post;
+    DynamicResolution dynres;
+    Ibl ibl;
+    char ibl_cache_path[PATH_MAX + 16];
+    MaterialBuffer materials;
+    bool deferred_ready, hiz_ready, particles_ready, post_ready;  /* set up the first time a frame uses them */
+    Arena persistent;         /* lives as long as the renderer */
+    Arena frame;              /* reset every frame, also scratch while loading */
+    u64 heap_allocations;     /* by the last frame, the GL driver's included */
+    GpuTimer frame_timer;
+    GpuTimer resolution_timer;  /* scene and post, what dynamic resolution steers by */
+    double overdraw_average;
+} Renderer;
+
+typedef struct {
+    GLFWwindow *window;
+    SpscQueue packets;
+    FramePacket storage[PACKET_QUEUE_SIZE];
+    atomic_int running;
+    atomic_ullong producer_stalls;
+    const Mesh *meshes;
+    const MeshView *cube_view;
+    const MaterialLibrary *materials;
+    ShadowConfig shadow_config;   /* as they were when the thread started */
+    PostConfig post_config;
+    float resolution_target_ms;
+    atomic_int meshes_ready;  /* the renderer starts before the main thread has loaded them and built the materials */
+    int frame_wanted;         /* low latency pacing, the next frame's input may be sampled; under wanted_lock */
+    pthread_mutex_t wanted_lock;
+    pthread_cond_t wanted;
+} RenderThread;
+
+/* The cube cache is uploaded as mapped, the rest are encoded from their sources in the same format. */
 void
-mouse_callback(GLFWwindow* window, double xpos, double ypos)
+renderer_upload_meshes(Renderer *r, int format)
 {
-    if (firstMouse)
-    {
-        lastX = xpos;
-        lastY = ypos;
-        firstMouse = false;
+    for(int i = 0; i < MESH_COUNT; i++) {
+        if(i == MESH_CUBE && format == 0)
+            gpu_mesh_create_from_cache(&r->meshes[i], r->cube_view);
+        else
+            gpu_mesh_create(&r->meshes[i], &r->sources[i], vertex_formats[format]);
     }
+    r->vertex_format = format;
+}
 
-    float xoffset = xpos - lastX;
-    float yoffset = lastY - ypos; 
-    lastX = xpos;
-    lastY = ypos;
+/* The settings are copies, the main thread keeps changing its own and sends them in packets. */
+void
+renderer_init(Renderer *r, ShadowConfig shadow, PostConfig post, float resolution_ms)
+{
+    double start = glfwGetTime();
+    arena_init(&r->persistent, "render persistent", 64 << 20);
+    arena_init(&r->frame, "render frame", 64 << 20);
+    r->heap_allocations = 0;
+
+    r->shader2 = get_shader_program(&assets, &r->frame, "shaders/shader2.vs", "shaders/shader2.fs");
+    r->shader2_mesh = gpu_mesh_uniforms(r->shader2);
+    r->shaderProgram = get_shader_program(&assets, &r->frame, "shaders/shader.vs", "shaders/shader.fs");
+    r->shader_mesh = gpu_mesh_uniforms(r->shaderProgram);
+    r->light_count_loc = glGetUniformLocation(r->shaderProgram, "lightCount");
+    r->light_pos_loc = glGetUniformLocation(r->shaderProgram, "lightPos");
+    r->light_color_loc = glGetUniformLocation(r->shaderProgram, "lightColor");
+    r->light_radius_loc = glGetUniformLocation(r->shaderProgram, "lightRadius");
 
-    float sensitivity = 0.1f;
-    xoffset *= sensitivity;
-    yoffset *= sensitivity;
+    int nrAttributes;
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &nrAttributes);
+    printf("Maximum nr of vertex attributes supported: %d\n", nrAttributes);
 
-    yaw   += xoffset;
-    pitch += yoffset;
+    r->depthProgram = get_shader_program(&assets, &r->frame, "shaders/depth.vs", "shaders/depth.fs");
+    r->depth_mesh = gpu_mesh_uniforms(r->depthProgram);
+    r->overdrawProgram = 0;
+    r->deferred_ready = false;
+    r->hiz_ready = false;
+    r->particles_ready = false;
+    r->post_ready = false;
+
+    gpu_timer_init(&r->frame_timer);
+    gpu_timer_init(&r->resolution_timer);
+    dynres_init(&r->dynres, resolution_ms, 0.5f, post.render_scale);
+    STARTUP_PHASE("shadow maps", shadow_init(&r->shadow, r->depthProgram, shadow));
+    snprintf(r->ibl_cache_path, sizeof(r->ibl_cache_path), "%s" IBL_CACHE_FILE, assets.root);
+    STARTUP_PHASE("ibl", ibl_init(&r->ibl, &assets, &r->frame, r->ibl_cache_path));
+    r->overdraw_average = 0.0;
+    fprintf(stdout, "Renderer ready in %.3f ms, %u shader files (%.1f KB) read in %.3f ms from %s\n",
+            (glfwGetTime() - start) * 1000.0, assets.reads, assets.bytes / 1024.0, assets.read_ms,
+            assets.packed ? ASSETS_PACK_NAME : "loose files");
+}
 
-    if(pitch > 89.0f)
-        pitch = 89.0f;
-    if(pitch < -89.0f)
-        pitch = -89.0f;
+void
+renderer_set_meshes(Renderer *r, const Mesh *sources, const MeshView *cube_view, const MaterialLibrary *materials)
+{
+    r->sources = sources;
+    r->cube_view = cube_view;
+    STARTUP_PHASE("mesh upload", renderer_upload_meshes(r, 0));
+    STARTUP_PHASE("material upload", material_buffer_init(&r->materials, materials->materials, materials->count));
+}
 
+/* The F1 path, its programs and the g-buffer aren't made until a frame asks for them. */
+void
+renderer_init_deferred(Renderer *r, int width, int height)
+{
+    r->gbufferProgram = get_shader_program(&assets, &r->frame, "shaders/gbuffer.vs", "shaders/gbuffer.fs");
+    r->gbuffer_mesh = gpu_mesh_uniforms(r->gbufferProgram);
+    r->deferredLightProgram = get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/deferred_light.fs");
+    deferred_init(&r->deferred, r->gbufferProgram, r->deferredLightProgram, width, height);
+    r->deferred_ready = true;
 }
 
-void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+/* Same for the F12 hi-z pyramid. */
+void
+renderer_init_hiz(Renderer *r)
 {
-    fov += (float)yoffset;
-    if (fov < 1.0f)
-        fov = 1.0f;
-    if (fov > 45.0f)
-        fov = 45.0f; 
+    size_t mark = arena_mark(&r->frame);
+    unsigned int test_shader = compile_shader(assets_read(&assets, "shaders/hiz_test.vs", &r->frame, NULL), GL_VERTEX_SHADER);
+    arena_pop_to(&r->frame, mark);
+    hiz_init(&r->hiz, get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/hiz_copy.fs"),
+             get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/hiz_reduce.fs"), test_shader,
+             MAX_FRAME_OBJECTS, &r->persistent);
+    r->hiz_ready = true;
 }
 
-int
-main(int argc, char **argv)
+/* And the G fountain, rising from behind the cubes in front of the camera. */
+void
+renderer_init_particles(Renderer *r)
 {
-    (void)argc;
-    (void)argv;
+    const ParticleEmitter emitter = {
+        .position = { 0.0f, -0.5f, -4.5f },
+        .color = { 0.16f, 0.08f, 0.03f },
+        .speed = 4.5f,
+        .spread = 0.35f,
+        .lifetime = 2.5f,
+        .gravity = 4.0f,
+        .floor = -0.5f,
+        .size = 0.04f,
+    };
+    size_t mark = arena_mark(&r->frame);
+    unsigned int update_shader = compile_shader(assets_read(&assets, "shaders/particles_update.vs", &r->frame, NULL),
+                                                GL_VERTEX_SHADER);
+    arena_pop_to(&r->frame, mark);
+    particles_init(&r->particles, update_shader,
+                   get_shader_program(&assets, &r->frame, "shaders/particles.vs", "shaders/particles.fs"),
+                   particle_count, &emitter, &r->persistent);
+    r->particles_ready = true;
+}
 
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    
-    // ovo je za mac-os
-    //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+/* And the H post processing chain with its HDR target. */
+void
+renderer_init_post(Renderer *r)
+{
+    post_init(&r->post, get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/post_downsample.fs"),
+              get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/post_upsample.fs"),
+              get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/post_composite.fs"),
+              get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/post_fxaa.fs"),
+              get_shader_program(&assets, &r->frame, "shaders/deferred_light.vs", "shaders/post_taa.fs"));
+    r->post_ready = true;
+}
 
-    GLFWwindow *window = glfwCreateWindow(800, 600, "OpenGL", 0, 0);
-    if(!window) {
-        fprintf(stderr, "Couldn't create window\n");
-        glfwTerminate();
-        return -1;
+/* p is the render thread's own copy, occlusion culling removes draws from it. */
+void
+render_frame(Renderer *r, FramePacket *p, bool report_frame)
+{
+    // the targets are width x height, this frame draws into view_width x view_height of them
+    int width = p->width, height = p->height;
+    int view_width = width, view_height = height;
+    const float *lpos = p->marker_pos;
+    arena_reset(&r->frame);
+    if(p->deferred && !r->deferred_ready)
+        renderer_init_deferred(r, width, height);
+    if(p->overdraw && !r->overdrawProgram) {
+        r->overdrawProgram = get_shader_program(&assets, &r->frame, "shaders/depth.vs", "shaders/overdraw.fs");
+        r->overdraw_mesh = gpu_mesh_uniforms(r->overdrawProgram);
     }
-
-    glfwMakeContextCurrent(window);
-    
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        fprintf(stderr, "Failed to initialize GLAD\n");
-        return -1;
+    if(p->occlusion == OCCLUSION_GPU && !r->hiz_ready)
+        renderer_init_hiz(r);
+    if(p->particles != PARTICLES_OFF && !r->particles_ready)
+        renderer_init_particles(r);
+    if(p->post != POST_OFF && !p->overdraw && !r->post_ready)
+        renderer_init_post(r);
+
+    // the scene is drawn at the HDR target's size, only the composite pass is at the window's;
+    // dynamic resolution only shrinks the corner drawn, the targets stay at the configured scale
+    bool post_frame = p->post != POST_OFF && !p->overdraw;
+    if(post_frame) {
+        PostConfig config = p->post_config;
+        float scale = config.render_scale;
+        if(p->dynamic_resolution) {
+            r->dynres.target_ms = p->resolution_target_ms;
+            r->dynres.max_scale = config.render_scale;
+            scale = r->dynres.scale;
+        }
+        // the G-buffer isn't multisampled, deferred frames go without
+        if(p->deferred && config.aa >= POST_AA_MSAA2 && config.aa <= POST_AA_MSAA8)
+            config.aa = POST_AA_OFF;
+        post_configure(&r->post, config, scale, width, height);
+        post_jitter(&r->post, p->camera.projection, p->camera.view_projection);
+        width = r->post.width;
+        height = r->post.height;
+        view_width = r->post.view_width;
+        view_height = r->post.view_height;
     }
 
-    glViewport(0, 0, 800, 600);
+    // everything in the frustum is tested again at the end of the frame, hidden or not
+    int tested[MAX_FRAME_OBJECTS];
+    int tested_count = p->draw_count;
+    for(int i = 0; i < p->draw_count; i++)
+        tested[i] = p->draw_items[i].index;
+    if(p->occlusion == OCCLUSION_GPU) {
+        u8 occluded[MAX_FRAME_OBJECTS];
+        if(hiz_results(&r->hiz, p->frame, occluded, p->object_count))
+            p->occluded = remove_occluded(p, occluded);
+    }
 
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback); 
-    glfwSetCursorPosCallback(window, mouse_callback); 
-    //glfwSetScrollCallback(window, scroll_callback);
-   
-    float vertices[] = {
-        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-         0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-         0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-        -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-        -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,
-
-        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-         0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-         0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-        -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-        -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,
-
-        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-        -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-        -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,
-        -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-        -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,
-
-         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-         0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-         0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,
-         0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-         0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,
-
-        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-         0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,
-         0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,
-        -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,
-        -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,
-
-        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
-         0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,
-         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-         0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-        -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,
-        -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f
-    };
+    if(r->deferred_ready)
+        deferred_resize(&r->deferred, width, height, view_width, view_height);
+    if(p->vertex_format != r->vertex_format) {
+        for(int i = 0; i < MESH_COUNT; i++)
+            gpu_mesh_destroy(&r->meshes[i]);
+        renderer_upload_meshes(r, p->vertex_format);
+        size_t bytes = 0;
+        for(int i = 0; i < MESH_COUNT; i++)
+            bytes += r->meshes[i].vertex_bytes + r->meshes[i].index_bytes;
+        fprintf(stdout, "Meshes: %s, %u byte stride, %zu bytes\n", vertex_format_name(r->meshes[0].format),
+                r->meshes[0].stride, bytes);
+    }
+    gpu_timer_begin(&r->frame_timer);
+    gpu_timer_begin(&r->resolution_timer);
+
+    // built once on the simulation thread
+    vec4 *view = p->camera.view;
+    vec4 *projection = p->camera.projection;
+    mat4x4 model;
+
+    // the packet is read only, the matrix helpers want mutable pointers
+    mat4x4 *models = (mat4x4 *)p->models;
+
+    if(p->shadows) {
+        ShadowConfig config = p->shadow_config;
+        if(!p->cascaded)
+            config.cascade_count = 1;
+        shadow_configure(&r->shadow, config);
+
+        if(p->cascaded) {
+            shadow_update_cascades(&r->shadow, (float *)p->lights[0].position, &p->camera);
+        } else {
+            vec3 target = { 0.0f, 0.0f, 0.0f };
+            shadow_update_point(&r->shadow, (float *)lpos, target);
+        }
+        shadow_render(&r->shadow, models, p->radius, p->mesh_ids, p->lods, p->object_count, r->meshes);
+    }
+    r->deferred.shadow_light = p->shadows ? 0 : -1;
+    r->deferred.output_fbo = post_frame ? r->post.scene_fbo : 0;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, r->deferred.output_fbo);
+    glViewport(0, 0, view_width, view_height);
+    glClearColor(0.17f, 0.2f, 0.23f, 1.0f);
+    glEnable(GL_DEPTH_TEST);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    bool deferred_frame = p->deferred && !p->overdraw;
+    unsigned int program = r->shaderProgram;
+    const GpuMeshUniforms *mesh_uniforms = &r->shader_mesh;
+    if(p->overdraw) {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    } else if(deferred_frame) {
+        deferred_begin_geometry(&r->deferred, view, projection);
+    }
 
-  /*  int indices[] = {
-        0, 1, 3, 
-        1, 2, 3
-    };*/
+    if(p->depth_prepass)
+        depth_prepass_begin(r->depthProgram, &r->depth_mesh, view, projection, p, r->meshes);
+
+    if(p->overdraw) {
+        // every shaded fragment adds 1/16, so 16 layers saturate to white
+        program = r->overdrawProgram;
+        mesh_uniforms = &r->overdraw_mesh;
+        glUseProgram(program);
+        glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, (GLfloat*)projection);
+        glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (GLfloat*)view);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE);
+    } else if(deferred_frame) {
+        program = r->gbufferProgram;
+        mesh_uniforms = &r->gbuffer_mesh;
+        glUseProgram(program);
+    } else {
+        glUseProgram(program);
+        // the packet interleaves the lights, the shader wants one array per field
+        vec3 light_pos[MAX_LIGHTS], light_color[MAX_LIGHTS];
+        float light_radius[MAX_LIGHTS];
+        for(int i = 0; i < p->light_count; i++) {
+            vec3_dup(light_pos[i], p->lights[i].position);
+            vec3_dup(light_color[i], p->lights[i].color);
+            light_radius[i] = p->lights[i].radius;
+        }
+        glUniform1i(r->light_count_loc, p->light_count);
+        if(p->light_count > 0) {
+            glUniform3fv(r->light_pos_loc, p->light_count, (GLfloat*)light_pos);
+            glUniform3fv(r->light_color_loc, p->light_count, (GLfloat*)light_color);
+            glUniform1fv(r->light_radius_loc, p->light_count, light_radius);
+        }
+        glUniform3fv(glGetUniformLocation(program, "viewPos"), 1, p->camera.position);
+        glUniform1i(glGetUniformLocation(program, "iblEnabled"), p->ibl);
+        ibl_bind(&r->ibl, program);
+        material_buffer_bind(&r->materials, program);
+        glUniform1i(glGetUniformLocation(program, "shadowLight"), p->shadows ? 0 : -1);
+        glUniform1i(glGetUniformLocation(program, "shadowMap"), SHADOW_TEXTURE_UNIT);
+        if(p->shadows)
+            shadow_bind(&r->shadow, program, SHADOW_TEXTURE_UNIT);
+
+        glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, (GLfloat*)projection);
+        glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (GLfloat*)view);
+    }
 
-    unsigned int shader2 = get_shader_program("shaders/shader2.vs", "shaders/shader2.fs");
-    unsigned int shaderProgram = get_shader_program("shaders/shader.vs", "shaders/shader.fs");
-    
-    unsigned int vao1, VBO;
-    
-    glGenVertexArrays(1, &vao1);
-    glGenBuffers(1, &VBO);
+    draw_meshes(program, mesh_uniforms, p, r->meshes);
+
+    if(p->depth_prepass)
+        depth_prepass_end();
+
+    if(p->overdraw) {
+        glDisable(GL_BLEND);
+        if(report_frame) {
+            r->overdraw_average = 0.0;
+            u8 *pixels = ARENA_ARRAY(&r->frame, u8, (size_t)width * height);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, width, height, GL_RED, GL_UNSIGNED_BYTE, pixels);
+            for(int i = 0; i < width * height; i++)
+                r->overdraw_average += pixels[i] / 16.0;
+            r->overdraw_average /= (double)width * height;
+        }
+    }
 
-    glBindVertexArray(vao1);
+    if(deferred_frame) {
+        deferred_end_geometry(&r->deferred);
+        glUseProgram(r->deferredLightProgram);
+        if(p->shadows)
+            shadow_bind(&r->shadow, r->deferredLightProgram, SHADOW_TEXTURE_UNIT);
+        glUniform1i(glGetUniformLocation(r->deferredLightProgram, "iblEnabled"), p->ibl);
+        ibl_bind(&r->ibl, r->deferredLightProgram);
+        material_buffer_bind(&r->materials, r->deferredLightProgram);
+        deferred_light_pass(&r->deferred, p->lights, p->light_count, view, projection);
+    }
 
+    if(p->ibl && !p->overdraw)
+        ibl_draw_sky(&r->ibl, view, projection);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
 
-    unsigned int  VAO;
-    glGenVertexArrays(1, &VAO);
+    if(!p->overdraw) {
+        glUseProgram(r->shader2);
 
-    glBindVertexArray(VAO);
+        glUniformMatrix4fv(glGetUniformLocation(r->shader2, "projection"), 1, GL_FALSE, (GLfloat*)projection);
+        glUniformMatrix4fv(glGetUniformLocation(r->shader2, "view"), 1, GL_FALSE, (GLfloat*)view);
+    
+        mat4x4_translate(model, lpos[0], lpos[1], lpos[2]);
+        mat4x4 amodel;
+        mat4x4_scale_aniso(amodel, model, 0.3f, 0.3f, 0.3f);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glUniformMatrix4fv(glGetUniformLocation(r->shader2, "model"), 1, GL_FALSE, (GLfloat*)amodel);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+        gpu_mesh_bind(&r->meshes[MESH_CUBE], &r->shader2_mesh);
+        gpu_mesh_draw(&r->meshes[MESH_CUBE]);
+    }
 
-    int nrAttributes;
-    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &nrAttributes);
-    printf("Maximum nr of vertex attributes supported: %d\n", nrAttributes);
+    if(p->particles != PARTICLES_OFF && !p->overdraw) {
+        if(p->particles == PARTICLES_GPU)
+            particles_update_gpu(&r->particles, p->delta);
+        else
+            particles_update_cpu(&r->particles, p->delta);
+        particles_draw(&r->particles, view, projection);
+    }
 
-    
-    //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    //print_mat4x4(trans);
-   
-    float start_frame = glfwGetTime(), end_frame;
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    gpu_timer_end(&r->frame_timer);
 
-    vec3 lpos = {1.2f, 1.0f, 2.0f};
+    if(post_frame)
+        post_end(&r->post, p->post, p->width, p->height);
 
-    while(!glfwWindowShouldClose(window)) {
-        processInput(window);
+    // only a new result moves the controller, gpu_timer_end doesn't always have one
+    u32 samples = r->resolution_timer.samples;
+    gpu_timer_end(&r->resolution_timer);
+    if(p->dynamic_resolution && post_frame && r->resolution_timer.samples != samples)
+        dynres_update(&r->dynres, r->resolution_timer.last_ms);
 
-        glClearColor(0.17f, 0.2f, 0.23f, 1.0f);
-        glEnable(GL_DEPTH_TEST);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if(p->occlusion == OCCLUSION_GPU) {
+        unsigned int depth = deferred_frame ? r->deferred.depth_tex : post_frame ? r->post.depth_tex : 0;
+        hiz_build(&r->hiz, depth, width, height, view_width, view_height);
+        hiz_test(&r->hiz, p->bounds_min, p->bounds_max, tested, tested_count, p->camera.view_projection, p->frame);
+    }
+}
 
-        vec3 direction;
-        direction[0] = cosf(RADIANS(yaw)) * cosf(RADIANS(pitch)); 
-        direction[1] = sinf(RADIANS(pitch));
-        direction[2] = sinf(RADIANS(yaw)) * cosf(RADIANS(pitch));
+void
+renderer_report(Renderer *r, const FramePacket *p)
+{
+    fprintf(stdout, "%s%s: %.3f ms GPU, %d/%d objects visible, %u/%u transforms updated, %s", p->deferred ? "deferred" : "forward",
+            p->depth_prepass ? " + pre-pass" : "", gpu_timer_average(&r->frame_timer), p->draw_count, p->object_count,
+            p->transforms_updated, p->transform_count, vertex_format_name(r->meshes[0].format));
+    fprintf(stdout, ", %u/%u triangles (%.0f%%)", p->triangles, p->full_triangles,
+            p->full_triangles ? 100.0 * p->triangles / p->full_triangles : 100.0);
+    if(p->overdraw)
+        fprintf(stdout, ", %.2f shaded fragments per pixel", r->overdraw_average);
+    fprintf(stdout, "\n");
+    if(p->occlusion == OCCLUSION_GPU) {
+        fprintf(stdout, "  occlusion %s: %u draws rejected, %.3f ms GPU, %dx%d pyramid %d levels, %.1f MB\n",
+                occlusion_mode_name(p->occlusion), p->occluded, gpu_timer_average(&r->hiz.timer), r->hiz.width,
+                r->hiz.height, r->hiz.levels, hiz_memory(&r->hiz) / (1024.0 * 1024.0));
+        gpu_timer_reset(&r->hiz.timer);
+    } else if(p->occlusion == OCCLUSION_CPU) {
+        fprintf(stdout, "  occlusion %s: %u draws rejected, %.3f ms CPU, %u occluder triangles at %dx%d\n",
+                occlusion_mode_name(p->occlusion), p->occluded, p->occlusion_ms, p->occluder_triangles,
+                OCCLUSION_WIDTH, OCCLUSION_HEIGHT);
+    }
+    if(p->particles != PARTICLES_OFF) {
+        ParticleSystem *ps = &r->particles;
+        if(p->particles == PARTICLES_GPU)
+            fprintf(stdout, "  particles gpu: %d, step %.3f ms GPU", ps->count, gpu_timer_average(&ps->update_timer));
+        else
+            fprintf(stdout, "  particles cpu: %d, step and upload %.3f ms CPU", ps->count, ps->cpu_ms);
+        fprintf(stdout, ", draw %.3f ms GPU\n", gpu_timer_average(&ps->draw_timer));
+        gpu_timer_reset(&ps->update_timer);
+        gpu_timer_reset(&ps->draw_timer);
+    }
+    if(p->post != POST_OFF && !p->overdraw) {
+        Post *post = &r->post;
+        fprintf(stdout, "  post %s at %dx%d (%.0f%%): ", post_mode_name(p->post), post->view_width, post->view_height,
+                post->scale * 100.0f);
+        if(p->post == POST_BLOOM)
+            fprintf(stdout, "bloom down %.3f ms, up %.3f ms over %d levels, ", gpu_timer_average(&post->bloom_down_timer),
+                    gpu_timer_average(&post->bloom_up_timer), post->bloom_levels);
+        fprintf(stdout, "composite %.3f ms", gpu_timer_average(&post->composite_timer));
+        if(post->config.aa != POST_AA_OFF)
+            fprintf(stdout, ", %s %.3f ms", post_aa_name(post->config.aa), gpu_timer_average(&post->aa_timer));
+        fprintf(stdout, " GPU, %.1f MB\n", post_memory(post) / (1024.0 * 1024.0));
+        gpu_timer_reset(&post->aa_timer);
+        gpu_timer_reset(&post->bloom_down_timer);
+        gpu_timer_reset(&post->bloom_up_timer);
+        gpu_timer_reset(&post->composite_timer);
+    }
+    if(p->dynamic_resolution && p->post != POST_OFF && !p->overdraw) {
+        DynamicResolution *d = &r->dynres;
+        fprintf(stdout, "  dynamic resolution: %.0f%% of the window, %.3f ms GPU against %.1f ms, %u/%u frames over, %u changes\n",
+                d->scale * 100.0f, gpu_timer_average(&r->resolution_timer), d->target_ms, d->over_target, d->frames,
+                d->changes);
+        dynres_reset_stats(d);
+    }
+    gpu_timer_reset(&r->resolution_timer);
+    if(p->ibl && !p->overdraw)
+        fprintf(stdout, "  ibl: %s%s in %.3f ms, %.1f MB\n", r->ibl.from_cache ? "loaded from " : "generated",
+                r->ibl.from_cache ? r->ibl_cache_path : "", r->ibl.build_ms, ibl_memory(&r->ibl) / (1024.0 * 1024.0));
+    fprintf(stdout, "  materials: %u, %.1f KB buffer texture\n", r->materials.count,
+            material_buffer_memory(&r->materials) / 1024.0);
+    fprintf(stdout, "  memory: sim frame arena %.1f KB, ", p->sim_frame_bytes / 1024.0);
+    arena_print(stdout, &r->frame);
+    fprintf(stdout, ", ");
+    arena_print(stdout, &r->persistent);
+#ifdef MEMORY_DEBUG
+    fprintf(stdout, ", heap allocations last frame: sim %llu, render %llu (GL driver included)",
+            (unsigned long long)p->sim_heap_allocations, (unsigned long long)r->heap_allocations);
+#endif
+    fprintf(stdout, "\n");
+    if(p->shadows) {
+        Shadow *shadow = &r->shadow;
+        fprintf(stdout, "  shadows %dx%d, %d taps, %.1f MB:", shadow->config.resolution, shadow->config.resolution,
+                (2 * shadow->config.pcf_radius + 1) * (2 * shadow->config.pcf_radius + 1),
+                shadow_memory(shadow) / (1024.0 * 1024.0));
+        for(int c = 0; c < shadow->cascade_count; c++) {
+            fprintf(stdout, " [%d] %.3f ms, %d drawn", c, gpu_timer_average(&shadow->timers[c]), shadow->drawn[c]);
+            gpu_timer_reset(&shadow->timers[c]);
+        }
+        fprintf(stdout, "\n");
+    }
+    gpu_timer_reset(&r->frame_timer);
+}
 
-        vec3_norm(cameraFront, direction);
+void
+renderer_destroy(Renderer *r)
+{
+    for(int i = 0; i < MESH_COUNT; i++)
+        gpu_mesh_destroy(&r->meshes[i]);
+    if(r->deferred_ready)
+        deferred_destroy(&r->deferred);
+    shadow_destroy(&r->shadow);
+    ibl_destroy(&r->ibl);
+    material_buffer_destroy(&r->materials);
+    if(r->hiz_ready)
+        hiz_destroy(&r->hiz);
+    if(r->particles_ready)
+        particles_destroy(&r->particles);
+    if(r->post_ready)
+        post_destroy(&r->post);
+    gpu_timer_destroy(&r->frame_timer);
+    gpu_timer_destroy(&r->resolution_timer);
+    arena_destroy(&r->persistent);
+    arena_destroy(&r->frame);
+}
 
+/*
+ * Owns the GL context for its whole life. Consumes packets in order and
+ * measures build-to-present latency of each one. Every swap is followed
+ * by a fence, low latency pacing waits on them before asking for input.
+ */
+void *
+render_thread_main(void *arg)
+{
+    RenderThread *rt = arg;
+
+    app_load_gl(rt->window, lazy_gl);
+
+    Renderer renderer;
+    STARTUP_PHASE("renderer", renderer_init(&renderer, rt->shadow_config, rt->post_config, rt->resolution_target_ms));
+    double wait_begin = startup_now();
+    while(!atomic_load(&rt->meshes_ready))
+        sched_yield();
+    startup_end(startup_begin("wait for meshes"), wait_begin);
+    renderer_set_meshes(&renderer, rt->meshes, rt->cube_view, rt->materials);
+    bool first_frame = true;
+
+    FramePacket packet;
+    double last_report = glfwGetTime();
+    u64 frames = 0, last_sim_steps = 0, last_packet = 0;
+    double latency_total = 0.0, latency_max = 0.0;
+    int pacing = -1;
+    FrameFences fences;
+    frame_fences_init(&fences);
+    PacingStats pacing_stats = { 0 };
+    double fence_wait = 0.0;
+    bool requested = false;
+
+    while(atomic_load(&rt->running)) {
+        // asked for in every mode, the first low latency packet is built before this thread knows the mode
+        if(!requested) {
+            if(pacing == PACING_LOW_LATENCY)
+                fence_wait = frame_fences_wait(&fences, PACING_LOW_LATENCY_FRAMES);
+            pthread_mutex_lock(&rt->wanted_lock);
+            rt->frame_wanted = 1;
+            pthread_cond_signal(&rt->wanted);
+            pthread_mutex_unlock(&rt->wanted_lock);
+            requested = true;
+        }
+        if(!spsc_pop(&rt->packets, &packet)) {
+            sched_yield();
+            continue;
+        }
+        requested = false;
+        if(packet.pacing != pacing) {
+            pacing = packet.pacing;
+            glfwSwapInterval(pacing_swap_interval(pacing));
+        }
 
-        lpos[0] = sinf(glfwGetTime()) * 2.0f;
-        lpos[2] = cosf(glfwGetTime())  * 2.0f;
+        bool report_frame = glfwGetTime() - last_report >= 1.0;
+        u64 heap_start = memory_heap_allocations();
+        double frame_begin = startup_now();
+        render_frame(&renderer, &packet, report_frame);
+        if(first_frame)
+            startup_end(startup_begin("first frame"), frame_begin);
+        renderer.heap_allocations = memory_heap_allocations() - heap_start;
+        glfwSwapBuffers(rt->window);
+        frame_fences_insert(&fences);
+        double swapped = glfwGetTime();
+        pacing_stats_frame(&pacing_stats, swapped, swapped - packet.input_time, fence_wait + packet.pacing_wait);
+        fence_wait = 0.0;
+        if(first_frame) {
+            startup_first_frame(stdout);
+            if(lazy_gl)
+                fprintf(stdout, "  %u GL entry points resolved lazily\n", glad_lazy_resolved);
+            first_frame = false;
+        }
 
-        mat4x4 view;
-        mat4x4_identity(view); 
-        mat4x4 model;
-        mat4x4_identity(model); 
-        vec3 add;
-        vec3_add(add, cameraPos, cameraFront);
-        mat4x4_look_at(view, cameraPos, add, cameraUp);
-        mat4x4 projection;
-        mat4x4_identity(projection); 
-        mat4x4_perspective(projection, RADIANS(fov), 800.0f/600.0f, 0.01f, 100.0f);
+        double latency = swapped - packet.build_time;
+        latency_total += latency;
+        if(latency > latency_max)
+            latency_max = latency;
+        frames++;
+
+        if(report_frame) {
+            double now = glfwGetTime();
+            double elapsed = now - last_report;
+            renderer_report(&renderer, &packet);
+            fprintf(stdout, "  %.1f frames/s rendered, %.1f packets/s built, %llu sim steps, "
+                    "latency %.2f ms avg %.2f ms max, %llu producer stalls\n",
+                    frames / elapsed, (packet.frame - last_packet) / elapsed,
+                    (unsigned long long)(packet.sim_steps - last_sim_steps),
+                    latency_total / frames * 1000.0, latency_max * 1000.0,
+                    (unsigned long long)atomic_exchange(&rt->producer_stalls, 0));
+            pacing_stats_report(&pacing_stats, stdout, pacing);
+            last_sim_steps = packet.sim_steps;
+            last_packet = packet.frame;
+            frames = 0;
+            latency_total = 0.0;
+            latency_max = 0.0;
+            last_report = now;
+        }
+    }
 
+    frame_fences_destroy(&fences);
+    renderer_destroy(&renderer);
+    glfwMakeContextCurrent(NULL);
+    return NULL;
+}
 
-        glUseProgram(shaderProgram);
-        glUniform3fv(glGetUniformLocation(shaderProgram, "lightPos"), 1, lpos);
-        glUniform3fv(glGetUniformLocation(shaderProgram, "viewPos"), 1, cameraPos);
-        glUniform3f(glGetUniformLocation(shaderProgram, "objectColor"), 1.0f, 0.5f, 0.31f);
-        glUniform3f(glGetUniformLocation(shaderProgram, "lightColor"), 1.0f, 1.0f, 1.0f);
+/*
+ * The cubes, the floor they stand on, two rows of tori running into the
+ * distance and the lights, their materials go into lib. Returns the light
+ * that orbits the first cube and is parented to it, the rest are static
+ * fill lights.
+ */
+Entity
+create_scene(EcsWorld *w, MaterialLibrary *lib)
+{
+    vec3 cubePositions[] = {
+        {  0.0f,  0.0f,  0.0f }, 
+        {  2.0f,  0.0f, -15.0 }, 
+        { -1.5f,  0.0f, -2.5f },  
+        { -3.8f,  0.0f, -12.3f},  
+        {  2.4f,  0.0f, -3.5f },  
+        { -1.7f,  0.0f, -7.5f },  
+        {  1.3f,  0.0f, -2.5f },  
+        {  1.5f,  0.0f, -2.5f }, 
+        {  1.5f,  0.0f, -1.5f }, 
+        { -1.3f,  0.0f, -1.5f }  
+    };
+    const int cube_count = sizeof(cubePositions) / sizeof(cubePositions[0]);
+    vec3 coral = { 1.0f, 0.5f, 0.31f };
+    vec3 unit = { 1.0f, 1.0f, 1.0f };
+    vec3 origin = { 0.0f, 0.0f, 0.0f };
+
+    // everything hangs off one root, moving it moves the whole scene
+    Entity root = ecs_create(w);
+    ecs_add_transform(w, root, ECS_NULL, origin, 0.0f, unit);
+
+    Entity first_cube = ECS_NULL;
+    for(int i = 0; i < cube_count; i++) {
+        Entity e = ecs_create(w);
+        ecs_add_transform(w, e, root, cubePositions[i], RADIANS(20.0f * i), unit);
+        if(i == 0)
+            first_cube = e;
+        ecs_add_mesh(w, e, MESH_CUBE, 0.87f);
+        // one material each, from polished to chalky
+        ecs_add_material(w, e, material_add(lib, coral, 0.0f, 0.2f + 0.6f * i / (cube_count - 1)));
+    }
 
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, (GLfloat*)projection);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, (GLfloat*)view);
+    Entity floor = ecs_create(w);
+    vec3 floor_position = { 0.0f, -0.55f, -6.0f };
+    vec3 floor_scale = { 24.0f, 0.1f, 24.0f };
+    vec3 floor_color = { 0.6f, 0.6f, 0.6f };
+    ecs_add_transform(w, floor, root, floor_position, 0.0f, floor_scale);
+    ecs_add_mesh(w, floor, MESH_CUBE, 17.0f);
+    ecs_add_material(w, floor, material_add(lib, floor_color, 0.0f, 0.8f));
+
+    // detailed enough that the far ones are worth simplifying
+    vec3 teal = { 0.2f, 0.7f, 0.8f };
+    vec3 torus_scale = { 0.6f, 0.6f, 0.6f };
+    u32 teal_metal = material_add(lib, teal, 1.0f, 0.35f);
+    for(int i = 0; i < 20; i++) {
+        Entity e = ecs_create(w);
+        vec3 position = { i % 2 ? 3.2f : -3.2f, -0.29f, 1.0f - 2.0f * i };
+        ecs_add_transform(w, e, root, position, 0.0f, torus_scale);
+        ecs_add_mesh(w, e, MESH_TORUS, 1.35f * 0.6f);
+        ecs_add_material(w, e, teal_metal);
+    }
 
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, (GLfloat*)model);
-        glBindVertexArray(VAO); 
-       // glDrawArrays(GL_TRIANGLES, 0, 3);
-       //
-        //glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+    Light lights[] = {
+        { {  1.2f, 1.0f,   2.0f }, { 1.0f, 1.0f, 1.0f }, 50.0f },
+        { { -3.0f, 1.5f,  -5.0f }, { 0.2f, 0.4f, 1.0f },  6.0f },
+        { {  3.0f, 1.5f,  -6.0f }, { 1.0f, 0.3f, 0.2f },  6.0f },
+        { {  0.0f, 1.5f, -10.0f }, { 0.3f, 1.0f, 0.3f },  8.0f },
+        { {  1.0f, 0.8f, -13.0f }, { 1.0f, 0.8f, 0.3f },  5.0f },
+        { { -2.0f, 0.8f,  -1.0f }, { 0.8f, 0.2f, 0.9f },  3.0f },
+    };
+    const int light_count = sizeof(lights) / sizeof(lights[0]);
+    Entity orbit_light = ECS_NULL;
+    for(int i = 0; i < light_count; i++) {
+        Entity e = ecs_create(w);
+        ecs_add_transform(w, e, i == 0 ? first_cube : root, lights[i].position, 0.0f, unit);
+        ecs_add_light(w, e, lights[i].color, lights[i].radius);
+        if(i == 0)
+            orbit_light = e;
+    }
+    return orbit_light;
+}
 
+int
+main(int argc, char **argv)
+{
+    startup_init();
+    bool loose = false;
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "--loose"))
+            loose = true;
+        if(!strcmp(argv[i], "--lazy-gl"))
+            lazy_gl = true;
+        if(!strcmp(argv[i], "--pacing") && i + 1 < argc) {
+            pacing_mode = pacing_mode_from_name(argv[++i]);
+            if(pacing_mode < 0) {
+                ERROR_EXIT(1, "Unknown pacing mode %s, one of vsync, uncapped, capped, low-latency\n", argv[i]);
+            }
+        }
+        if(!strcmp(argv[i], "--particles") && i + 1 < argc) {
+            particle_count = atoi(argv[++i]);
+            if(particle_count <= 0) {
+                ERROR_EXIT(1, "--particles takes a count\n");
+            }
+        }
+        if(!strcmp(argv[i], "--render-scale") && i + 1 < argc) {
+            post_config.render_scale = (float)atof(argv[++i]);
+            if(post_config.render_scale <= 0.0f || post_config.render_scale > 4.0f) {
+                ERROR_EXIT(1, "--render-scale takes a factor of the window size up to 4\n");
+            }
+        }
+        if(!strcmp(argv[i], "--aa") && i + 1 < argc) {
+            post_config.aa = post_aa_from_name(argv[++i]);
+            if(post_config.aa < 0) {
+                ERROR_EXIT(1, "Unknown anti-aliasing %s, one of off, msaa2, msaa4, msaa8, fxaa, taa\n", argv[i]);
+            }
+        }
+        if(!strcmp(argv[i], "--dynamic-res") && i + 1 < argc) {
+            dynamic_resolution = true;
+            resolution_target_ms = (float)atof(argv[++i]);
+            if(resolution_target_ms <= 0.0f) {
+                ERROR_EXIT(1, "--dynamic-res takes a GPU frame time in milliseconds\n");
+            }
+        }
+        if(!strcmp(argv[i], "--cap") && i + 1 < argc) {
+            frame_cap_hz = atof(argv[++i]);
+            if(frame_cap_hz <= 0.0) {
+                ERROR_EXIT(1, "--cap takes frames per second\n");
+            }
+        }
+    }
+    STARTUP_PHASE("assets", assets_init(&assets, loose));
+    fprintf(stdout, "Assets from %s%s (opened in %.3f ms)\n", assets.root,
+            assets.packed ? ASSETS_PACK_NAME : "", assets.open_ms);
 
+    GLFWwindow *window = app_create_window("OpenGL", screen_width, screen_height);
+    if(!window)
+        return -1;
 
-        glUseProgram(shader2);
+    vec3 start_position = { 0.0f, 0.0f, 3.0f };
+    camera_init(&camera, start_position, RADIANS(-90.0f), 0.0f, RADIANS(45.0f),
+                (float)screen_width / (float)screen_height, 0.01f, 100.0f);
 
-        glUniformMatrix4fv(glGetUniformLocation(shader2, "projection"), 1, GL_FALSE, (GLfloat*)projection);
-        glUniformMatrix4fv(glGetUniformLocation(shader2, "view"), 1, GL_FALSE, (GLfloat*)view);
-        
-        mat4x4_identity(model);
-        mat4x4_translate(model, lpos[0], lpos[1], lpos[2]);
-        mat4x4 amodel;
-        mat4x4_scale_aniso(amodel, model, 0.3f, 0.3f, 0.3f);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback); 
+    glfwSetCursorPosCallback(window, mouse_callback); 
+    //glfwSetScrollCallback(window, scroll_callback);
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    glfwSetKeyCallback(window, key_callback);
+
+    // input and simulation stay on this thread, GL moves to the render thread, which
+    // compiles its shaders while the meshes below load
+    static RenderThread rt;
+    rt.window = window;
+    spsc_init(&rt.packets, rt.storage, sizeof(FramePacket), PACKET_QUEUE_SIZE);
+    atomic_init(&rt.running, 1);
+    atomic_init(&rt.producer_stalls, 0);
+    atomic_init(&rt.meshes_ready, 0);
+    rt.frame_wanted = 0;
+    pthread_mutex_init(&rt.wanted_lock, NULL);
+    pthread_cond_init(&rt.wanted, NULL);
+    rt.shadow_config = shadow_config;
+    rt.post_config = post_config;
+    rt.resolution_target_ms = resolution_target_ms;
+
+    pthread_t render_thread;
+    if(pthread_create(&render_thread, NULL, render_thread_main, &rt) != 0) {
+        ERROR_EXIT(1, "Couldn't start render thread\n");
+    }
 
-        glUniformMatrix4fv(glGetUniformLocation(shader2, "model"), 1, GL_FALSE, (GLfloat*)amodel);
+    // the simulation picks levels of detail from the same meshes the renderer uploads
+    static MeshView cube_view;
+    static Mesh scene_meshes[MESH_COUNT];
+    double start = glfwGetTime();
+    double meshes_begin = startup_now();
+    char obj_path[sizeof(assets.root) + 32], cache_path[sizeof(assets.root) + 32];
+    snprintf(obj_path, sizeof(obj_path), "%smodeli/kocka.obj", assets.root);
+    snprintf(cache_path, sizeof(cache_path), "%smodeli/kocka.mesh", assets.root);
+    mesh_load_cached(obj_path, cache_path, &cube_view);
+    mesh_from_cache(&cube_view, &scene_meshes[MESH_CUBE]);
+    fprintf(stdout, "Cube mesh loaded in %.3f ms\n", (glfwGetTime() - start) * 1000.0);
+    // procedural, but building its levels of detail took longer than the rest of startup together
+    start = glfwGetTime();
+    MeshView torus_view;
+    snprintf(cache_path, sizeof(cache_path), "%smodeli/torus_96x48.mesh", assets.root);
+    if(!mesh_map_cache(cache_path, &torus_view)) {
+        Mesh torus;
+        mesh_torus(&torus, 96, 48);
+        mesh_build_lods(&torus, MESH_LOD_MAX_ERROR * mesh_radius(&torus));
+        mesh_optimize(&torus);
+        mesh_write_cache(&torus, cache_path);
+        mesh_free(&torus);
+        if(!mesh_map_cache(cache_path, &torus_view)) {
+            ERROR_EXIT(1, "Couldn't map mesh cache %s\n", cache_path);
+        }
+    }
+    mesh_from_cache(&torus_view, &scene_meshes[MESH_TORUS]);
+    mesh_unmap(&torus_view);
+    fprintf(stdout, "Torus levels of detail loaded in %.3f ms:", (glfwGetTime() - start) * 1000.0);
+    for(u32 i = 0; i < scene_meshes[MESH_TORUS].lod_count; i++)
+        fprintf(stdout, " %u", scene_meshes[MESH_TORUS].lods[i].index_count / 3);
+    fprintf(stdout, " triangles\n");
+    startup_end(startup_begin("meshes"), meshes_begin);
+
+    // the renderer uploads the materials with the meshes, the scene is built before it is told
+    static Arena persistent, frame_arena;
+    arena_init(&persistent, "sim persistent", 16 << 20);
+    arena_init(&frame_arena, "sim frame", 16 << 20);
+    static EcsWorld world;
+    ecs_init(&world, 1024);
+    static MaterialLibrary materials;
+    material_library_init(&materials, &persistent, 1024);
+    Entity orbit_light = create_scene(&world, &materials);
+
+    rt.meshes = scene_meshes;
+    rt.cube_view = &cube_view;
+    rt.materials = &materials;
+    atomic_store(&rt.meshes_ready, 1);
+
+    // one thread each for input and rendering, the job workers get the remaining cores
+    static JobSystem jobs;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    job_system_init(&jobs, cores > 2 ? (int)cores - 1 : 1);
+
+    Sim sim;
+    sim_init(&sim, camera.position);
+    SimInput input;
+    SimState state;
+    static FramePacket packet;
+    // nothing below reaches the heap once the loop runs
+    static SoftwareOcclusion software_occlusion;
+    occlusion_init(&software_occlusion, &persistent);
+    double start_frame = glfwGetTime(), end_frame;
+    FrameCap frame_cap;
+    frame_cap_init(&frame_cap, frame_cap_hz);
 
-        glBindVertexArray(vao1);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-      
-        glfwSwapBuffers(window);
+    while(!glfwWindowShouldClose(window)) {
+        // input is sampled after the wait, so time spent waiting doesn't count against latency
+        double pacing_wait = 0.0;
+        if(pacing_mode == PACING_CAPPED) {
+            pacing_wait = frame_cap_wait(&frame_cap);
+        } else if(pacing_mode == PACING_LOW_LATENCY) {
+            // asleep until the render thread asks, it does before every wait for a packet
+            double wait_start = pacing_now();
+            pthread_mutex_lock(&rt.wanted_lock);
+            while(!rt.frame_wanted)
+                pthread_cond_wait(&rt.wanted, &rt.wanted_lock);
+            rt.frame_wanted = 0;
+            pthread_mutex_unlock(&rt.wanted_lock);
+            pacing_wait = pacing_now() - wait_start;
+        }
         glfwPollEvents();    
+        arena_reset(&frame_arena);
+        u64 heap_start = memory_heap_allocations();
+
+        // the basis is only rebuilt when the mouse moved, movement is sampled along it
+        camera_update(&camera);
 
         end_frame = glfwGetTime();
-        delta_time = end_frame - start_frame;
+        double input_time = end_frame, delta = end_frame - start_frame;
+        processInput(window, &input);
+        sim_advance(&sim, delta, &input);
         start_frame = end_frame;
+
+        // rendering sees a blend of the last two fixed steps, so motion stays smooth at any frame rate
+        sim_interpolate(&sim, &state);
+        vec3_dup(camera.position, state.camera_pos);
+        // a minimized window reports a zero height, keep the last aspect until it comes back
+        if(screen_height > 0)
+            camera_set_lens(&camera, camera.fov, (float)screen_width / (float)screen_height, camera.near, camera.far);
+        camera_update(&camera);
+
+        FramePacket *p = &packet;
+        p->frame++;
+        p->sim_steps = sim.steps;
+        p->width = screen_width;
+        p->height = screen_height;
+        p->camera = camera;
+        p->deferred = deferred_mode;
+        p->depth_prepass = depth_prepass;
+        p->overdraw = overdraw_view;
+        p->shadows = shadows_enabled;
+        p->cascaded = cascaded_shadows;
+        p->shadow_config = shadow_config;
+        p->vertex_format = vertex_format;
+        p->occlusion = occlusion_mode;
+        p->pacing = pacing_mode;
+        p->input_time = input_time;
+        p->pacing_wait = pacing_wait;
+        p->particles = particles_mode;
+        p->post = post_mode;
+        p->post_config = post_config;
+        p->dynamic_resolution = dynamic_resolution;
+        p->resolution_target_ms = resolution_target_ms;
+        p->ibl = ibl_enabled;
+        p->delta = (float)delta;
+
+        // the orbiting light is driven by the simulation, the rest of the scene is static and not recomputed
+        Hierarchy *transforms = &world.transforms;
+        hierarchy_set_position(transforms, ecs_node(&world, orbit_light), state.light_pos);
+        hierarchy_update(transforms);
+        vec3_dup(p->marker_pos, state.light_pos);
+
+        // meshes and materials walk in lockstep, world matrices are gathered from the hierarchy;
+        // that only holds while every mesh has a material, otherwise the slots drift apart
+        u32 mesh_count = ecs_align(&world, ECS_MATERIAL, ECS_MESH);
+        if(mesh_count != ecs_count(&world, ECS_MESH)) {
+            ERROR_EXIT(1, "%u of %u meshes have a material\n", mesh_count, ecs_count(&world, ECS_MESH));
+        }
+        if(mesh_count > MAX_FRAME_OBJECTS)
+            mesh_count = MAX_FRAME_OBJECTS;
+        const Entity *meshes = ecs_entities(&world, ECS_MESH);
+        for(u32 i = 0; i < mesh_count; i++)
+            mat4x4_dup(p->models[i], (vec4 *)hierarchy_world(transforms, ecs_node(&world, meshes[i])));
+        memcpy(p->radius, ecs_column(&world, ECS_MESH, MESH_RADIUS), sizeof(float) * mesh_count);
+        memcpy(p->material_ids, ecs_column(&world, ECS_MATERIAL, MATERIAL_ID), sizeof(u32) * mesh_count);
+        p->object_count = mesh_count;
+        p->transforms_updated = transforms->updated;
+        p->transform_count = transforms->count;
+
+        // cascades are fitted for a directional light, so the orbit becomes a sun direction
+        const Entity *light_entities = ecs_entities(&world, ECS_LIGHT);
+        const vec3 *light_colors = ecs_column(&world, ECS_LIGHT, LIGHT_COLOR);
+        const float *light_radius = ecs_column(&world, ECS_LIGHT, LIGHT_RADIUS);
+        p->light_count = 0;
+        for(u32 i = 0; i < ecs_count(&world, ECS_LIGHT) && p->light_count < MAX_LIGHTS; i++) {
+            Light *light = &p->lights[p->light_count++];
+            const float *light_world = hierarchy_world(transforms, ecs_node(&world, light_entities[i]));
+            vec3_dup(light->position, &light_world[12]);
+            vec3_dup(light->color, light_colors[i]);
+            light->radius = light_radius[i];
+            if(cascaded_shadows && light_entities[i] == orbit_light) {
+                vec3 to_light = { state.light_pos[0], 4.0f, state.light_pos[2] };
+                vec3_norm(light->position, to_light);
+                light->radius = 0.0f;
+            }
+        }
+
+        // shadows still see every object, only the camera passes are culled
+        u8 *visible = ARENA_ARRAY(&frame_arena, u8, p->object_count);
+        JobCounter culled;
+        job_counter_init(&culled);
+        CullTask cull = { .models = p->models, .radius = p->radius, .visible = visible };
+        frustum_from_matrix(cull.planes, camera.view_projection);
+        job_parallel_for(&jobs, task_cull, &cull, p->object_count, 256, &culled);
+        job_wait(&jobs, &culled);
+
+        // levels of detail by projected error, each entity keeps its last level for hysteresis
+        const u32 *mesh_ids = ecs_column(&world, ECS_MESH, MESH_ID);
+        u32 *mesh_lods = ecs_column(&world, ECS_MESH, MESH_LOD);
+        vec3 to_object;
+        p->draw_count = 0;
+        p->triangles = p->full_triangles = 0;
+        for(int i = 0; i < p->object_count; i++) {
+            const Mesh *mesh = &scene_meshes[mesh_ids[i]];
+            vec3_sub(to_object, p->models[i][3], camera.position);
+            float scale = fmaxf(fmaxf(vec3_len(p->models[i][0]), vec3_len(p->models[i][1])), vec3_len(p->models[i][2]));
+            float pixels = lod_pixels_per_unit(vec3_len(to_object) - p->radius[i], camera.fov, screen_height) * scale;
+            mesh_lods[i] = lod_enabled ? lod_select(mesh->lods, mesh->lod_count, mesh_lods[i], pixels, lod_threshold,
+                                                    LOD_HYSTERESIS) : 0;
+            p->mesh_ids[i] = (u8)mesh_ids[i];
+            p->lods[i] = (u8)mesh_lods[i];
+            occlusion_world_box(p->models[i], mesh->min, mesh->max, p->bounds_min[i], p->bounds_max[i]);
+            if(!visible[i])
+                continue;
+            p->triangles += mesh->lods[mesh_lods[i]].index_count / 3;
+            p->full_triangles += mesh->lods[0].index_count / 3;
+            DrawItem *item = &p->draw_items[p->draw_count++];
+            item->index = i;
+            item->depth = vec3_mul_inner(to_object, camera.front);
+            item->state = mesh_ids[i] << 16 | p->material_ids[i];
+        }
+
+        // the cubes and the floor hide things, they are rasterized at their coarsest level
+        p->occluded = 0;
+        p->occluder_triangles = 0;
+        p->occlusion_ms = 0.0;
+        if(occlusion_mode == OCCLUSION_CPU) {
+            double occlusion_start = glfwGetTime();
+            SoftwareOcclusion *so = &software_occlusion;
+            occlusion_begin(so, camera.view_projection);
+            const Mesh *occluder = &scene_meshes[MESH_CUBE];
+            const MeshLod *coarsest = &occluder->lods[occluder->lod_count - 1];
+            for(int i = 0; i < p->draw_count; i++) {
+                int index = p->draw_items[i].index;
+                if(p->mesh_ids[index] == MESH_CUBE)
+                    occlusion_rasterize(so, occluder->positions, occluder->indices + coarsest->index_offset,
+                                        coarsest->index_count, p->models[index]);
+            }
+            occlusion_build_pyramid(so);
+            u8 *occluded = ARENA_ARRAY(&frame_arena, u8, p->object_count);
+            for(int i = 0; i < p->draw_count; i++) {
+                int index = p->draw_items[i].index;
+                occluded[index] = !occlusion_test_box(so, p->bounds_min[index], p->bounds_max[index]);
+            }
+            p->occluded = remove_occluded(p, occluded);
+            p->occluder_triangles = so->triangles;
+            p->occlusion_ms = (glfwGetTime() - occlusion_start) * 1000.0;
+        }
+        if(draw_sort == DRAW_SORT_DEPTH)
+            qsort(p->draw_items, p->draw_count, sizeof(DrawItem), compare_draw_items);
+        else if(draw_sort == DRAW_SORT_STATE)
+            qsort(p->draw_items, p->draw_count, sizeof(DrawItem), compare_draw_states);
+
+        p->sim_frame_bytes = arena_mark(&frame_arena);
+        p->sim_heap_allocations = memory_heap_allocations() - heap_start;
+
+        // a full queue means the GPU is behind, wait instead of running ahead
+        p->build_time = glfwGetTime();
+        while(!spsc_push(&rt.packets, p)) {
+            atomic_fetch_add(&rt.producer_stalls, 1);
+            if(glfwWindowShouldClose(window))
+                break;
+            sched_yield();
+        }
     }
 
+    atomic_store(&rt.running, 0);
+    pthread_join(render_thread, NULL);
+    pthread_cond_destroy(&rt.wanted);
+    pthread_mutex_destroy(&rt.wanted_lock);
+    job_system_shutdown(&jobs);
+    ecs_destroy(&world);
+    arena_destroy(&persistent);
+    arena_destroy(&frame_arena);
+    assets_destroy(&assets);
+    for(int i = 0; i < MESH_COUNT; i++)
+        mesh_free(&scene_meshes[i]);
+    mesh_unmap(&cube_view);
     glfwTerminate();
     return 0;
 }
@@ -0,0 +1,79 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "material.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+void
+material_library_init(MaterialLibrary *lib, Arena *arena, u32 capacity)
+{
+    if(capacity > MATERIAL_MAX) {
+        ERROR_EXIT(1, "At most %d materials, %u asked for\n", MATERIAL_MAX, capacity);
+    }
+    lib->materials = ARENA_ARRAY(arena, Material, capacity);
+    lib->count = 0;
+    lib->capacity = capacity;
+}
+
+/* Returns the index draws refer to it by. */
+u32
+material_add(MaterialLibrary *lib, const vec3 base_color, float metallic, float roughness)
+{
+    if(lib->count == lib->capacity) {
+        ERROR_EXIT(1, "Material library full at %u\n", lib->capacity);
+    }
+    Material *m = &lib->materials[lib->count];
+    vec3_dup(m->base_color, base_color);
+    m->metallic = metallic;
+    m->roughness = roughness;
+    m->reflectance = 0.5f;
+    m->unused[0] = m->unused[1] = 0.0f;
+    return lib->count++;
+}
+
+/* Uploads once, the library doesn't change after the scene is built. */
+void
+material_buffer_init(MaterialBuffer *mb, const Material *materials, u32 count)
+{
+    int max_texels;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &max_texels);
+    if((size_t)count * 2 > (size_t)max_texels) {
+        ERROR_EXIT(1, "%u materials don't fit a buffer texture of %d texels\n", count, max_texels);
+    }
+    mb->count = count;
+    glGenBuffers(1, &mb->buffer);
+    glBindBuffer(GL_TEXTURE_BUFFER, mb->buffer);
+    // an empty buffer texture reads as zero, one material keeps the fetches defined
+    glBufferData(GL_TEXTURE_BUFFER, sizeof(Material) * (count ? count : 1), count ? materials : NULL, GL_STATIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    glGenTextures(1, &mb->texture);
+    glBindTexture(GL_TEXTURE_BUFFER, mb->texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, mb->buffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+/* Program must be current and declare samplerBuffer materials. */
+void
+material_buffer_bind(const MaterialBuffer *mb, unsigned int program)
+{
+    glUniform1i(glGetUniformLocation(program, "materials"), MATERIAL_TEXTURE_UNIT);
+    glActiveTexture(GL_TEXTURE0 + MATERIAL_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_BUFFER, mb->texture);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+size_t
+material_buffer_memory(const MaterialBuffer *mb)
+{
+    return sizeof(Material) * (size_t)mb->count;
+}
+
+void
+material_buffer_destroy(MaterialBuffer *mb)
+{
+    glDeleteTextures(1, &mb->texture);
+    glDeleteBuffers(1, &mb->buffer);
+}
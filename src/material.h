@@ -0,0 +1,52 @@
+#ifndef __MATERIAL__H__
+#define __MATERIAL__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "memory.h"
+
+/*
+ * Metallic-roughness materials. The main thread fills a MaterialLibrary
+ * while it builds the scene and entities refer to materials by index.
+ * The render thread uploads the whole library once into a buffer
+ * texture, two RGBA32F texels a material, and shaders fetch from it with
+ * the index of the draw. A draw changes one int uniform instead of a
+ * color and a specular strength, and the G-buffer stores the index
+ * instead of the material itself.
+ */
+
+#define MATERIAL_TEXTURE_UNIT 6
+#define MATERIAL_MAX 65536          /* the G-buffer index is 16 bits */
+#define MATERIAL_NONE 0xffffffffu
+
+/* The layout of the buffer texture, keep it two vec4s. */
+typedef struct {
+    vec3 base_color;          /* albedo of dielectrics, F0 of metals */
+    float metallic;
+    float roughness;          /* perceptual, squared for GGX */
+    float reflectance;        /* dielectric F0 is 0.16 * reflectance^2, 0.5 is the usual 4% */
+    float unused[2];
+} Material;
+
+typedef struct {
+    Material *materials;
+    u32 count;
+    u32 capacity;
+} MaterialLibrary;
+
+typedef struct {
+    unsigned int buffer;
+    unsigned int texture;
+    u32 count;
+} MaterialBuffer;
+
+void material_library_init(MaterialLibrary *lib, Arena *arena, u32 capacity);
+u32 material_add(MaterialLibrary *lib, const vec3 base_color, float metallic, float roughness);
+
+void material_buffer_init(MaterialBuffer *mb, const Material *materials, u32 count);
+void material_buffer_bind(const MaterialBuffer *mb, unsigned int program);
+size_t material_buffer_memory(const MaterialBuffer *mb);
+void material_buffer_destroy(MaterialBuffer *mb);
+
+#endif
@@ -0,0 +1,198 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "memory.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+static size_t
+page_size(void)
+{
+    static size_t size;
+    if(!size)
+        size = (size_t)sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+static size_t
+align_up(size_t value, size_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+void
+arena_init(Arena *a, const char *name, size_t reserve)
+{
+    memset(a, 0, sizeof(*a));
+    a->name = name;
+    a->reserved = align_up(reserve, page_size());
+#ifdef MEMORY_DEBUG
+    int protection = PROT_NONE;     /* opened up allocation by allocation */
+#else
+    int protection = PROT_READ | PROT_WRITE;
+#endif
+    void *base = mmap(NULL, a->reserved, protection, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if(base == MAP_FAILED) {
+        ERROR_EXIT(1, "Couldn't reserve %zu bytes for the %s arena\n", a->reserved, name);
+    }
+    a->base = base;
+}
+
+/* align must be a power of two no larger than a page */
+void *
+arena_push(Arena *a, size_t size, size_t align)
+{
+#ifdef MEMORY_DEBUG
+    // pushed against the next page, so reading or writing past the end faults right away
+    size_t page = page_size();
+    size_t start = align_up(a->used, page);
+    size_t span = align_up(size ? size : 1, page);
+    size_t offset = (start + span - size) & ~(align - 1);
+    size_t end = start + span + page;
+    if(end > a->reserved) {
+        ERROR_EXIT(1, "The %s arena is out of its %zu bytes\n", a->name, a->reserved);
+    }
+    mprotect(a->base + start, span, PROT_READ | PROT_WRITE);
+#else
+    size_t offset = align_up(a->used, align);
+    size_t end = offset + size;
+    if(end > a->reserved) {
+        ERROR_EXIT(1, "The %s arena is out of its %zu bytes\n", a->name, a->reserved);
+    }
+#endif
+    a->used = end;
+    if(a->used > a->peak)
+        a->peak = a->used;
+    a->allocations++;
+    return a->base + offset;
+}
+
+void *
+arena_push_zero(Arena *a, size_t size, size_t align)
+{
+    void *p = arena_push(a, size, align);
+    memset(p, 0, size);
+    return p;
+}
+
+size_t
+arena_mark(const Arena *a)
+{
+    return a->used;
+}
+
+void
+arena_pop_to(Arena *a, size_t mark)
+{
+#ifdef MEMORY_DEBUG
+    // anything still pointing past the mark faults on its next access
+    size_t start = align_up(mark, page_size());
+    if(a->used > start)
+        mprotect(a->base + start, a->used - start, PROT_NONE);
+#endif
+    a->used = mark;
+}
+
+void
+arena_reset(Arena *a)
+{
+    arena_pop_to(a, 0);
+    a->resets++;
+}
+
+void
+arena_print(FILE *out, const Arena *a)
+{
+    fprintf(out, "%s %.1f/%.1f KB (peak %.1f KB, %llu allocations)", a->name, a->used / 1024.0,
+            a->reserved / 1024.0, a->peak / 1024.0, (unsigned long long)a->allocations);
+}
+
+void
+arena_destroy(Arena *a)
+{
+    munmap(a->base, a->reserved);
+    a->base = NULL;
+    a->used = a->reserved = 0;
+}
+
+void
+pool_init(Pool *p, Arena *a, size_t item_size, u32 capacity)
+{
+    // every item can hold the free list link and keeps the alignment malloc would give it
+    p->item_size = align_up(item_size < sizeof(void *) ? sizeof(void *) : item_size, _Alignof(max_align_t));
+    p->items = arena_push(a, p->item_size * capacity, _Alignof(max_align_t));
+    p->free_list = NULL;
+    p->capacity = capacity;
+    p->used = p->peak = p->next = 0;
+}
+
+/* NULL when all items are taken */
+void *
+pool_alloc(Pool *p)
+{
+    void *item;
+    if(p->free_list) {
+        item = p->free_list;
+        memcpy(&p->free_list, item, sizeof(void *));
+    } else if(p->next < p->capacity) {
+        item = p->items + (size_t)p->next++ * p->item_size;
+    } else {
+        return NULL;
+    }
+    p->used++;
+    if(p->used > p->peak)
+        p->peak = p->used;
+    return item;
+}
+
+void
+pool_free(Pool *p, void *item)
+{
+    memcpy(item, &p->free_list, sizeof(void *));
+    p->free_list = item;
+    p->used--;
+}
+
+#ifdef MEMORY_DEBUG
+/* glibc's own entry points, the wrappers below only count */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+
+static __thread u64 heap_allocations;
+
+void *
+malloc(size_t size)
+{
+    heap_allocations++;
+    return __libc_malloc(size);
+}
+
+void *
+calloc(size_t count, size_t size)
+{
+    heap_allocations++;
+    return __libc_calloc(count, size);
+}
+
+void *
+realloc(void *p, size_t size)
+{
+    heap_allocations++;
+    return __libc_realloc(p, size);
+}
+
+u64
+memory_heap_allocations(void)
+{
+    return heap_allocations;
+}
+#else
+u64
+memory_heap_allocations(void)
+{
+    return 0;
+}
+#endif
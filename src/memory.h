@@ -0,0 +1,65 @@
+#ifndef __MEMORY__H__
+#define __MEMORY__H__
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "untitled_types.h"
+
+/*
+ * Memory that is allocated up front and handed out without the heap.
+ *
+ * An Arena reserves address space once and bumps a pointer through it,
+ * the OS commits pages as they are first touched. Everything is freed at
+ * once with arena_reset, or back to an earlier arena_mark. Each thread
+ * keeps its own arenas: a persistent one for load time data that lives
+ * until exit and a frame one that is reset at the top of every frame.
+ *
+ * A Pool hands out fixed size items carved from an arena and takes them
+ * back through a free list.
+ *
+ * Built with -DMEMORY_DEBUG every arena allocation ends right at an
+ * inaccessible guard page, memory given back by a reset is made
+ * inaccessible too, and malloc/calloc/realloc calls are counted per
+ * thread so a frame loop can check that it never reaches the heap.
+ */
+
+typedef struct {
+    const char *name;
+    u8 *base;
+    size_t reserved;
+    size_t used;
+    size_t peak;
+    u64 allocations;
+    u64 resets;
+} Arena;
+
+typedef struct {
+    u8 *items;
+    void *free_list;
+    size_t item_size;
+    u32 capacity;
+    u32 used;
+    u32 peak;
+    u32 next;          /* items below this have been handed out at least once */
+} Pool;
+
+#define ARENA_ARRAY(arena, type, count) ((type *)arena_push((arena), sizeof(type) * (count), _Alignof(type)))
+
+void arena_init(Arena *a, const char *name, size_t reserve);
+void *arena_push(Arena *a, size_t size, size_t align);
+void *arena_push_zero(Arena *a, size_t size, size_t align);
+size_t arena_mark(const Arena *a);
+void arena_pop_to(Arena *a, size_t mark);
+void arena_reset(Arena *a);
+void arena_print(FILE *out, const Arena *a);
+void arena_destroy(Arena *a);
+
+void pool_init(Pool *p, Arena *a, size_t item_size, u32 capacity);
+void *pool_alloc(Pool *p);
+void pool_free(Pool *p, void *item);
+
+/* heap allocations made by the calling thread, always 0 without MEMORY_DEBUG */
+u64 memory_heap_allocations(void);
+
+#endif
@@ -0,0 +1,1143 @@
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "lod.h"
+#include "mesh.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define VERTEX_CACHE_SIZE 32
+
+static void *
+checked_malloc(size_t size)
+{
+    void *p = malloc(size ? size : 1);
+    if(!p) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    return p;
+}
+
+static char *
+read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if(!file) {
+        ERROR_EXIT(1, "Couldn't open file %s\n", path);
+    }
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = checked_malloc(*size + 1);
+    if(fread(data, 1, *size, file) != *size) {
+        ERROR_EXIT(1, "Couldn't read file %s\n", path);
+    }
+    data[*size] = '\0';
+    fclose(file);
+    return data;
+}
+
+static void
+mesh_alloc(Mesh *m, u32 vertex_count, u32 index_count)
+{
+    m->vertex_count = vertex_count;
+    m->index_count = index_count;
+    m->positions = checked_malloc(sizeof(float) * 3 * vertex_count);
+    m->normals = calloc((size_t)vertex_count * 3 + 1, sizeof(float));
+    m->uvs = calloc((size_t)vertex_count * 2 + 1, sizeof(float));
+    m->indices = checked_malloc(sizeof(u32) * index_count);
+    if(!m->normals || !m->uvs) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    m->lod_count = 1;
+    m->lods[0] = (MeshLod){ 0, index_count, 0.0f };
+}
+
+void
+mesh_free(Mesh *m)
+{
+    free(m->positions);
+    free(m->normals);
+    free(m->uvs);
+    free(m->indices);
+    memset(m, 0, sizeof(*m));
+}
+
+static void
+compute_bounds(Mesh *m)
+{
+    vec3_dup(m->min, m->positions);
+    vec3_dup(m->max, m->positions);
+    for(u32 i = 1; i < m->vertex_count; i++) {
+        vec3_min(m->min, m->min, &m->positions[i * 3]);
+        vec3_max(m->max, m->max, &m->positions[i * 3]);
+    }
+}
+
+/* Half the bounds diagonal, a cheap bounding sphere radius. */
+float
+mesh_radius(const Mesh *m)
+{
+    vec3 extent;
+    vec3_sub(extent, m->max, m->min);
+    return vec3_len(extent) * 0.5f;
+}
+
+/* Area weighted face normals, used when the source has none. */
+static void
+generate_normals(Mesh *m)
+{
+    memset(m->normals, 0, sizeof(float) * 3 * m->vertex_count);
+    for(u32 i = 0; i + 2 < m->index_count; i += 3) {
+        u32 a = m->indices[i], b = m->indices[i + 1], c = m->indices[i + 2];
+        vec3 ab, ac, n;
+        vec3_sub(ab, &m->positions[b * 3], &m->positions[a * 3]);
+        vec3_sub(ac, &m->positions[c * 3], &m->positions[a * 3]);
+        vec3_mul_cross(n, ab, ac);
+        vec3_add(&m->normals[a * 3], &m->normals[a * 3], n);
+        vec3_add(&m->normals[b * 3], &m->normals[b * 3], n);
+        vec3_add(&m->normals[c * 3], &m->normals[c * 3], n);
+    }
+    for(u32 i = 0; i < m->vertex_count; i++) {
+        float *n = &m->normals[i * 3];
+        float len = vec3_len(n);
+        if(len > 0.0f)
+            vec3_scale(n, n, 1.0f / len);
+    }
+}
+
+/*
+ * OBJ
+ */
+
+typedef struct {
+    int v, vt, vn;
+    u32 index;
+} ObjKey;
+
+static u32
+obj_hash(int v, int vt, int vn)
+{
+    u32 h = (u32)v * 73856093u ^ (u32)vt * 19349663u ^ (u32)vn * 83492791u;
+    return h ^ (h >> 16);
+}
+
+static int
+obj_index(const char **s, int count)
+{
+    char *end;
+    long i = strtol(*s, &end, 10);
+    *s = end;
+    // 1 based, negative counts back from the last element read so far
+    return (int)(i < 0 ? count + i : i - 1);
+}
+
+/* Corners on a face line after the 'f', split the way the fill pass splits them; an upper bound of what it reads. */
+static u32
+obj_face_corners(const char *s)
+{
+    u32 corners = 0;
+    while(*s == ' ' || *s == '\t') {
+        while(*s == ' ' || *s == '\t')
+            s++;
+        if(*s < '-' || *s == '\n')
+            break;
+        corners++;
+        while(*s > ' ')
+            s++;
+    }
+    return corners;
+}
+
+void
+mesh_load_obj(const char *path, Mesh *m)
+{
+    size_t size;
+    char *text = read_file(path, &size);
+
+    // upper bounds from a quick count, then one pass fills everything; every corner may add a vertex
+    u32 v_count = 0, vt_count = 0, vn_count = 0, corner_count = 0, fan_count = 0;
+    for(const char *line = text; *line; ) {
+        if(line[0] == 'v' && line[1] == ' ') v_count++;
+        else if(line[0] == 'v' && line[1] == 't') vt_count++;
+        else if(line[0] == 'v' && line[1] == 'n') vn_count++;
+        else if(line[0] == 'f' && line[1] == ' ') {
+            u32 corners = obj_face_corners(line + 1);
+            corner_count += corners;
+            fan_count += corners > 2 ? (corners - 2) * 3 : 0;
+        }
+        const char *next = strchr(line, '\n');
+        line = next ? next + 1 : line + strlen(line);
+    }
+
+    float *v = checked_malloc(sizeof(float) * 3 * (v_count + 1));
+    float *vt = checked_malloc(sizeof(float) * 2 * (vt_count + 1));
+    float *vn = checked_malloc(sizeof(float) * 3 * (vn_count + 1));
+    u32 table_size = 1;
+    while(table_size < corner_count * 2)
+        table_size <<= 1;
+    ObjKey *table = checked_malloc(sizeof(ObjKey) * table_size);
+    for(u32 i = 0; i < table_size; i++)
+        table[i].v = -1;
+
+    mesh_alloc(m, corner_count, fan_count);
+    u32 vertex_count = 0, index_count = 0;
+    u32 nv = 0, nvt = 0, nvn = 0;
+    bool has_normals = vn_count > 0;
+
+    for(const char *s = text; *s; ) {
+        if(s[0] == 'v' && s[1] == ' ') {
+            s += 2;
+            for(int k = 0; k < 3; k++)
+                v[nv * 3 + k] = strtof(s, (char **)&s);
+            nv++;
+        } else if(s[0] == 'v' && s[1] == 't') {
+            s += 2;
+            for(int k = 0; k < 2; k++)
+                vt[nvt * 2 + k] = strtof(s, (char **)&s);
+            nvt++;
+        } else if(s[0] == 'v' && s[1] == 'n') {
+            s += 2;
+            for(int k = 0; k < 3; k++)
+                vn[nvn * 3 + k] = strtof(s, (char **)&s);
+            nvn++;
+        } else if(s[0] == 'f' && s[1] == ' ') {
+            s += 1;
+            u32 first = 0, previous = 0;
+            int corner = 0;
+            while(*s == ' ' || *s == '\t') {
+                while(*s == ' ' || *s == '\t')
+                    s++;
+                if(*s < '-' || *s == '\n')
+                    break;
+                int iv = obj_index(&s, (int)nv), ivt = -1, ivn = -1;
+                if(*s == '/') {
+                    s++;
+                    if(*s != '/')
+                        ivt = obj_index(&s, (int)nvt);
+                    if(*s == '/') {
+                        s++;
+                        ivn = obj_index(&s, (int)nvn);
+                    }
+                }
+                if(iv < 0 || iv >= (int)nv || ivt >= (int)nvt || ivn >= (int)nvn) {
+                    ERROR_EXIT(1, "%s: face references a missing vertex\n", path);
+                }
+
+                // one output vertex per distinct v/vt/vn triple
+                u32 slot = obj_hash(iv, ivt, ivn) & (table_size - 1);
+                while(table[slot].v != -1 &&
+                      (table[slot].v != iv || table[slot].vt != ivt || table[slot].vn != ivn))
+                    slot = (slot + 1) & (table_size - 1);
+                if(table[slot].v == -1) {
+                    u32 out = vertex_count++;
+                    table[slot] = (ObjKey){ iv, ivt, ivn, out };
+                    memcpy(&m->positions[out * 3], &v[iv * 3], sizeof(float) * 3);
+                    if(ivt >= 0)
+                        memcpy(&m->uvs[out * 2], &vt[ivt * 2], sizeof(float) * 2);
+                    if(ivn >= 0)
+                        memcpy(&m->normals[out * 3], &vn[ivn * 3], sizeof(float) * 3);
+                }
+                u32 index = table[slot].index;
+
+                // triangle fan for polygons
+                if(corner == 0)
+                    first = index;
+                else if(corner >= 2) {
+                    m->indices[index_count++] = first;
+                    m->indices[index_count++] = previous;
+                    m->indices[index_count++] = index;
+                }
+                previous = index;
+                corner++;
+            }
+        }
+        const char *next = strchr(s, '\n');
+        s = next ? next + 1 : s + strlen(s);
+    }
+
+    m->vertex_count = vertex_count;
+    m->index_count = m->lods[0].index_count = index_count;
+    free(table);
+    free(v);
+    free(vt);
+    free(vn);
+    free(text);
+
+    if(!vertex_count) {
+        ERROR_EXIT(1, "%s: no faces\n", path);
+    }
+    if(!has_normals)
+        generate_normals(m);
+    compute_bounds(m);
+}
+
+/*
+ * glTF 2.0. A small jsmn style tokenizer is enough, the document is
+ * only walked once to find the accessors of the first mesh.
+ */
+
+typedef enum { JSON_PRIMITIVE, JSON_STRING, JSON_ARRAY, JSON_OBJECT } JsonType;
+
+typedef struct {
+    JsonType type;
+    int start, end;
+    int size;                 /* direct children, keys and values both count in objects */
+} JsonToken;
+
+typedef struct {
+    const char *json;
+    JsonToken *tokens;
+    int count;
+    const u8 *bin;            /* GLB binary chunk */
+    size_t bin_size;
+    const u8 **buffers;
+    size_t *buffer_sizes;
+    int buffer_count;
+    char *dir;
+} Gltf;
+
+static int
+json_parse(const char *json, size_t length, JsonToken *tokens, int max_tokens)
+{
+    int count = 0, stack[64], depth = 0;
+    for(size_t i = 0; i < length; i++) {
+        char c = json[i];
+        if(c == '{' || c == '[') {
+            if(count == max_tokens || depth == 64)
+                return -1;
+            if(depth)
+                tokens[stack[depth - 1]].size++;
+            tokens[count] = (JsonToken){ c == '{' ? JSON_OBJECT : JSON_ARRAY, (int)i, -1, 0 };
+            stack[depth++] = count++;
+        } else if(c == '}' || c == ']') {
+            if(!depth)
+                return -1;
+            tokens[stack[--depth]].end = (int)i + 1;
+        } else if(c == '"') {
+            size_t start = ++i;
+            while(i < length && json[i] != '"')
+                i += json[i] == '\\' ? 2 : 1;
+            if(count == max_tokens)
+                return -1;
+            if(depth)
+                tokens[stack[depth - 1]].size++;
+            tokens[count++] = (JsonToken){ JSON_STRING, (int)start, (int)i, 0 };
+        } else if(c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+            size_t start = i;
+            while(i < length && !strchr(",]} \t\r\n", json[i]))
+                i++;
+            if(count == max_tokens)
+                return -1;
+            if(depth)
+                tokens[stack[depth - 1]].size++;
+            tokens[count++] = (JsonToken){ JSON_PRIMITIVE, (int)start, (int)i, 0 };
+            i--;
+        }
+    }
+    return depth ? -1 : count;
+}
+
+/* index of the token after the subtree starting at i */
+static int
+json_skip(const Gltf *g, int i)
+{
+    int end = g->tokens[i].end;
+    i++;
+    while(i < g->count && g->tokens[i].start < end)
+        i++;
+    return i;
+}
+
+static bool
+json_eq(const Gltf *g, int i, const char *s)
+{
+    size_t length = (size_t)(g->tokens[i].end - g->tokens[i].start);
+    return g->tokens[i].type == JSON_STRING && strlen(s) == length &&
+           !strncmp(g->json + g->tokens[i].start, s, length);
+}
+
+/* value token of key in object i, -1 if missing */
+static int
+json_get(const Gltf *g, int i, const char *key)
+{
+    if(i < 0 || g->tokens[i].type != JSON_OBJECT)
+        return -1;
+    int k = i + 1;
+    for(int n = 0; n < g->tokens[i].size / 2; n++) {
+        int value = k + 1;
+        if(json_eq(g, k, key))
+            return value;
+        k = json_skip(g, value);
+    }
+    return -1;
+}
+
+static int
+json_at(const Gltf *g, int i, int n)
+{
+    if(i < 0 || g->tokens[i].type != JSON_ARRAY || n >= g->tokens[i].size)
+        return -1;
+    int k = i + 1;
+    while(n-- > 0)
+        k = json_skip(g, k);
+    return k;
+}
+
+static double
+json_number(const Gltf *g, int i, double fallback)
+{
+    return i < 0 ? fallback : strtod(g->json + g->tokens[i].start, NULL);
+}
+
+static int
+base64_value(char c)
+{
+    if(c >= 'A' && c <= 'Z') return c - 'A';
+    if(c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if(c >= '0' && c <= '9') return c - '0' + 52;
+    if(c == '+' || c == '-') return 62;
+    if(c == '/' || c == '_') return 63;
+    return -1;
+}
+
+static const u8 *
+gltf_buffer(Gltf *g, int index, size_t *size)
+{
+    if(index < 0 || index >= g->buffer_count) {
+        ERROR_EXIT(1, "glTF buffer %d out of range\n", index);
+    }
+    if(g->buffers[index]) {
+        *size = g->buffer_sizes[index];
+        return g->buffers[index];
+    }
+    int buffer = json_at(g, json_get(g, 0, "buffers"), index);
+    int uri = json_get(g, buffer, "uri");
+    if(uri < 0) {
+        // the GLB binary chunk is the buffer without a uri
+        *size = g->bin_size;
+        return g->bin;
+    }
+
+    const char *s = g->json + g->tokens[uri].start;
+    int length = g->tokens[uri].end - g->tokens[uri].start;
+    u8 *data;
+    if(!strncmp(s, "data:", 5)) {
+        const char *comma = memchr(s, ',', length);
+        if(!comma) {
+            ERROR_EXIT(1, "Bad glTF data uri\n");
+        }
+        const char *p = comma + 1, *end = s + length;
+        data = checked_malloc((size_t)(end - p) * 3 / 4 + 3);
+        size_t n = 0;
+        u32 bits = 0;
+        int bit_count = 0;
+        for(; p < end; p++) {
+            int value = base64_value(*p);
+            if(value < 0)
+                continue;
+            bits = bits << 6 | (u32)value;
+            bit_count += 6;
+            if(bit_count >= 8) {
+                bit_count -= 8;
+                data[n++] = (u8)(bits >> bit_count);
+            }
+        }
+        *size = n;
+    } else {
+        // only local files, relative to the .gltf
+        char path[1024];
+        snprintf(path, sizeof(path), "%s%.*s", g->dir, length, s);
+        data = (u8 *)read_file(path, size);
+    }
+    g->buffers[index] = data;
+    g->buffer_sizes[index] = *size;
+    return data;
+}
+
+static float
+read_component(const u8 *p, int type, bool normalized)
+{
+    switch(type) {
+    case 5120: return normalized ? fmaxf(*(const i8 *)p / 127.0f, -1.0f) : *(const i8 *)p;
+    case 5121: return normalized ? *p / 255.0f : *p;
+    case 5122: return normalized ? fmaxf(*(const i16 *)p / 32767.0f, -1.0f) : *(const i16 *)p;
+    case 5123: return normalized ? *(const u16 *)p / 65535.0f : *(const u16 *)p;
+    case 5125: return (float)*(const u32 *)p;
+    case 5126: return *(const float *)p;
+    }
+    ERROR_EXIT(1, "Unknown glTF component type %d\n", type);
+}
+
+/*
+ * Reads count x components values of an accessor into out as floats, or
+ * into out_indices as integers when that is given. Returns the count.
+ */
+static u32
+gltf_read_accessor(Gltf *g, int accessor_index, int components, float *out, u32 *out_indices, u32 max_count)
+{
+    int accessor = json_at(g, json_get(g, 0, "accessors"), accessor_index);
+    u32 count = (u32)json_number(g, json_get(g, accessor, "count"), 0);
+    int type = (int)json_number(g, json_get(g, accessor, "componentType"), 5126);
+    int normalized_token = json_get(g, accessor, "normalized");
+    bool normalized = normalized_token >= 0 && g->json[g->tokens[normalized_token].start] == 't';
+    if(count > max_count) {
+        ERROR_EXIT(1, "glTF accessor %d larger than expected\n", accessor_index);
+    }
+
+    int view_index = json_get(g, accessor, "bufferView");
+    if(view_index < 0) {
+        // no buffer view means all zeros
+        if(out)
+            memset(out, 0, sizeof(float) * components * count);
+        if(out_indices)
+            memset(out_indices, 0, sizeof(u32) * count);
+        return count;
+    }
+    int view = json_at(g, json_get(g, 0, "bufferViews"), (int)json_number(g, view_index, 0));
+    size_t buffer_size;
+    const u8 *buffer = gltf_buffer(g, (int)json_number(g, json_get(g, view, "buffer"), 0), &buffer_size);
+    size_t offset = (size_t)json_number(g, json_get(g, view, "byteOffset"), 0) +
+                    (size_t)json_number(g, json_get(g, accessor, "byteOffset"), 0);
+    size_t component_size = type == 5126 || type == 5125 ? 4 : type == 5122 || type == 5123 ? 2 : 1;
+    size_t stride = (size_t)json_number(g, json_get(g, view, "byteStride"), (double)(component_size * components));
+    if(count && offset + stride * (count - 1) + component_size * components > buffer_size) {
+        ERROR_EXIT(1, "glTF accessor %d out of bounds\n", accessor_index);
+    }
+
+    for(u32 i = 0; i < count; i++) {
+        const u8 *element = buffer + offset + stride * i;
+        for(int c = 0; c < components; c++) {
+            float value = read_component(element + component_size * c, type, normalized);
+            if(out)
+                out[i * components + c] = value;
+            else
+                out_indices[i] = type == 5125 ? *(const u32 *)element : (u32)value;
+        }
+    }
+    return count;
+}
+
+static u32
+gltf_accessor_count(Gltf *g, int accessor_index)
+{
+    int accessor = json_at(g, json_get(g, 0, "accessors"), accessor_index);
+    return (u32)json_number(g, json_get(g, accessor, "count"), 0);
+}
+
+/*
+ * All triangle primitives of the first mesh are merged. Node transforms
+ * are not applied, the mesh comes out in its own space.
+ */
+void
+mesh_load_gltf(const char *path, Mesh *m)
+{
+    size_t size;
+    char *file = read_file(path, &size);
+    Gltf g = { 0 };
+    const char *json = file;
+    size_t json_length = size;
+
+    if(size >= 20 && !memcmp(file, "glTF", 4)) {
+        u32 header[5];
+        memcpy(header, file, sizeof(header));
+        json = file + 20;
+        json_length = header[3];
+        // chunk lengths come from the file, neither may reach past its end
+        if(json_length > size - 20) {
+            ERROR_EXIT(1, "%s: JSON chunk runs past the end of the file\n", path);
+        }
+        size_t bin_chunk = 20 + ((json_length + 3) & ~(size_t)3);
+        if(bin_chunk + 8 <= size) {
+            u32 bin_header[2];
+            memcpy(bin_header, file + bin_chunk, sizeof(bin_header));
+            if(bin_header[0] > size - bin_chunk - 8) {
+                ERROR_EXIT(1, "%s: binary chunk runs past the end of the file\n", path);
+            }
+            g.bin = (const u8 *)file + bin_chunk + 8;
+            g.bin_size = bin_header[0];
+        }
+    }
+
+    int max_tokens = (int)json_length / 2 + 16;
+    g.json = json;
+    g.tokens = checked_malloc(sizeof(JsonToken) * max_tokens);
+    g.count = json_parse(json, json_length, g.tokens, max_tokens);
+    if(g.count < 1 || g.tokens[0].type != JSON_OBJECT) {
+        ERROR_EXIT(1, "%s: not a glTF document\n", path);
+    }
+    int buffers = json_get(&g, 0, "buffers");
+    int buffer_count = buffers >= 0 ? g.tokens[buffers].size : 0;
+    g.buffer_count = buffer_count;
+    g.buffers = calloc(buffer_count + 1, sizeof(*g.buffers));
+    g.buffer_sizes = calloc(buffer_count + 1, sizeof(*g.buffer_sizes));
+    const char *slash = strrchr(path, '/');
+    g.dir = strndup(path, slash ? (size_t)(slash - path + 1) : 0);
+
+    int primitives = json_get(&g, json_at(&g, json_get(&g, 0, "meshes"), 0), "primitives");
+    if(primitives < 0) {
+        ERROR_EXIT(1, "%s: no meshes\n", path);
+    }
+
+    // sizes first, then read every primitive into its range
+    u32 vertex_count = 0, index_count = 0;
+    for(int p = 0; p < g.tokens[primitives].size; p++) {
+        int primitive = json_at(&g, primitives, p);
+        if(json_number(&g, json_get(&g, primitive, "mode"), 4) != 4)
+            continue;
+        u32 count = gltf_accessor_count(&g, (int)json_number(&g, json_get(&g, json_get(&g, primitive, "attributes"), "POSITION"), -1));
+        int indices = json_get(&g, primitive, "indices");
+        vertex_count += count;
+        index_count += indices >= 0 ? gltf_accessor_count(&g, (int)json_number(&g, indices, 0)) : count;
+    }
+    mesh_alloc(m, vertex_count, index_count);
+
+    bool has_normals = true;
+    u32 base_vertex = 0, base_index = 0;
+    for(int p = 0; p < g.tokens[primitives].size; p++) {
+        int primitive = json_at(&g, primitives, p);
+        if(json_number(&g, json_get(&g, primitive, "mode"), 4) != 4)
+            continue;
+        int attributes = json_get(&g, primitive, "attributes");
+        int position = (int)json_number(&g, json_get(&g, attributes, "POSITION"), -1);
+        int normal = json_get(&g, attributes, "NORMAL");
+        int uv = json_get(&g, attributes, "TEXCOORD_0");
+        int indices = json_get(&g, primitive, "indices");
+
+        u32 count = gltf_read_accessor(&g, position, 3, &m->positions[base_vertex * 3], NULL, vertex_count - base_vertex);
+        if(normal >= 0)
+            gltf_read_accessor(&g, (int)json_number(&g, normal, 0), 3, &m->normals[base_vertex * 3], NULL, count);
+        else
+            has_normals = false;
+        if(uv >= 0)
+            gltf_read_accessor(&g, (int)json_number(&g, uv, 0), 2, &m->uvs[base_vertex * 2], NULL, count);
+
+        u32 *out = &m->indices[base_index];
+        u32 written;
+        if(indices >= 0)
+            written = gltf_read_accessor(&g, (int)json_number(&g, indices, 0), 1, NULL, out, index_count - base_index);
+        else
+            for(written = 0; written < count; written++)
+                out[written] = written;
+        for(u32 i = 0; i < written; i++) {
+            if(out[i] >= count) {
+                ERROR_EXIT(1, "%s: index out of range\n", path);
+            }
+            out[i] += base_vertex;
+        }
+        base_vertex += count;
+        base_index += written;
+    }
+    m->index_count = m->lods[0].index_count = base_index - base_index % 3;
+
+    for(int i = 0; i < buffer_count; i++)
+        free((void *)g.buffers[i]);
+    free(g.buffers);
+    free(g.buffer_sizes);
+    free(g.dir);
+    free(g.tokens);
+    free(file);
+
+    if(!m->vertex_count || !m->index_count) {
+        ERROR_EXIT(1, "%s: no triangles\n", path);
+    }
+    if(!has_normals)
+        generate_normals(m);
+    compute_bounds(m);
+}
+
+void
+mesh_load(const char *path, Mesh *m)
+{
+    const char *ext = strrchr(path, '.');
+    if(ext && !strcmp(ext, ".obj"))
+        mesh_load_obj(path, m);
+    else if(ext && (!strcmp(ext, ".gltf") || !strcmp(ext, ".glb")))
+        mesh_load_gltf(path, m);
+    else {
+        ERROR_EXIT(1, "Unknown mesh format %s\n", path);
+    }
+}
+
+/* Torus around the y axis, major radius 1, minor 0.35, for tests and benchmarks. */
+void
+mesh_torus(Mesh *m, u32 rings, u32 sides)
+{
+    mesh_alloc(m, (rings + 1) * (sides + 1), rings * sides * 6);
+    for(u32 r = 0; r <= rings; r++) {
+        for(u32 s = 0; s <= sides; s++) {
+            u32 i = r * (sides + 1) + s;
+            // the seam vertices repeat the first ring and side exactly so they weld
+            float u = r % rings / (float)rings * 6.2831853f, v = s % sides / (float)sides * 6.2831853f;
+            float *n = &m->normals[i * 3];
+            n[0] = cosf(v) * cosf(u);
+            n[1] = sinf(v);
+            n[2] = cosf(v) * sinf(u);
+            m->positions[i * 3] = cosf(u) + n[0] * 0.35f;
+            m->positions[i * 3 + 1] = n[1] * 0.35f;
+            m->positions[i * 3 + 2] = sinf(u) + n[2] * 0.35f;
+            m->uvs[i * 2] = r / (float)rings;
+            m->uvs[i * 2 + 1] = s / (float)sides;
+        }
+    }
+    u32 *tri = m->indices;
+    for(u32 r = 0; r < rings; r++) {
+        for(u32 s = 0; s < sides; s++) {
+            u32 a = r * (sides + 1) + s, b = a + sides + 1;
+            *tri++ = a; *tri++ = a + 1; *tri++ = b;
+            *tri++ = b; *tri++ = a + 1; *tri++ = b + 1;
+        }
+    }
+    compute_bounds(m);
+}
+
+/*
+ * Vertex cache optimization, Tom Forsyth's linear speed algorithm:
+ * greedily emit the triangle whose vertices score best, vertices score
+ * high when recently used and when few of their triangles are left.
+ */
+
+static float
+forsyth_score(int cache_position, u32 remaining)
+{
+    if(remaining == 0)
+        return -1.0f;
+    float score = 0.0f;
+    if(cache_position >= 0) {
+        // the last triangle's vertices get a fixed score so it is not simply repeated
+        if(cache_position < 3)
+            score = 0.75f;
+        else
+            score = powf(1.0f - (cache_position - 3) / (float)(VERTEX_CACHE_SIZE - 3), 1.5f);
+    }
+    return score + 2.0f * powf((float)remaining, -0.5f);
+}
+
+static void
+optimize_vertex_cache(u32 *indices, u32 index_count, u32 vertex_count)
+{
+    u32 tri_count = index_count / 3;
+    u32 *offsets = calloc(vertex_count + 1, sizeof(u32));
+    u32 *remaining = calloc(vertex_count, sizeof(u32));
+    int *cache_position = checked_malloc(sizeof(int) * vertex_count);
+    float *vertex_score = checked_malloc(sizeof(float) * vertex_count);
+    u32 *adjacency = checked_malloc(sizeof(u32) * index_count);
+    float *tri_score = checked_malloc(sizeof(float) * tri_count);
+    u8 *emitted = calloc(tri_count, 1);
+    u32 *out = checked_malloc(sizeof(u32) * index_count);
+    if(!offsets || !remaining || !emitted) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+
+    for(u32 i = 0; i < index_count; i++)
+        remaining[indices[i]]++;
+    for(u32 v = 0; v < vertex_count; v++)
+        offsets[v + 1] = offsets[v] + remaining[v];
+    memset(remaining, 0, sizeof(u32) * vertex_count);
+    for(u32 t = 0; t < tri_count; t++)
+        for(int k = 0; k < 3; k++) {
+            u32 v = indices[t * 3 + k];
+            adjacency[offsets[v] + remaining[v]++] = t;
+        }
+    for(u32 v = 0; v < vertex_count; v++) {
+        cache_position[v] = -1;
+        vertex_score[v] = forsyth_score(-1, remaining[v]);
+    }
+    for(u32 t = 0; t < tri_count; t++)
+        tri_score[t] = vertex_score[indices[t * 3]] + vertex_score[indices[t * 3 + 1]] + vertex_score[indices[t * 3 + 2]];
+
+    u32 cache[VERTEX_CACHE_SIZE + 3], cache_count = 0;
+    u32 next_cache[VERTEX_CACHE_SIZE + 3];
+    u32 cursor = 0;
+    long best = -1;
+    for(u32 emitted_count = 0; emitted_count < tri_count; emitted_count++) {
+        if(best < 0) {
+            // nothing in the cache has triangles left, continue with the next unemitted one
+            while(emitted[cursor])
+                cursor++;
+            best = cursor;
+        }
+        u32 t = (u32)best;
+        emitted[t] = 1;
+        memcpy(&out[emitted_count * 3], &indices[t * 3], sizeof(u32) * 3);
+
+        // the new triangle goes to the front of the LRU cache
+        u32 next_count = 0;
+        for(int k = 0; k < 3; k++) {
+            u32 v = indices[t * 3 + k];
+            u32 *list = &adjacency[offsets[v]];
+            for(u32 i = 0; i < remaining[v]; i++) {
+                if(list[i] == t) {
+                    list[i] = list[--remaining[v]];
+                    break;
+                }
+            }
+            next_cache[next_count++] = v;
+        }
+        for(u32 i = 0; i < cache_count; i++) {
+            u32 v = cache[i];
+            if(v != next_cache[0] && v != next_cache[1] && v != next_cache[2])
+                next_cache[next_count++] = v;
+        }
+        cache_count = next_count < VERTEX_CACHE_SIZE ? next_count : VERTEX_CACHE_SIZE;
+        memcpy(cache, next_cache, sizeof(u32) * cache_count);
+
+        // rescore everything that moved, including what fell out
+        for(u32 i = 0; i < next_count; i++) {
+            u32 v = next_cache[i];
+            cache_position[v] = i < VERTEX_CACHE_SIZE ? (int)i : -1;
+            float score = forsyth_score(cache_position[v], remaining[v]);
+            float delta = score - vertex_score[v];
+            vertex_score[v] = score;
+            for(u32 j = 0; j < remaining[v]; j++)
+                tri_score[adjacency[offsets[v] + j]] += delta;
+        }
+
+        best = -1;
+        float best_score = -1.0f;
+        for(u32 i = 0; i < cache_count; i++) {
+            u32 v = cache[i];
+            for(u32 j = 0; j < remaining[v]; j++) {
+                u32 candidate = adjacency[offsets[v] + j];
+                if(tri_score[candidate] > best_score) {
+                    best_score = tri_score[candidate];
+                    best = candidate;
+                }
+            }
+        }
+    }
+
+    memcpy(indices, out, sizeof(u32) * index_count);
+    free(offsets);
+    free(remaining);
+    free(cache_position);
+    free(vertex_score);
+    free(adjacency);
+    free(tri_score);
+    free(emitted);
+    free(out);
+}
+
+/* Renumbers vertices in first use order so fetches walk the buffer forwards. */
+static void
+optimize_vertex_fetch(Mesh *m)
+{
+    u32 *remap = checked_malloc(sizeof(u32) * m->vertex_count);
+    memset(remap, 0xff, sizeof(u32) * m->vertex_count);
+    float *positions = checked_malloc(sizeof(float) * 3 * m->vertex_count);
+    float *normals = checked_malloc(sizeof(float) * 3 * m->vertex_count);
+    float *uvs = checked_malloc(sizeof(float) * 2 * m->vertex_count);
+
+    u32 next = 0;
+    for(u32 i = 0; i < m->index_count; i++) {
+        u32 v = m->indices[i];
+        if(remap[v] == 0xffffffffu) {
+            remap[v] = next;
+            memcpy(&positions[next * 3], &m->positions[v * 3], sizeof(float) * 3);
+            memcpy(&normals[next * 3], &m->normals[v * 3], sizeof(float) * 3);
+            memcpy(&uvs[next * 2], &m->uvs[v * 2], sizeof(float) * 2);
+            next++;
+        }
+        m->indices[i] = remap[v];
+    }
+    // unreferenced vertices are dropped
+    free(m->positions);
+    free(m->normals);
+    free(m->uvs);
+    m->positions = positions;
+    m->normals = normals;
+    m->uvs = uvs;
+    m->vertex_count = next;
+    free(remap);
+}
+
+/* Every level is ordered for the vertex cache on its own, fetch order follows level 0. */
+void
+mesh_optimize(Mesh *m)
+{
+    for(u32 i = 0; i < m->lod_count; i++)
+        optimize_vertex_cache(m->indices + m->lods[i].index_offset, m->lods[i].index_count, m->vertex_count);
+    optimize_vertex_fetch(m);
+}
+
+/* Average cache miss ratio, transformed vertices per triangle with a FIFO cache. */
+float
+mesh_acmr(const u32 *indices, u32 index_count, u32 cache_size)
+{
+    u32 fifo[64] = { 0 }, head = 0, filled = 0, misses = 0;
+    if(cache_size > 64)
+        cache_size = 64;
+    for(u32 i = 0; i < index_count; i++) {
+        bool hit = false;
+        for(u32 j = 0; j < filled; j++)
+            if(fifo[j] == indices[i])
+                hit = true;
+        if(hit)
+            continue;
+        misses++;
+        fifo[head] = indices[i];
+        head = (head + 1) % cache_size;
+        if(filled < cache_size)
+            filled++;
+    }
+    return index_count ? misses / (index_count / 3.0f) : 0.0f;
+}
+
+/*
+ * Binary cache
+ */
+
+static u16
+quantize_unorm16(float value, float min, float scale)
+{
+    float t = scale > 0.0f ? (value - min) / scale : 0.0f;
+    t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+    return (u16)(t * 65535.0f + 0.5f);
+}
+
+static i16
+quantize_snorm16(float value)
+{
+    value = value < -1.0f ? -1.0f : value > 1.0f ? 1.0f : value;
+    return (i16)roundf(value * 32767.0f);
+}
+
+/* Same wrap as oct_encode in gbuffer.fs, left in [-1, 1] for snorm storage. */
+void
+mesh_oct_encode(const float *n, float *out)
+{
+    float l1 = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+    if(l1 == 0.0f) {
+        out[0] = out[1] = 0.0f;
+        return;
+    }
+    float x = n[0] / l1, y = n[1] / l1;
+    if(n[2] < 0.0f) {
+        float ox = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float oy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = ox;
+        y = oy;
+    }
+    out[0] = x;
+    out[1] = y;
+}
+
+static void
+oct_decode(float x, float y, float *n)
+{
+    n[0] = x;
+    n[1] = y;
+    n[2] = 1.0f - fabsf(x) - fabsf(y);
+    if(n[2] < 0.0f) {
+        n[0] = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        n[1] = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+    float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    for(int k = 0; k < 3; k++)
+        n[k] /= len;
+}
+
+#define ALIGN16(x) (((x) + 15u) & ~15u)
+
+void
+mesh_write_cache(const Mesh *m, const char *path)
+{
+    MeshCacheHeader h = { 0 };
+    h.magic = MESH_CACHE_MAGIC;
+    h.version = MESH_CACHE_VERSION;
+    h.vertex_count = m->vertex_count;
+    h.index_count = m->index_count;
+    h.index_size = m->vertex_count <= 65536 ? 2 : 4;
+    h.lod_count = m->lod_count;
+    memcpy(h.lods, m->lods, sizeof(MeshLod) * m->lod_count);
+
+    float uv_min[2] = { m->uvs[0], m->uvs[1] }, uv_max[2] = { m->uvs[0], m->uvs[1] };
+    for(u32 i = 0; i < m->vertex_count; i++)
+        for(int k = 0; k < 2; k++) {
+            uv_min[k] = fminf(uv_min[k], m->uvs[i * 2 + k]);
+            uv_max[k] = fmaxf(uv_max[k], m->uvs[i * 2 + k]);
+        }
+    vec3 center;
+    for(int k = 0; k < 3; k++) {
+        h.position_min[k] = m->min[k];
+        h.position_scale[k] = m->max[k] - m->min[k];
+        center[k] = h.center[k] = (m->min[k] + m->max[k]) * 0.5f;
+    }
+    for(int k = 0; k < 2; k++) {
+        h.uv_min[k] = uv_min[k];
+        h.uv_scale[k] = uv_max[k] - uv_min[k];
+    }
+    for(u32 i = 0; i < m->vertex_count; i++) {
+        vec3 d;
+        vec3_sub(d, &m->positions[i * 3], center);
+        h.radius = fmaxf(h.radius, vec3_len(d));
+    }
+
+    h.positions_offset = ALIGN16((u32)sizeof(MeshCacheHeader));
+    h.normals_offset = ALIGN16(h.positions_offset + m->vertex_count * 8);
+    h.uvs_offset = ALIGN16(h.normals_offset + m->vertex_count * 4);
+    h.indices_offset = ALIGN16(h.uvs_offset + m->vertex_count * 4);
+    h.file_size = ALIGN16(h.indices_offset + m->index_count * h.index_size);
+
+    u8 *data = calloc(h.file_size, 1);
+    if(!data) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    memcpy(data, &h, sizeof(h));
+    u16 *positions = (u16 *)(data + h.positions_offset);
+    i16 *normals = (i16 *)(data + h.normals_offset);
+    u16 *uvs = (u16 *)(data + h.uvs_offset);
+    for(u32 i = 0; i < m->vertex_count; i++) {
+        for(int k = 0; k < 3; k++)
+            positions[i * 4 + k] = quantize_unorm16(m->positions[i * 3 + k], h.position_min[k], h.position_scale[k]);
+        positions[i * 4 + 3] = 65535;
+        float oct[2];
+        mesh_oct_encode(&m->normals[i * 3], oct);
+        normals[i * 2] = quantize_snorm16(oct[0]);
+        normals[i * 2 + 1] = quantize_snorm16(oct[1]);
+        for(int k = 0; k < 2; k++)
+            uvs[i * 2 + k] = quantize_unorm16(m->uvs[i * 2 + k], h.uv_min[k], h.uv_scale[k]);
+    }
+    if(h.index_size == 2) {
+        u16 *indices = (u16 *)(data + h.indices_offset);
+        for(u32 i = 0; i < m->index_count; i++)
+            indices[i] = (u16)m->indices[i];
+    } else {
+        memcpy(data + h.indices_offset, m->indices, sizeof(u32) * m->index_count);
+    }
+
+    FILE *file = fopen(path, "wb");
+    if(!file) {
+        ERROR_EXIT(1, "Couldn't open file %s\n", path);
+    }
+    if(fwrite(data, 1, h.file_size, file) != h.file_size) {
+        ERROR_EXIT(1, "Couldn't write file %s\n", path);
+    }
+    fclose(file);
+    free(data);
+}
+
+/* A section has to be aligned and lie past the header and inside the file. */
+static bool
+mesh_cache_section(const MeshCacheHeader *h, u32 offset, u64 size)
+{
+    return offset % 16 == 0 && offset >= sizeof(MeshCacheHeader) && (u64)offset + size <= h->file_size;
+}
+
+/* Everything the readers of a view trust, so a truncated or corrupt cache is rejected instead of read past. */
+static bool
+mesh_cache_valid(const MeshCacheHeader *h)
+{
+    if(h->index_size != 2 && h->index_size != 4)
+        return false;
+    if(h->lod_count == 0 || h->lod_count > MESH_MAX_LODS)
+        return false;
+    if(!mesh_cache_section(h, h->positions_offset, (u64)h->vertex_count * 8) ||
+       !mesh_cache_section(h, h->normals_offset, (u64)h->vertex_count * 4) ||
+       !mesh_cache_section(h, h->uvs_offset, (u64)h->vertex_count * 4) ||
+       !mesh_cache_section(h, h->indices_offset, (u64)h->index_count * h->index_size))
+        return false;
+    for(u32 i = 0; i < h->lod_count; i++)
+        if((u64)h->lods[i].index_offset + h->lods[i].index_count > h->index_count)
+            return false;
+    return true;
+}
+
+/* Maps a cache file, false if it is missing, from another version or inconsistent. */
+bool
+mesh_map_cache(const char *path, MeshView *v)
+{
+    memset(v, 0, sizeof(*v));
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(MeshCacheHeader)) {
+        close(fd);
+        return false;
+    }
+    void *mapping = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+        return false;
+
+    const MeshCacheHeader *h = mapping;
+    if(h->magic != MESH_CACHE_MAGIC || h->version != MESH_CACHE_VERSION || h->file_size != (u64)st.st_size ||
+       !mesh_cache_valid(h)) {
+        munmap(mapping, (size_t)st.st_size);
+        return false;
+    }
+    const u8 *base = mapping;
+    v->mapping = mapping;
+    v->size = (size_t)st.st_size;
+    v->header = h;
+    v->positions = (const u16 *)(base + h->positions_offset);
+    v->normals = (const i16 *)(base + h->normals_offset);
+    v->uvs = (const u16 *)(base + h->uvs_offset);
+    v->indices = base + h->indices_offset;
+    return true;
+}
+
+/* Dequantizes a mapped cache back into a float mesh, for re-encoding in other formats. v is checked by mesh_map_cache. */
+void
+mesh_from_cache(const MeshView *v, Mesh *m)
+{
+    const MeshCacheHeader *h = v->header;
+    mesh_alloc(m, h->vertex_count, h->index_count);
+    for(u32 i = 0; i < h->vertex_count; i++) {
+        for(int k = 0; k < 3; k++)
+            m->positions[i * 3 + k] = h->position_min[k] + v->positions[i * 4 + k] / 65535.0f * h->position_scale[k];
+        oct_decode(fmaxf(v->normals[i * 2] / 32767.0f, -1.0f), fmaxf(v->normals[i * 2 + 1] / 32767.0f, -1.0f),
+                   &m->normals[i * 3]);
+        for(int k = 0; k < 2; k++)
+            m->uvs[i * 2 + k] = h->uv_min[k] + v->uvs[i * 2 + k] / 65535.0f * h->uv_scale[k];
+    }
+    for(u32 i = 0; i < h->index_count; i++)
+        m->indices[i] = h->index_size == 2 ? ((const u16 *)v->indices)[i] : ((const u32 *)v->indices)[i];
+    m->lod_count = h->lod_count;
+    memcpy(m->lods, h->lods, sizeof(MeshLod) * h->lod_count);
+    compute_bounds(m);
+}
+
+void
+mesh_unmap(MeshView *v)
+{
+    if(v->mapping)
+        munmap(v->mapping, v->size);
+    memset(v, 0, sizeof(*v));
+}
+
+/*
+ * Maps cache if it is at least as new as source, otherwise imports
+ * source, builds its levels of detail, optimizes it and rewrites cache
+ * first. A cache without its source is used as is.
+ */
+void
+mesh_load_cached(const char *source, const char *cache, MeshView *v)
+{
+    struct stat source_stat, cache_stat;
+    bool have_source = stat(source, &source_stat) == 0;
+    bool fresh = stat(cache, &cache_stat) == 0 &&
+                 (!have_source || cache_stat.st_mtime >= source_stat.st_mtime);
+    if(fresh && mesh_map_cache(cache, v))
+        return;
+    if(!have_source) {
+        ERROR_EXIT(1, "Couldn't open file %s\n", source);
+    }
+
+    Mesh m;
+    mesh_load(source, &m);
+    mesh_build_lods(&m, MESH_LOD_MAX_ERROR * mesh_radius(&m));
+    mesh_optimize(&m);
+    mesh_write_cache(&m, cache);
+    mesh_free(&m);
+    if(!mesh_map_cache(cache, v)) {
+        ERROR_EXIT(1, "Couldn't map mesh cache %s\n", cache);
+    }
+}
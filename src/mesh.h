@@ -0,0 +1,96 @@
+#ifndef __MESH__H__
+#define __MESH__H__
+
+#include <stddef.h>
+#include <linmath.h>
+
+#include "untitled_types.h"
+
+/*
+ * Mesh import pipeline: OBJ and glTF 2.0 (.gltf with external or
+ * embedded buffers, .glb) are parsed into an indexed mesh, reordered for
+ * the post-transform vertex cache and for vertex fetch, and written to a
+ * binary cache. The cache stores quantized attributes in the layout the
+ * GPU consumes, so loading it is an mmap and a header check. Levels of
+ * detail (see lod.h) share the vertices and follow level 0 in the index
+ * buffer.
+ */
+
+#define MESH_MAX_LODS 8
+
+/* One level of detail, a range of the index buffer. error is in object space units. */
+typedef struct {
+    u32 index_offset;
+    u32 index_count;
+    float error;
+} MeshLod;
+
+typedef struct {
+    u32 vertex_count;
+    u32 index_count;          /* all levels */
+    float *positions;         /* 3 per vertex */
+    float *normals;           /* 3 per vertex */
+    float *uvs;               /* 2 per vertex, zero if the source had none */
+    u32 *indices;
+    vec3 min, max;
+    u32 lod_count;            /* at least 1, level 0 is the full mesh */
+    MeshLod lods[MESH_MAX_LODS];
+} Mesh;
+
+#define MESH_CACHE_MAGIC 0x4853454d   /* "MESH" */
+#define MESH_CACHE_VERSION 2
+
+/*
+ * position = position_min + q / 65535 * position_scale, same for uvs,
+ * normals are octahedral snorm16 pairs. Offsets are from the start of
+ * the file and 16 byte aligned.
+ */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 vertex_count;
+    u32 index_count;
+    u32 index_size;           /* 2 or 4 */
+    u32 file_size;
+    float position_min[3];
+    float position_scale[3];
+    float uv_min[2];
+    float uv_scale[2];
+    float center[3];          /* bounding sphere */
+    float radius;
+    u32 positions_offset;     /* u16 x 4, w unused */
+    u32 normals_offset;       /* i16 x 2 */
+    u32 uvs_offset;           /* u16 x 2 */
+    u32 indices_offset;
+    u32 lod_count;
+    MeshLod lods[MESH_MAX_LODS];
+} MeshCacheHeader;
+
+typedef struct {
+    void *mapping;
+    size_t size;
+    const MeshCacheHeader *header;
+    const u16 *positions;
+    const i16 *normals;
+    const u16 *uvs;
+    const void *indices;
+} MeshView;
+
+void mesh_load_obj(const char *path, Mesh *m);
+void mesh_load_gltf(const char *path, Mesh *m);
+void mesh_load(const char *path, Mesh *m);
+void mesh_free(Mesh *m);
+void mesh_torus(Mesh *m, u32 rings, u32 sides);
+float mesh_radius(const Mesh *m);
+
+void mesh_optimize(Mesh *m);
+float mesh_acmr(const u32 *indices, u32 index_count, u32 cache_size);
+void mesh_oct_encode(const float *n, float *out);
+
+void mesh_write_cache(const Mesh *m, const char *path);
+bool mesh_map_cache(const char *path, MeshView *v);
+void mesh_from_cache(const MeshView *v, Mesh *m);
+void mesh_unmap(MeshView *v);
+void mesh_load_cached(const char *source, const char *cache, MeshView *v);
+
+#endif
@@ -0,0 +1,251 @@
+#include <math.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "occlusion.h"
+
+void
+occlusion_init(SoftwareOcclusion *o, Arena *arena)
+{
+    for(int i = 0; i < OCCLUSION_LEVELS; i++) {
+        o->width[i] = OCCLUSION_WIDTH >> i;
+        o->height[i] = OCCLUSION_HEIGHT >> i > 0 ? OCCLUSION_HEIGHT >> i : 1;
+        // rows stay 16 byte aligned, the rasterizer loads and stores 4 depths at a time
+        o->depth[i] = arena_push(arena, sizeof(float) * o->width[i] * o->height[i], 16);
+    }
+    o->triangles = 0;
+}
+
+void
+occlusion_begin(SoftwareOcclusion *o, mat4x4 view_projection)
+{
+    mat4x4_dup(o->view_projection, view_projection);
+    float *depth = o->depth[0];
+    for(int i = 0; i < o->width[0] * o->height[0]; i++)
+        depth[i] = 1.0f;
+    o->triangles = 0;
+}
+
+/* Edge function a * x + b * y + c of the edge from (x0, y0) to (x1, y1), positive on its left. */
+static void
+edge_setup(float x0, float y0, float x1, float y1, float *a, float *b, float *c)
+{
+    *a = y0 - y1;
+    *b = x1 - x0;
+    *c = x0 * y1 - y0 * x1;
+}
+
+/* Rasterizes one triangle given in clip space, in front of the near plane. */
+static void
+rasterize_triangle(SoftwareOcclusion *o, vec4 clip[3])
+{
+    int width = o->width[0], height = o->height[0];
+    float *depth = o->depth[0];
+    float x[3], y[3], z[3];
+    for(int k = 0; k < 3; k++) {
+        float inv_w = 1.0f / clip[k][3];
+        x[k] = (clip[k][0] * inv_w * 0.5f + 0.5f) * width;
+        y[k] = (clip[k][1] * inv_w * 0.5f + 0.5f) * height;
+        z[k] = clip[k][2] * inv_w * 0.5f + 0.5f;
+    }
+
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if(area <= 0.0f)
+        return;   // back facing or degenerate, the front faces cover the same pixels nearer
+
+    int min_x = (int)floorf(fminf(fminf(x[0], x[1]), x[2]));
+    int max_x = (int)ceilf(fmaxf(fmaxf(x[0], x[1]), x[2]));
+    int min_y = (int)floorf(fminf(fminf(y[0], y[1]), y[2]));
+    int max_y = (int)ceilf(fmaxf(fmaxf(y[0], y[1]), y[2]));
+    min_x = min_x < 0 ? 0 : min_x;
+    min_y = min_y < 0 ? 0 : min_y;
+    max_x = max_x > width - 1 ? width - 1 : max_x;
+    max_y = max_y > height - 1 ? height - 1 : max_y;
+    if(min_x > max_x || min_y > max_y)
+        return;
+    o->triangles++;
+
+    // edge functions and depth are planes over the screen, evaluated at pixel centers
+    float a[3], b[3], c[3];
+    edge_setup(x[1], y[1], x[2], y[2], &a[0], &b[0], &c[0]);
+    edge_setup(x[2], y[2], x[0], y[0], &a[1], &b[1], &c[1]);
+    edge_setup(x[0], y[0], x[1], y[1], &a[2], &b[2], &c[2]);
+    float inv_area = 1.0f / area;
+    float za = (a[0] * z[0] + a[1] * z[1] + a[2] * z[2]) * inv_area;
+    float zb = (b[0] * z[0] + b[1] * z[1] + b[2] * z[2]) * inv_area;
+    float zc = (c[0] * z[0] + c[1] * z[1] + c[2] * z[2]) * inv_area;
+
+#ifdef __SSE2__
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128 a0 = _mm_set1_ps(a[0]), a1 = _mm_set1_ps(a[1]), a2 = _mm_set1_ps(a[2]), az = _mm_set1_ps(za);
+    for(int py = min_y; py <= max_y; py++) {
+        float cy = py + 0.5f;
+        __m128 r0 = _mm_set1_ps(b[0] * cy + c[0]), r1 = _mm_set1_ps(b[1] * cy + c[1]);
+        __m128 r2 = _mm_set1_ps(b[2] * cy + c[2]), rz = _mm_set1_ps(zb * cy + zc);
+        float *row = depth + (size_t)py * width;
+        // the width is a multiple of 4, so aligned groups never leave the row
+        for(int px = min_x & ~3; px <= max_x; px += 4) {
+            __m128 cx = _mm_add_ps(_mm_set1_ps((float)px), lane);
+            __m128 e0 = _mm_add_ps(_mm_mul_ps(a0, cx), r0);
+            __m128 e1 = _mm_add_ps(_mm_mul_ps(a1, cx), r1);
+            __m128 e2 = _mm_add_ps(_mm_mul_ps(a2, cx), r2);
+            __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)),
+                                       _mm_cmpge_ps(e2, zero));
+            if(!_mm_movemask_ps(inside))
+                continue;
+            __m128 old = _mm_load_ps(row + px);
+            __m128 nearer = _mm_min_ps(old, _mm_add_ps(_mm_mul_ps(az, cx), rz));
+            _mm_store_ps(row + px, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+        }
+    }
+#else
+    for(int py = min_y; py <= max_y; py++) {
+        float cy = py + 0.5f;
+        float *row = depth + (size_t)py * width;
+        for(int px = min_x; px <= max_x; px++) {
+            float cx = px + 0.5f;
+            if(a[0] * cx + b[0] * cy + c[0] < 0.0f || a[1] * cx + b[1] * cy + c[1] < 0.0f ||
+               a[2] * cx + b[2] * cy + c[2] < 0.0f)
+                continue;
+            row[px] = fminf(row[px], za * cx + zb * cy + zc);
+        }
+    }
+#endif
+}
+
+void
+occlusion_rasterize(SoftwareOcclusion *o, const float *positions, const u32 *indices, u32 index_count, mat4x4 model)
+{
+    mat4x4 mvp;
+    mat4x4_mul(mvp, o->view_projection, model);
+
+    for(u32 t = 0; t + 2 < index_count; t += 3) {
+        vec4 clip[3];
+        float d[3];
+        int inside = 0;
+        for(int k = 0; k < 3; k++) {
+            const float *p = &positions[indices[t + k] * 3];
+            vec4 v = { p[0], p[1], p[2], 1.0f };
+            mat4x4_mul_vec4(clip[k], mvp, v);
+            d[k] = clip[k][2] + clip[k][3];    // distance in front of the near plane
+            inside += d[k] >= 0.0f;
+        }
+        if(inside == 3) {
+            rasterize_triangle(o, clip);
+            continue;
+        }
+        if(inside == 0)
+            continue;
+
+        // large occluders like the floor reach behind the camera, clip them to the near plane
+        vec4 polygon[4];
+        int count = 0;
+        for(int k = 0; k < 3; k++) {
+            int next = (k + 1) % 3;
+            if(d[k] >= 0.0f)
+                vec4_dup(polygon[count++], clip[k]);
+            if((d[k] >= 0.0f) != (d[next] >= 0.0f)) {
+                float s = d[k] / (d[k] - d[next]);
+                for(int c = 0; c < 4; c++)
+                    polygon[count][c] = clip[k][c] + (clip[next][c] - clip[k][c]) * s;
+                count++;
+            }
+        }
+        for(int k = 1; k + 1 < count; k++) {
+            vec4 fan[3];
+            vec4_dup(fan[0], polygon[0]);
+            vec4_dup(fan[1], polygon[k]);
+            vec4_dup(fan[2], polygon[k + 1]);
+            rasterize_triangle(o, fan);
+        }
+    }
+}
+
+void
+occlusion_build_pyramid(SoftwareOcclusion *o)
+{
+    for(int level = 1; level < OCCLUSION_LEVELS; level++) {
+        const float *src = o->depth[level - 1];
+        float *dst = o->depth[level];
+        int src_width = o->width[level - 1], src_height = o->height[level - 1];
+        for(int y = 0; y < o->height[level]; y++) {
+            int y0 = 2 * y, y1 = 2 * y + 1 < src_height ? 2 * y + 1 : y0;
+            for(int x = 0; x < o->width[level]; x++) {
+                int x0 = 2 * x, x1 = x0 + 1;
+                float d = fmaxf(fmaxf(src[y0 * src_width + x0], src[y0 * src_width + x1]),
+                                fmaxf(src[y1 * src_width + x0], src[y1 * src_width + x1]));
+                dst[y * o->width[level] + x] = d;
+            }
+        }
+    }
+}
+
+bool
+occlusion_test_box(const SoftwareOcclusion *o, const vec3 box_min, const vec3 box_max)
+{
+    float min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY, nearest = 1.0f;
+    for(int i = 0; i < 8; i++) {
+        vec4 corner = { i & 1 ? box_max[0] : box_min[0], i & 2 ? box_max[1] : box_min[1],
+                        i & 4 ? box_max[2] : box_min[2], 1.0f }, clip;
+        mat4x4_mul_vec4(clip, (vec4 *)o->view_projection, corner);
+        // reaching past the near plane, the box is right in front of the camera
+        if(clip[2] < -clip[3] || clip[3] <= 0.0f)
+            return true;
+        float inv_w = 1.0f / clip[3];
+        min_x = fminf(min_x, clip[0] * inv_w);
+        max_x = fmaxf(max_x, clip[0] * inv_w);
+        min_y = fminf(min_y, clip[1] * inv_w);
+        max_y = fmaxf(max_y, clip[1] * inv_w);
+        nearest = fminf(nearest, clip[2] * inv_w * 0.5f + 0.5f);
+    }
+    if(max_x < -1.0f || min_x > 1.0f || max_y < -1.0f || min_y > 1.0f)
+        return true;    // off screen is the frustum test's business
+
+    float x0 = fmaxf(min_x * 0.5f + 0.5f, 0.0f) * o->width[0], x1 = fminf(max_x * 0.5f + 0.5f, 1.0f) * o->width[0];
+    float y0 = fmaxf(min_y * 0.5f + 0.5f, 0.0f) * o->height[0], y1 = fminf(max_y * 0.5f + 0.5f, 1.0f) * o->height[0];
+    float size = fmaxf(x1 - x0, y1 - y0);
+    int level = size > 1.0f ? (int)ceilf(log2f(size)) : 0;
+    if(level > OCCLUSION_LEVELS - 1)
+        level = OCCLUSION_LEVELS - 1;
+
+    // at this level the rectangle touches at most 2x2 texels
+    float scale = 1.0f / (float)(1 << level);
+    int w = o->width[level], h = o->height[level];
+    int tx0 = (int)(x0 * scale), tx1 = (int)(x1 * scale), ty0 = (int)(y0 * scale), ty1 = (int)(y1 * scale);
+    tx1 = tx1 > w - 1 ? w - 1 : tx1;
+    ty1 = ty1 > h - 1 ? h - 1 : ty1;
+    tx0 = tx0 > tx1 ? tx1 : tx0;
+    ty0 = ty0 > ty1 ? ty1 : ty0;
+    const float *depth = o->depth[level];
+    float farthest = 0.0f;
+    for(int y = ty0; y <= ty1; y++)
+        for(int x = tx0; x <= tx1; x++)
+            farthest = fmaxf(farthest, depth[y * w + x]);
+    return nearest <= farthest;
+}
+
+/* Arvo's method, the world box of a transformed local box. */
+void
+occlusion_world_box(mat4x4 model, const vec3 local_min, const vec3 local_max, vec3 box_min, vec3 box_max)
+{
+    for(int i = 0; i < 3; i++) {
+        box_min[i] = box_max[i] = model[3][i];
+        for(int j = 0; j < 3; j++) {
+            float a = model[j][i] * local_min[j], b = model[j][i] * local_max[j];
+            box_min[i] += fminf(a, b);
+            box_max[i] += fmaxf(a, b);
+        }
+    }
+}
+
+const char *
+occlusion_mode_name(int mode)
+{
+    switch(mode) {
+    case OCCLUSION_GPU: return "gpu hi-z";
+    case OCCLUSION_CPU: return "cpu software";
+    default: return "off";
+    }
+}
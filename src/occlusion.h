@@ -0,0 +1,46 @@
+#ifndef __OCCLUSION__H__
+#define __OCCLUSION__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "memory.h"
+
+/*
+ * Occlusion culling. Both variants keep a max-depth pyramid: level 0 is
+ * a depth buffer, every texel of level n+1 holds the farthest of the 2x2
+ * texels under it. A box is hidden when its nearest depth lies behind
+ * the farthest depth over the screen rectangle it covers, which is read
+ * from the level where that rectangle spans at most 2x2 texels.
+ *
+ * OCCLUSION_GPU reduces last frame's depth buffer on the GPU (hiz.h).
+ * OCCLUSION_CPU rasterizes the occluders of the current frame into a
+ * small software depth buffer, for drivers where reading back GPU
+ * results is too slow or unavailable.
+ */
+
+enum { OCCLUSION_OFF, OCCLUSION_GPU, OCCLUSION_CPU, OCCLUSION_MODES };
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+#define OCCLUSION_LEVELS 8      /* down to 2x1 */
+
+typedef struct {
+    float *depth[OCCLUSION_LEVELS];
+    int width[OCCLUSION_LEVELS];
+    int height[OCCLUSION_LEVELS];
+    mat4x4 view_projection;
+    u32 triangles;             /* rasterized since occlusion_begin */
+} SoftwareOcclusion;
+
+void occlusion_init(SoftwareOcclusion *o, Arena *arena);
+void occlusion_begin(SoftwareOcclusion *o, mat4x4 view_projection);
+void occlusion_rasterize(SoftwareOcclusion *o, const float *positions, const u32 *indices, u32 index_count,
+                         mat4x4 model);
+void occlusion_build_pyramid(SoftwareOcclusion *o);
+bool occlusion_test_box(const SoftwareOcclusion *o, const vec3 box_min, const vec3 box_max);
+
+void occlusion_world_box(mat4x4 model, const vec3 local_min, const vec3 local_max, vec3 box_min, vec3 box_max);
+const char *occlusion_mode_name(int mode);
+
+#endif
@@ -0,0 +1,169 @@
+#include <glad/glad.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#include "pacing.h"
+#include "timing.h"
+
+static const char *pacing_names[PACING_MODES] = { "vsync", "uncapped", "capped", "low-latency" };
+
+const char *
+pacing_mode_name(int mode)
+{
+    return mode >= 0 && mode < PACING_MODES ? pacing_names[mode] : "unknown";
+}
+
+/* -1 for a name that isn't a mode */
+int
+pacing_mode_from_name(const char *name)
+{
+    for(int i = 0; i < PACING_MODES; i++)
+        if(!strcmp(name, pacing_names[i]))
+            return i;
+    return -1;
+}
+
+int
+pacing_swap_interval(int mode)
+{
+    return mode == PACING_VSYNC || mode == PACING_LOW_LATENCY;
+}
+
+double
+pacing_now(void)
+{
+    return now_ms() / 1000.0;
+}
+
+void
+frame_cap_init(FrameCap *c, double hz)
+{
+    c->period = 1.0 / hz;
+    c->next = 0.0;
+    c->spin = PACING_SPIN_MIN;
+    c->oversleep_max = 0.0;
+}
+
+/* Sleeps until spin seconds before the deadline, then spins. */
+void
+pacing_wait_until(FrameCap *c, double deadline)
+{
+    double now = pacing_now();
+    double sleep_until = deadline - c->spin;
+    if(now < sleep_until) {
+        double seconds = sleep_until - now;
+        struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+        nanosleep(&ts, NULL);
+        now = pacing_now();
+        double oversleep = now - sleep_until;
+        if(oversleep > c->oversleep_max)
+            c->oversleep_max = oversleep;
+        // the margin follows the scheduler, a late wake up widens it for every later frame
+        if(oversleep * 1.5 > c->spin)
+            c->spin = oversleep * 1.5 < PACING_SPIN_MAX ? oversleep * 1.5 : PACING_SPIN_MAX;
+    }
+    while(now < deadline)
+        now = pacing_now();
+}
+
+/* Returns the seconds waited. A frame later than a whole period starts a new schedule instead of catching up. */
+double
+frame_cap_wait(FrameCap *c)
+{
+    double start = pacing_now();
+    if(c->next == 0.0 || start - c->next > c->period) {
+        c->next = start + c->period;
+        return 0.0;
+    }
+    pacing_wait_until(c, c->next);
+    c->next += c->period;
+    return pacing_now() - start;
+}
+
+void
+frame_fences_init(FrameFences *f)
+{
+    memset(f, 0, sizeof(*f));
+}
+
+/* Blocks until the frame max_in_flight swaps back has finished on the GPU, returns the seconds waited. */
+double
+frame_fences_wait(FrameFences *f, int max_in_flight)
+{
+    if(max_in_flight < 1)
+        max_in_flight = 1;
+    if(max_in_flight > PACING_MAX_IN_FLIGHT)
+        max_in_flight = PACING_MAX_IN_FLIGHT;
+    if(f->frame < (u32)max_in_flight)
+        return 0.0;
+    u32 slot = (f->frame - max_in_flight) % PACING_MAX_IN_FLIGHT;
+    GLsync fence = f->fences[slot];
+    if(!fence)
+        return 0.0;
+    double start = pacing_now();
+    GLenum status;
+    do {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+    } while(status == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(fence);
+    f->fences[slot] = NULL;
+    return pacing_now() - start;
+}
+
+void
+frame_fences_insert(FrameFences *f)
+{
+    u32 slot = f->frame % PACING_MAX_IN_FLIGHT;
+    if(f->fences[slot])
+        glDeleteSync(f->fences[slot]);
+    f->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    f->frame++;
+}
+
+void
+frame_fences_destroy(FrameFences *f)
+{
+    for(int i = 0; i < PACING_MAX_IN_FLIGHT; i++)
+        if(f->fences[i])
+            glDeleteSync(f->fences[i]);
+    memset(f, 0, sizeof(*f));
+}
+
+void
+pacing_stats_frame(PacingStats *s, double swap_time, double latency, double waited)
+{
+    if(s->last_swap > 0.0) {
+        double interval = swap_time - s->last_swap;
+        s->interval_sum += interval;
+        s->interval_square_sum += interval * interval;
+        if(interval > s->interval_max)
+            s->interval_max = interval;
+        s->intervals++;
+    }
+    s->last_swap = swap_time;
+    s->latency_sum += latency;
+    if(latency > s->latency_max)
+        s->latency_max = latency;
+    s->wait_sum += waited;
+    s->frames++;
+}
+
+/* One line, jitter is the standard deviation of the swap intervals. Starts a new window. */
+void
+pacing_stats_report(PacingStats *s, FILE *out, int mode)
+{
+    if(!s->intervals)
+        return;
+    double n = (double)s->intervals;
+    double mean = s->interval_sum / n;
+    double variance = s->interval_square_sum / n - mean * mean;
+    fprintf(out, "  pacing %s: interval %.2f ms avg %.2f ms max, jitter %.3f ms, "
+            "input to swap %.2f ms avg %.2f ms max, waited %.2f ms/frame\n",
+            pacing_mode_name(mode), mean * 1000.0, s->interval_max * 1000.0,
+            (variance > 0.0 ? sqrt(variance) : 0.0) * 1000.0,
+            s->latency_sum / s->frames * 1000.0, s->latency_max * 1000.0, s->wait_sum / s->frames * 1000.0);
+    double last_swap = s->last_swap;
+    memset(s, 0, sizeof(*s));
+    s->last_swap = last_swap;
+}
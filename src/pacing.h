@@ -0,0 +1,70 @@
+#ifndef __PACING__H__
+#define __PACING__H__
+
+#include <stdio.h>
+
+#include "untitled_types.h"
+
+/*
+ * How frames are spaced out.
+ *   vsync        swap interval 1, the driver blocks in swap
+ *   uncapped     swap interval 0, as fast as the slower thread
+ *   capped       swap interval 0, input is sampled on a fixed period and the
+ *                wait for it sleeps most of the way and spins the rest
+ *   low latency  swap interval 1, at most PACING_LOW_LATENCY_FRAMES frames
+ *                in flight behind fences, input is sampled when the render
+ *                thread asks for the next frame instead of queued ahead
+ */
+enum { PACING_VSYNC, PACING_UNCAPPED, PACING_CAPPED, PACING_LOW_LATENCY, PACING_MODES };
+
+#define PACING_MAX_IN_FLIGHT 4
+#define PACING_LOW_LATENCY_FRAMES 1
+#define PACING_SPIN_MIN 0.0005   /* seconds spun before every deadline at the least */
+#define PACING_SPIN_MAX 0.004
+
+const char *pacing_mode_name(int mode);
+int pacing_mode_from_name(const char *name);
+int pacing_swap_interval(int mode);
+
+/* Seconds on CLOCK_MONOTONIC, the clock every deadline here is on. */
+double pacing_now(void);
+
+/*
+ * A fixed period wait. spin grows to the worst oversleep seen, so the
+ * sleep almost never runs past the deadline.
+ */
+typedef struct {
+    double period;
+    double next;              /* deadline of the next frame, 0 before the first */
+    double spin;
+    double oversleep_max;     /* worst the sleep ran past its own target, seconds */
+} FrameCap;
+
+void frame_cap_init(FrameCap *c, double hz);
+double frame_cap_wait(FrameCap *c);
+void pacing_wait_until(FrameCap *c, double deadline);
+
+/* A fence after every swap, frames in flight are bounded by waiting on old ones. */
+typedef struct {
+    void *fences[PACING_MAX_IN_FLIGHT];   /* GLsync */
+    u32 frame;
+} FrameFences;
+
+void frame_fences_init(FrameFences *f);
+double frame_fences_wait(FrameFences *f, int max_in_flight);
+void frame_fences_insert(FrameFences *f);
+void frame_fences_destroy(FrameFences *f);
+
+/* Swap to swap intervals and input to swap latency over a report window. */
+typedef struct {
+    u64 frames, intervals;
+    double last_swap;
+    double interval_sum, interval_square_sum, interval_max;
+    double latency_sum, latency_max;
+    double wait_sum;          /* blocked in the cap or on fences */
+} PacingStats;
+
+void pacing_stats_frame(PacingStats *s, double swap_time, double latency, double waited);
+void pacing_stats_report(PacingStats *s, FILE *out, int mode);
+
+#endif
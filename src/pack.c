@@ -0,0 +1,396 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pack.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5     /* the block always ends in at least this many literals */
+#define LZ4_MATCH_LIMIT 12      /* no match starts in the last 12 bytes */
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 12
+
+#define PACK_DATA_ALIGN 16
+
+u64
+pack_hash(const char *name, size_t length)
+{
+    u64 h = 0xcbf29ce484222325ull;
+    for(size_t i = 0; i < length; i++) {
+        h ^= (u8)name[i];
+        h *= 0x100000001b3ull;
+    }
+    return h ? h : 1;          /* 0 marks an empty bucket */
+}
+
+static u32
+read32(const u8 *p)
+{
+    u32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+size_t
+lz4_bound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+/* Token, literal length, literals, offset and match length of one sequence. False when dst is full. */
+static bool
+lz4_emit(u8 *dst, size_t capacity, size_t *out, const u8 *literals, size_t literal_length, size_t offset,
+         size_t match_length)
+{
+    size_t o = *out;
+    size_t extra = literal_length / 255 + match_length / 255 + 2;
+    if(o + 1 + extra + literal_length + 2 > capacity)
+        return false;
+
+    u8 *token = &dst[o++];
+    size_t l = literal_length;
+    *token = (u8)((l >= 15 ? 15 : l) << 4);
+    if(l >= 15) {
+        for(l -= 15; l >= 255; l -= 255)
+            dst[o++] = 255;
+        dst[o++] = (u8)l;
+    }
+    memcpy(dst + o, literals, literal_length);
+    o += literal_length;
+
+    if(match_length) {
+        dst[o++] = (u8)offset;
+        dst[o++] = (u8)(offset >> 8);
+        size_t m = match_length - LZ4_MIN_MATCH;
+        *token |= (u8)(m >= 15 ? 15 : m);
+        if(m >= 15) {
+            for(m -= 15; m >= 255; m -= 255)
+                dst[o++] = 255;
+            dst[o++] = (u8)m;
+        }
+    }
+    *out = o;
+    return true;
+}
+
+/* LZ4 block format, greedy matching on a hash of the next 4 bytes. 0 when the output doesn't fit. */
+size_t
+lz4_compress(const u8 *src, size_t size, u8 *dst, size_t capacity)
+{
+    u32 table[1 << LZ4_HASH_BITS];    /* position + 1, 0 is empty */
+    memset(table, 0, sizeof(table));
+
+    size_t out = 0, anchor = 0, ip = 0;
+    size_t limit = size > LZ4_MATCH_LIMIT ? size - LZ4_MATCH_LIMIT : 0;
+    while(ip < limit) {
+        u32 sequence = read32(src + ip);
+        u32 h = (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+        size_t candidate = table[h];
+        table[h] = (u32)ip + 1;
+        if(!candidate || ip - (candidate - 1) > LZ4_MAX_OFFSET || read32(src + candidate - 1) != sequence) {
+            ip++;
+            continue;
+        }
+        candidate--;
+        size_t length = LZ4_MIN_MATCH;
+        while(ip + length < size - LZ4_LAST_LITERALS && src[candidate + length] == src[ip + length])
+            length++;
+        if(!lz4_emit(dst, capacity, &out, src + anchor, ip - anchor, ip - candidate, length))
+            return 0;
+        ip += length;
+        anchor = ip;
+    }
+    if(!lz4_emit(dst, capacity, &out, src + anchor, size - anchor, 0, 0))
+        return 0;
+    return out;
+}
+
+/* Returns the decoded size, 0 on malformed input or when dst is too small. */
+size_t
+lz4_decompress(const u8 *src, size_t size, u8 *dst, size_t capacity)
+{
+    size_t ip = 0, op = 0;
+    while(ip < size) {
+        u8 token = src[ip++];
+        size_t literal_length = token >> 4;
+        if(literal_length == 15) {
+            u8 b;
+            do {
+                if(ip >= size)
+                    return 0;
+                b = src[ip++];
+                literal_length += b;
+            } while(b == 255);
+        }
+        if(literal_length > size - ip || literal_length > capacity - op)
+            return 0;
+        memcpy(dst + op, src + ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+        if(ip == size)
+            break;              /* the last sequence has no match */
+
+        if(size - ip < 2)
+            return 0;
+        size_t offset = src[ip] | (size_t)src[ip + 1] << 8;
+        ip += 2;
+        size_t match_length = token & 15;
+        if(match_length == 15) {
+            u8 b;
+            do {
+                if(ip >= size)
+                    return 0;
+                b = src[ip++];
+                match_length += b;
+            } while(b == 255);
+        }
+        match_length += LZ4_MIN_MATCH;
+        if(!offset || offset > op || match_length > capacity - op)
+            return 0;
+        // matches may overlap their own output, so byte by byte
+        const u8 *match = dst + op - offset;
+        for(size_t i = 0; i < match_length; i++)
+            dst[op + i] = match[i];
+        op += match_length;
+    }
+    return op;
+}
+
+static size_t
+pack_align(size_t value, size_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+static u8 *
+read_whole_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if(!file)
+        return NULL;
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    u8 *data = malloc(*size ? *size : 1);
+    if(!data) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    if(fread(data, 1, *size, file) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+bool
+pack_write(const char *path, const char **names, int count, bool compress)
+{
+    u32 bucket_count = 4;
+    while(bucket_count < (u32)count * 2)
+        bucket_count *= 2;
+
+    u8 **contents = calloc((size_t)count, sizeof(u8 *));
+    size_t *sizes = calloc((size_t)count, sizeof(size_t));
+    PackEntry *entries = calloc((size_t)count, sizeof(PackEntry));
+    if(count > 0 && (!contents || !sizes || !entries)) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    size_t names_size = 0;
+    for(int i = 0; i < count; i++) {
+        size_t original;
+        u8 *data = read_whole_file(names[i], &original);
+        if(!data) {
+            fprintf(stderr, "Couldn't read %s\n", names[i]);
+            for(int j = 0; j < i; j++)
+                free(contents[j]);
+            free(contents);
+            free(sizes);
+            free(entries);
+            return false;
+        }
+        PackEntry *e = &entries[i];
+        e->original_size = (u32)original;
+        e->compression = PACK_STORED;
+        contents[i] = data;
+        sizes[i] = original;
+
+        // only kept when it saves at least an eighth, already compressed images stay stored
+        if(compress && original > 64) {
+            size_t capacity = lz4_bound(original);
+            u8 *packed = malloc(capacity);
+            if(!packed) {
+                ERROR_EXIT(1, "Couldn't malloc\n");
+            }
+            size_t packed_size = lz4_compress(data, original, packed, capacity);
+            if(packed_size && packed_size < original - original / 8) {
+                free(data);
+                contents[i] = packed;
+                sizes[i] = packed_size;
+                e->compression = PACK_LZ4;
+            } else {
+                free(packed);
+            }
+        }
+        size_t length = strlen(names[i]);
+        e->name_length = (u16)length;
+        e->hash = pack_hash(names[i], length);
+        names_size += length + 1;
+    }
+
+    size_t names_offset = sizeof(PackHeader) + sizeof(PackEntry) * bucket_count;
+    size_t data_offset = pack_align(names_offset + names_size, PACK_DATA_ALIGN);
+    size_t file_size = data_offset;
+    for(int i = 0; i < count; i++)
+        file_size = pack_align(file_size + sizes[i] + 1, PACK_DATA_ALIGN);
+
+    u8 *file_data = calloc(1, file_size);
+    if(!file_data) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+    PackHeader *h = (PackHeader *)file_data;
+    h->magic = PACK_MAGIC;
+    h->version = PACK_VERSION;
+    h->entry_count = (u32)count;
+    h->bucket_count = bucket_count;
+    h->file_size = file_size;
+
+    PackEntry *buckets = (PackEntry *)(file_data + sizeof(PackHeader));
+    size_t name_at = names_offset, data_at = data_offset;
+    for(int i = 0; i < count; i++) {
+        PackEntry *e = &entries[i];
+        e->name_offset = (u32)name_at;
+        memcpy(file_data + name_at, names[i], e->name_length);
+        name_at += e->name_length + 1;
+        e->offset = data_at;
+        e->size = (u32)sizes[i];
+        memcpy(file_data + data_at, contents[i], sizes[i]);
+        data_at = pack_align(data_at + sizes[i] + 1, PACK_DATA_ALIGN);
+
+        u32 b = (u32)e->hash & (bucket_count - 1);
+        while(buckets[b].hash)
+            b = (b + 1) & (bucket_count - 1);
+        buckets[b] = *e;
+        free(contents[i]);
+    }
+
+    FILE *file = fopen(path, "wb");
+    if(!file) {
+        ERROR_EXIT(1, "Couldn't open file %s\n", path);
+    }
+    if(fwrite(file_data, 1, file_size, file) != file_size) {
+        ERROR_EXIT(1, "Couldn't write file %s\n", path);
+    }
+    fclose(file);
+    free(file_data);
+    free(contents);
+    free(sizes);
+    free(entries);
+    return true;
+}
+
+/*
+ * Everything lookups and views trust: a power of two table with at least
+ * one empty bucket, so probing ends, and entries and names inside the
+ * file, stored entries with room for their terminating 0.
+ */
+static bool
+pack_valid(const PackHeader *h, const PackEntry *buckets, size_t size)
+{
+    u32 n = h->bucket_count;
+    if(n == 0 || (n & (n - 1)) != 0 || sizeof(PackHeader) + sizeof(PackEntry) * (size_t)n > size)
+        return false;
+    u32 used = 0;
+    for(u32 b = 0; b < n; b++) {
+        const PackEntry *e = &buckets[b];
+        if(!e->hash)
+            continue;
+        used++;
+        u64 end = e->offset + e->size + (e->compression == PACK_STORED ? 1 : 0);
+        if((e->compression != PACK_STORED && e->compression != PACK_LZ4) || e->offset > size || end > size ||
+           (u64)e->name_offset + e->name_length > size)
+            return false;
+    }
+    return used == h->entry_count && used < n;
+}
+
+/* Maps a pack, false if it is missing, from another version or inconsistent. */
+bool
+pack_open(Pack *p, const char *path)
+{
+    memset(p, 0, sizeof(*p));
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(PackHeader)) {
+        close(fd);
+        return false;
+    }
+    void *mapping = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+        return false;
+
+    const PackHeader *h = mapping;
+    if(h->magic != PACK_MAGIC || h->version != PACK_VERSION || h->file_size != (u64)st.st_size ||
+       !pack_valid(h, (const PackEntry *)((const u8 *)mapping + sizeof(PackHeader)), (size_t)st.st_size)) {
+        munmap(mapping, (size_t)st.st_size);
+        return false;
+    }
+    p->base = mapping;
+    p->size = (size_t)st.st_size;
+    p->header = h;
+    p->buckets = (const PackEntry *)(p->base + sizeof(PackHeader));
+    return true;
+}
+
+/* NULL when the pack has no such file */
+const PackEntry *
+pack_lookup(const Pack *p, const char *name)
+{
+    size_t length = strlen(name);
+    u64 hash = pack_hash(name, length);
+    u32 mask = p->header->bucket_count - 1;
+    for(u32 b = (u32)hash & mask;; b = (b + 1) & mask) {
+        const PackEntry *e = &p->buckets[b];
+        if(!e->hash)
+            return NULL;
+        if(e->hash == hash && e->name_length == length && !memcmp(p->base + e->name_offset, name, length))
+            return e;
+    }
+}
+
+/* Stored entries point into the mapping, compressed ones are decoded into the arena. */
+PackView
+pack_view(const Pack *p, const PackEntry *e, Arena *arena)
+{
+    PackView v;
+    if(e->compression == PACK_STORED) {
+        v.data = p->base + e->offset;
+        v.size = e->size;
+        return v;
+    }
+    u8 *data = arena_push(arena, (size_t)e->original_size + 1, 16);
+    v.size = lz4_decompress(p->base + e->offset, e->size, data, e->original_size);
+    if(v.size != e->original_size) {
+        ERROR_EXIT(1, "Corrupt pack entry %.*s\n", e->name_length, (const char *)p->base + e->name_offset);
+    }
+    data[v.size] = '\0';
+    v.data = data;
+    return v;
+}
+
+void
+pack_close(Pack *p)
+{
+    if(p->base)
+        munmap((void *)p->base, p->size);
+    memset(p, 0, sizeof(*p));
+}
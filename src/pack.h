@@ -0,0 +1,72 @@
+#ifndef __PACK__H__
+#define __PACK__H__
+
+#include <stddef.h>
+
+#include "untitled_types.h"
+#include "memory.h"
+
+/*
+ * Asset pack, many files in one archive that is mapped once.
+ *
+ * Layout: PackHeader, then the directory (an open addressed hash table
+ * of PackEntry, bucket_count a power of two, empty buckets have hash 0),
+ * then the names, then the data. Paths are hashed with 64 bit FNV-1a
+ * and probed linearly, so finding a file costs a hash and usually one
+ * bucket; the stored name is compared to rule out collisions.
+ *
+ * Every entry is followed by a 0 byte that isn't part of its size, so a
+ * view of a stored entry is a NUL terminated string straight out of the
+ * mapping. Compressed entries (LZ4 block format) are decoded into an
+ * arena, again with the terminating 0.
+ */
+
+#define PACK_MAGIC 0x4b415050u       /* "PPAK" */
+#define PACK_VERSION 1
+
+enum { PACK_STORED, PACK_LZ4 };
+
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    u32 bucket_count;
+    u64 file_size;
+} PackHeader;
+
+typedef struct {
+    u64 hash;
+    u64 offset;               /* from the start of the pack */
+    u32 size;                 /* bytes in the pack */
+    u32 original_size;
+    u32 name_offset;
+    u16 name_length;
+    u16 compression;
+} PackEntry;
+
+typedef struct {
+    const u8 *base;
+    size_t size;
+    const PackHeader *header;
+    const PackEntry *buckets;
+} Pack;
+
+typedef struct {
+    const u8 *data;           /* NUL terminated */
+    size_t size;
+} PackView;
+
+bool pack_open(Pack *p, const char *path);
+const PackEntry *pack_lookup(const Pack *p, const char *name);
+PackView pack_view(const Pack *p, const PackEntry *e, Arena *arena);
+void pack_close(Pack *p);
+
+/* Writes the files into a new pack, names are stored as given. Returns false if a file couldn't be read. */
+bool pack_write(const char *path, const char **names, int count, bool compress);
+
+u64 pack_hash(const char *name, size_t length);
+size_t lz4_compress(const u8 *src, size_t size, u8 *dst, size_t capacity);
+size_t lz4_decompress(const u8 *src, size_t size, u8 *dst, size_t capacity);
+size_t lz4_bound(size_t size);
+
+#endif
@@ -0,0 +1,313 @@
+#include <glad/glad.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "particles.h"
+#include "timing.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define PARTICLES_BOUNCE 0.4f     /* of the vertical speed kept off the floor */
+#define PARTICLES_MAX_STEP 0.05f  /* a hitch doesn't throw the fountain apart */
+
+static const char *particles_mode_names[PARTICLES_MODES] = { "off", "gpu", "cpu" };
+
+const char *
+particles_mode_name(int mode)
+{
+    return mode >= 0 && mode < PARTICLES_MODES ? particles_mode_names[mode] : "unknown";
+}
+
+/* lowbias32, particles_update.vs has the same one so both paths spawn the same particles */
+static u32
+particles_hash(u32 x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static float
+particles_random(u32 *state)
+{
+    *state = particles_hash(*state);
+    return (*state & 0xffffffu) / 16777216.0f;
+}
+
+static void
+particles_spawn(Particle *p, u32 index, u32 step, const ParticleEmitter *e)
+{
+    u32 state = index * 0x9e3779b9u ^ step * 0x85ebca6bu;
+    float angle = particles_random(&state) * 6.2831853f;
+    float radial = e->spread * sqrtf(particles_random(&state));
+    float speed = e->speed * (0.75f + 0.5f * particles_random(&state));
+    float life = e->lifetime * (0.5f + 0.5f * particles_random(&state));
+    float size = e->size * (0.5f + particles_random(&state));
+    p->position_life[0] = e->position[0];
+    p->position_life[1] = e->position[1];
+    p->position_life[2] = e->position[2];
+    p->position_life[3] = life;
+    p->velocity_size[0] = cosf(angle) * radial * speed;
+    p->velocity_size[1] = speed;
+    p->velocity_size[2] = sinf(angle) * radial * speed;
+    p->velocity_size[3] = size;
+}
+
+static void
+particles_step_range(Particle *particles, int begin, int end, u32 step, float dt, const ParticleEmitter *e)
+{
+    for(int i = begin; i < end; i++) {
+        Particle *p = &particles[i];
+        p->position_life[3] -= dt;
+        if(p->position_life[3] <= 0.0f) {
+            particles_spawn(p, (u32)i, step, e);
+            continue;
+        }
+        p->velocity_size[1] -= e->gravity * dt;
+        for(int k = 0; k < 3; k++)
+            p->position_life[k] += p->velocity_size[k] * dt;
+        if(p->position_life[1] < e->floor) {
+            p->position_life[1] = e->floor;
+            p->velocity_size[1] *= -PARTICLES_BOUNCE;
+        }
+    }
+}
+
+void
+particles_step_scalar(Particle *particles, int count, u32 step, float dt, const ParticleEmitter *e)
+{
+    particles_step_range(particles, 0, count, step, dt, e);
+}
+
+/*
+ * One step of the CPU path, the same integration and respawns as
+ * particles_update.vs. A particle is one register per vec4, so the
+ * buffer layout is kept; transposing four particles into registers per
+ * component and back cost more than it saved.
+ */
+void
+particles_step(Particle *particles, int count, u32 step, float dt, const ParticleEmitter *e)
+{
+    int i = 0;
+#ifdef __SSE__
+    __m128 move = _mm_setr_ps(dt, dt, dt, 0.0f), age = _mm_setr_ps(0.0f, 0.0f, 0.0f, dt);
+    __m128 fall = _mm_setr_ps(0.0f, e->gravity * dt, 0.0f, 0.0f);
+    for(; i < count; i++) {
+        Particle *p = &particles[i];
+        __m128 velocity = _mm_sub_ps(_mm_loadu_ps(p->velocity_size), fall);
+        __m128 position = _mm_add_ps(_mm_loadu_ps(p->position_life), _mm_mul_ps(velocity, move));
+        _mm_storeu_ps(p->velocity_size, velocity);
+        _mm_storeu_ps(p->position_life, _mm_sub_ps(position, age));
+        // respawns and bounces are rare, once per lifetime at most
+        if(p->position_life[3] <= 0.0f) {
+            particles_spawn(p, (u32)i, step, e);
+        } else if(p->position_life[1] < e->floor) {
+            p->position_life[1] = e->floor;
+            p->velocity_size[1] *= -PARTICLES_BOUNCE;
+        }
+    }
+#endif
+    particles_step_range(particles, i, count, step, dt, e);
+}
+
+/* Every particle spawned and aged by part of its life, so the fountain starts out full. */
+static void
+particles_prewarm(Particle *particles, int count, const ParticleEmitter *e)
+{
+    for(int i = 0; i < count; i++) {
+        Particle *p = &particles[i];
+        particles_spawn(p, (u32)i, 0, e);
+        u32 state = (u32)i;
+        float t = p->position_life[3] * particles_random(&state);
+        for(int k = 0; k < 3; k++)
+            p->position_life[k] += p->velocity_size[k] * t;
+        p->position_life[1] -= 0.5f * e->gravity * t * t;
+        p->velocity_size[1] -= e->gravity * t;
+        p->position_life[3] -= t;
+        if(p->position_life[1] < e->floor) {
+            p->position_life[1] = e->floor;
+            p->velocity_size[1] = 0.0f;
+        }
+    }
+}
+
+static void
+particles_state_attributes(unsigned int first_location, unsigned int divisor)
+{
+    for(unsigned int i = 0; i < 2; i++) {
+        glVertexAttribPointer(first_location + i, 4, GL_FLOAT, GL_FALSE, sizeof(Particle),
+                              (void *)(i * sizeof(vec4)));
+        glEnableVertexAttribArray(first_location + i);
+        glVertexAttribDivisor(first_location + i, divisor);
+    }
+}
+
+/* update_shader is a vertex shader alone, linked here with its outputs captured. */
+void
+particles_init(ParticleSystem *ps, unsigned int update_shader, unsigned int draw_program, int count,
+               const ParticleEmitter *emitter, Arena *arena)
+{
+    memset(ps, 0, sizeof(*ps));
+    ps->draw_program = draw_program;
+    ps->count = count;
+    ps->emitter = *emitter;
+    ps->cpu = ARENA_ARRAY(arena, Particle, count);
+    particles_prewarm(ps->cpu, count, emitter);
+    ps->cpu_current = true;
+    ps->step = 1;
+
+    const char *varyings[] = { "positionLife", "velocitySize" };
+    ps->update_program = glCreateProgram();
+    glAttachShader(ps->update_program, update_shader);
+    glTransformFeedbackVaryings(ps->update_program, 2, varyings, GL_INTERLEAVED_ATTRIBS);
+    glLinkProgram(ps->update_program);
+    int success;
+    char info[512];
+    glGetProgramiv(ps->update_program, GL_LINK_STATUS, &success);
+    if(!success) {
+        glGetProgramInfoLog(ps->update_program, sizeof(info), NULL, info);
+        ERROR_EXIT(1, "Particle update program link failed %s\n", info);
+    }
+    glDeleteShader(update_shader);
+    unsigned int program = ps->update_program;
+    ps->loc_dt = glGetUniformLocation(program, "dt");
+    ps->loc_step = glGetUniformLocation(program, "step");
+    ps->loc_emitter = glGetUniformLocation(program, "emitter");
+    ps->loc_speed = glGetUniformLocation(program, "speed");
+    ps->loc_spread = glGetUniformLocation(program, "spread");
+    ps->loc_lifetime = glGetUniformLocation(program, "lifetime");
+    ps->loc_gravity = glGetUniformLocation(program, "gravity");
+    ps->loc_floor = glGetUniformLocation(program, "floorHeight");
+    ps->loc_bounce = glGetUniformLocation(program, "bounce");
+    ps->loc_size = glGetUniformLocation(program, "size");
+    ps->loc_view = glGetUniformLocation(draw_program, "view");
+    ps->loc_projection = glGetUniformLocation(draw_program, "projection");
+    ps->loc_draw_lifetime = glGetUniformLocation(draw_program, "lifetime");
+    ps->loc_color = glGetUniformLocation(draw_program, "color");
+
+    const float corners[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+    glGenBuffers(1, &ps->quad_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, ps->quad_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+    size_t bytes = sizeof(Particle) * (size_t)count;
+    glGenBuffers(2, ps->buffers);
+    glGenVertexArrays(2, ps->update_vao);
+    glGenVertexArrays(2, ps->draw_vao);
+    for(int i = 0; i < 2; i++) {
+        glBindBuffer(GL_ARRAY_BUFFER, ps->buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, bytes, i == 0 ? ps->cpu : NULL, GL_DYNAMIC_COPY);
+
+        glBindVertexArray(ps->update_vao[i]);
+        particles_state_attributes(0, 0);
+
+        glBindVertexArray(ps->draw_vao[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, ps->quad_vbo);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, ps->buffers[i]);
+        particles_state_attributes(1, 1);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    gpu_timer_init(&ps->update_timer);
+    gpu_timer_init(&ps->draw_timer);
+}
+
+/* Reads the current buffer and writes the other one, nothing comes back to the CPU. */
+void
+particles_update_gpu(ParticleSystem *ps, float dt)
+{
+    dt = dt < PARTICLES_MAX_STEP ? dt : PARTICLES_MAX_STEP;
+    const ParticleEmitter *e = &ps->emitter;
+    int next = 1 - ps->current;
+
+    gpu_timer_begin(&ps->update_timer);
+    glUseProgram(ps->update_program);
+    glUniform1f(ps->loc_dt, dt);
+    glUniform1ui(ps->loc_step, ps->step);
+    glUniform3fv(ps->loc_emitter, 1, e->position);
+    glUniform1f(ps->loc_speed, e->speed);
+    glUniform1f(ps->loc_spread, e->spread);
+    glUniform1f(ps->loc_lifetime, e->lifetime);
+    glUniform1f(ps->loc_gravity, e->gravity);
+    glUniform1f(ps->loc_floor, e->floor);
+    glUniform1f(ps->loc_bounce, PARTICLES_BOUNCE);
+    glUniform1f(ps->loc_size, e->size);
+
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(ps->update_vao[ps->current]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, ps->buffers[next]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, ps->count);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glBindVertexArray(0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    gpu_timer_end(&ps->update_timer);
+
+    ps->current = next;
+    ps->step++;
+    ps->cpu_current = false;
+}
+
+/* Steps the CPU copy and replaces the current buffer with it, the old storage is orphaned rather than waited on. */
+void
+particles_update_cpu(ParticleSystem *ps, float dt)
+{
+    dt = dt < PARTICLES_MAX_STEP ? dt : PARTICLES_MAX_STEP;
+    double start = now_ms();
+    size_t bytes = sizeof(Particle) * (size_t)ps->count;
+    glBindBuffer(GL_ARRAY_BUFFER, ps->buffers[ps->current]);
+    if(!ps->cpu_current)
+        glGetBufferSubData(GL_ARRAY_BUFFER, 0, bytes, ps->cpu);
+    particles_step(ps->cpu, ps->count, ps->step, dt, &ps->emitter);
+    glBufferData(GL_ARRAY_BUFFER, bytes, ps->cpu, GL_DYNAMIC_COPY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ps->cpu_current = true;
+    ps->step++;
+    ps->cpu_ms = now_ms() - start;
+}
+
+/* Additive, after the opaque passes: depth tested but not written. */
+void
+particles_draw(ParticleSystem *ps, mat4x4 view, mat4x4 projection)
+{
+    gpu_timer_begin(&ps->draw_timer);
+    glUseProgram(ps->draw_program);
+    glUniformMatrix4fv(ps->loc_view, 1, GL_FALSE, (GLfloat *)view);
+    glUniformMatrix4fv(ps->loc_projection, 1, GL_FALSE, (GLfloat *)projection);
+    glUniform1f(ps->loc_draw_lifetime, ps->emitter.lifetime);
+    glUniform3fv(ps->loc_color, 1, ps->emitter.color);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glDepthMask(GL_FALSE);
+    glBindVertexArray(ps->draw_vao[ps->current]);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, ps->count);
+    glBindVertexArray(0);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    gpu_timer_end(&ps->draw_timer);
+}
+
+void
+particles_destroy(ParticleSystem *ps)
+{
+    glDeleteProgram(ps->update_program);
+    glDeleteBuffers(2, ps->buffers);
+    glDeleteBuffers(1, &ps->quad_vbo);
+    glDeleteVertexArrays(2, ps->update_vao);
+    glDeleteVertexArrays(2, ps->draw_vao);
+    gpu_timer_destroy(&ps->update_timer);
+    gpu_timer_destroy(&ps->draw_timer);
+}
@@ -0,0 +1,74 @@
+#ifndef __PARTICLES__H__
+#define __PARTICLES__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "gpu_timer.h"
+#include "memory.h"
+
+/*
+ * A fountain of particles. On the GPU path a vertex shader advances every
+ * particle one step and transform feedback captures the result into the
+ * other of two buffers, the next step reads that one back; the CPU never
+ * sees the particles. There is no compute in GL 3.3. Both buffers are
+ * drawn straight from as instanced camera facing quads.
+ *
+ * The CPU path runs the same step with SSE on the same layout and
+ * uploads the result into the buffer the quads are drawn from. It is
+ * meant for drivers that emulate the vertex stage on the CPU anyway.
+ * Switching between the two reads the GPU state back once.
+ */
+
+enum { PARTICLES_OFF, PARTICLES_GPU, PARTICLES_CPU, PARTICLES_MODES };
+
+/* The vertex layout of both buffers. */
+typedef struct {
+    vec4 position_life;       /* w: seconds left, respawned at 0 */
+    vec4 velocity_size;       /* w: quad half size */
+} Particle;
+
+typedef struct {
+    vec3 position;
+    vec3 color;
+    float speed;              /* of a new particle, +-25% */
+    float spread;             /* sideways over up, at the edge of the cone */
+    float lifetime;           /* the longest a particle lives, the shortest half of it */
+    float gravity;
+    float floor;              /* particles bounce off this height */
+    float size;
+} ParticleEmitter;
+
+typedef struct {
+    unsigned int update_program;
+    unsigned int draw_program;
+    unsigned int buffers[2];
+    unsigned int update_vao[2];   /* reads buffers[i] */
+    unsigned int draw_vao[2];     /* quad corners + buffers[i] per instance */
+    unsigned int quad_vbo;
+    /* uniform locations of the two programs, looked up once after linking */
+    int loc_dt, loc_step, loc_emitter, loc_speed, loc_spread, loc_lifetime, loc_gravity, loc_floor, loc_bounce, loc_size;
+    int loc_view, loc_projection, loc_draw_lifetime, loc_color;
+    int current;                  /* the buffer with the latest state */
+    int count;
+    u32 step;                     /* steps so far, seeds respawns */
+    ParticleEmitter emitter;
+
+    Particle *cpu;                /* the CPU path's copy */
+    bool cpu_current;             /* false once the GPU path has stepped past it */
+    double cpu_ms;                /* of the last CPU step and upload */
+    GpuTimer update_timer;
+    GpuTimer draw_timer;
+} ParticleSystem;
+
+const char *particles_mode_name(int mode);
+void particles_init(ParticleSystem *ps, unsigned int update_shader, unsigned int draw_program, int count,
+                    const ParticleEmitter *emitter, Arena *arena);
+void particles_step(Particle *particles, int count, u32 step, float dt, const ParticleEmitter *e);
+void particles_step_scalar(Particle *particles, int count, u32 step, float dt, const ParticleEmitter *e);
+void particles_update_gpu(ParticleSystem *ps, float dt);
+void particles_update_cpu(ParticleSystem *ps, float dt);
+void particles_draw(ParticleSystem *ps, mat4x4 view, mat4x4 projection);
+void particles_destroy(ParticleSystem *ps);
+
+#endif
@@ -0,0 +1,490 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "post.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+static const char *post_mode_names[POST_MODES] = { "off", "tone map", "tone map + bloom" };
+static const char *post_aa_names[POST_AA_MODES] = { "off", "msaa2", "msaa4", "msaa8", "fxaa", "taa" };
+static const int post_aa_samples[POST_AA_MODES] = { 0, 2, 4, 8, 0, 0 };
+
+/* Halton 2, 3, the first 8, centred on the pixel */
+static const float post_jitter_offsets[8][2] = {
+    {  0.0f,     -0.16667f }, { -0.25f,  0.16667f }, {  0.25f,  -0.38889f }, { -0.375f,  -0.05556f },
+    {  0.125f,    0.27778f }, { -0.125f, -0.27778f }, {  0.375f,   0.05556f }, { -0.4375f,  0.38889f },
+};
+
+const char *
+post_mode_name(int mode)
+{
+    return mode >= 0 && mode < POST_MODES ? post_mode_names[mode] : "unknown";
+}
+
+const char *
+post_aa_name(int aa)
+{
+    return aa >= 0 && aa < POST_AA_MODES ? post_aa_names[aa] : "unknown";
+}
+
+int
+post_aa_from_name(const char *name)
+{
+    for(int i = 0; i < POST_AA_MODES; i++) {
+        if(!strcmp(name, post_aa_names[i]))
+            return i;
+    }
+    return -1;
+}
+
+static void
+post_texture(unsigned int *texture, GLenum internal_format, int width, int height, GLenum format, GLenum type,
+             GLenum filter)
+{
+    glGenTextures(1, texture);
+    glBindTexture(GL_TEXTURE_2D, *texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, type, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+static void
+post_bloom_size(const Post *p, int level, int *width, int *height)
+{
+    *width = p->width >> (level + 1) > 0 ? p->width >> (level + 1) : 1;
+    *height = p->height >> (level + 1) > 0 ? p->height >> (level + 1) : 1;
+}
+
+/* The part of a bloom level this frame covers. */
+static void
+post_bloom_view(const Post *p, int level, int *width, int *height)
+{
+    *width = p->view_width >> (level + 1) > 0 ? p->view_width >> (level + 1) : 1;
+    *height = p->view_height >> (level + 1) > 0 ? p->view_height >> (level + 1) : 1;
+}
+
+/* Passes sample their input over the covered corner, in UV of the whole texture. */
+static void
+post_uv_scale(int location, int view_width, int view_height, int width, int height)
+{
+    glUniform2f(location, (float)view_width / width, (float)view_height / height);
+}
+
+static void
+post_create_targets(Post *p, int width, int height, int bloom_levels, int aa)
+{
+    p->width = width;
+    p->height = height;
+    p->bloom_levels = 1;
+    while(p->bloom_levels < bloom_levels && (width | height) >> (p->bloom_levels + 1) > 1)
+        p->bloom_levels++;
+
+    // linear so the composite pass can scale it up to the window
+    post_texture(&p->hdr_tex, GL_RGBA16F, width, height, GL_RGBA, GL_HALF_FLOAT, GL_LINEAR);
+    post_texture(&p->depth_tex, GL_DEPTH24_STENCIL8, width, height, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_NEAREST);
+
+    glGenFramebuffers(1, &p->hdr_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, p->hdr_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->hdr_tex, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, p->depth_tex, 0);
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        ERROR_EXIT(1, "HDR framebuffer is not complete\n");
+    }
+
+    // 4 bytes a texel, bloom has no use for alpha or half float precision
+    glGenTextures(1, &p->bloom_tex);
+    glBindTexture(GL_TEXTURE_2D, p->bloom_tex);
+    for(int level = 0; level < p->bloom_levels; level++) {
+        int w, h;
+        post_bloom_size(p, level, &w, &h);
+        glTexImage2D(GL_TEXTURE_2D, level, GL_R11F_G11F_B10F, w, h, 0, GL_RGB, GL_FLOAT, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, p->bloom_levels - 1);
+    glGenFramebuffers(1, &p->bloom_fbo);
+
+    p->samples = post_aa_samples[aa];
+    if(p->samples) {
+        int max_samples;
+        glGetIntegerv(GL_MAX_SAMPLES, &max_samples);
+        p->samples = p->samples < max_samples ? p->samples : max_samples;
+        glGenRenderbuffers(1, &p->msaa_color_rb);
+        glBindRenderbuffer(GL_RENDERBUFFER, p->msaa_color_rb);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, p->samples, GL_RGBA16F, width, height);
+        glGenRenderbuffers(1, &p->msaa_depth_rb);
+        glBindRenderbuffer(GL_RENDERBUFFER, p->msaa_depth_rb);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, p->samples, GL_DEPTH24_STENCIL8, width, height);
+        glGenFramebuffers(1, &p->msaa_fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, p->msaa_fbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, p->msaa_color_rb);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, p->msaa_depth_rb);
+        if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            ERROR_EXIT(1, "MSAA framebuffer is not complete\n");
+        }
+    }
+    p->scene_fbo = p->samples ? p->msaa_fbo : p->hdr_fbo;
+
+    if(aa == POST_AA_TAA) {
+        for(int i = 0; i < 2; i++)
+            post_texture(&p->history_tex[i], GL_RGBA16F, width, height, GL_RGBA, GL_HALF_FLOAT, GL_LINEAR);
+        glGenFramebuffers(1, &p->taa_fbo);
+        p->history_valid = false;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void
+post_destroy_targets(Post *p)
+{
+    unsigned int textures[] = { p->hdr_tex, p->depth_tex, p->bloom_tex, p->history_tex[0], p->history_tex[1] };
+    unsigned int framebuffers[] = { p->hdr_fbo, p->bloom_fbo, p->msaa_fbo, p->taa_fbo };
+    unsigned int renderbuffers[] = { p->msaa_color_rb, p->msaa_depth_rb };
+    glDeleteTextures(5, textures);
+    glDeleteFramebuffers(4, framebuffers);
+    glDeleteRenderbuffers(2, renderbuffers);
+    p->hdr_tex = 0;
+    p->history_tex[0] = p->history_tex[1] = 0;
+    p->msaa_fbo = p->taa_fbo = 0;
+    p->msaa_color_rb = p->msaa_depth_rb = 0;
+    p->samples = 0;
+}
+
+static void
+post_destroy_ldr(Post *p)
+{
+    glDeleteTextures(1, &p->ldr_tex);
+    glDeleteFramebuffers(1, &p->ldr_fbo);
+    p->ldr_tex = 0;
+    p->ldr_fbo = 0;
+}
+
+void
+post_init(Post *p, unsigned int downsample_program, unsigned int upsample_program, unsigned int composite_program,
+          unsigned int fxaa_program, unsigned int taa_program)
+{
+    memset(p, 0, sizeof(*p));
+    p->downsample_program = downsample_program;
+    p->upsample_program = upsample_program;
+    p->composite_program = composite_program;
+    p->fxaa_program = fxaa_program;
+    p->taa_program = taa_program;
+    glGenVertexArrays(1, &p->empty_vao);
+
+    glUseProgram(downsample_program);
+    glUniform1i(glGetUniformLocation(downsample_program, "source"), 0);
+    glUseProgram(upsample_program);
+    glUniform1i(glGetUniformLocation(upsample_program, "source"), 0);
+    glUseProgram(composite_program);
+    glUniform1i(glGetUniformLocation(composite_program, "scene"), 0);
+    glUniform1i(glGetUniformLocation(composite_program, "bloom"), 1);
+    glUseProgram(fxaa_program);
+    glUniform1i(glGetUniformLocation(fxaa_program, "image"), 0);
+    glUseProgram(taa_program);
+    glUniform1i(glGetUniformLocation(taa_program, "current"), 0);
+    glUniform1i(glGetUniformLocation(taa_program, "history"), 1);
+    glUniform1i(glGetUniformLocation(taa_program, "depth"), 2);
+
+    p->loc_down_texel = glGetUniformLocation(downsample_program, "texelSize");
+    p->loc_down_uv = glGetUniformLocation(downsample_program, "uvScale");
+    p->loc_down_prefilter = glGetUniformLocation(downsample_program, "prefilter");
+    p->loc_down_threshold = glGetUniformLocation(downsample_program, "threshold");
+    p->loc_up_texel = glGetUniformLocation(upsample_program, "texelSize");
+    p->loc_up_uv = glGetUniformLocation(upsample_program, "uvScale");
+    p->loc_taa_reprojection = glGetUniformLocation(taa_program, "reprojection");
+    p->loc_taa_jitter = glGetUniformLocation(taa_program, "jitter");
+    p->loc_taa_view_size = glGetUniformLocation(taa_program, "viewSize");
+    p->loc_taa_history_uv = glGetUniformLocation(taa_program, "historyUvScale");
+    p->loc_taa_feedback = glGetUniformLocation(taa_program, "feedback");
+    p->loc_exposure = glGetUniformLocation(composite_program, "exposure");
+    p->loc_bloom_intensity = glGetUniformLocation(composite_program, "bloomIntensity");
+    p->loc_sharpness = glGetUniformLocation(composite_program, "sharpness");
+    p->loc_composite_texel = glGetUniformLocation(composite_program, "texelSize");
+    p->loc_composite_uv = glGetUniformLocation(composite_program, "uvScale");
+    p->loc_bloom_uv = glGetUniformLocation(composite_program, "bloomUvScale");
+    p->loc_fxaa_texel = glGetUniformLocation(fxaa_program, "texelSize");
+
+    gpu_timer_init(&p->aa_timer);
+    gpu_timer_init(&p->bloom_down_timer);
+    gpu_timer_init(&p->bloom_up_timer);
+    gpu_timer_init(&p->composite_timer);
+}
+
+/*
+ * Sizes the targets for config.render_scale, they are only recreated when
+ * that size, the bloom levels or the anti-aliasing change. This frame is
+ * drawn at scale, at most render_scale, into a corner of them. Leaves
+ * scene_fbo bound with its viewport set, the scene is drawn next.
+ */
+void
+post_configure(Post *p, PostConfig config, float scale, int window_width, int window_height)
+{
+    if(config.render_scale <= 0.0f)
+        config.render_scale = 1.0f;
+    if(config.bloom_levels < 1)
+        config.bloom_levels = 1;
+    if(config.bloom_levels > POST_MAX_BLOOM_LEVELS)
+        config.bloom_levels = POST_MAX_BLOOM_LEVELS;
+    if(config.aa < 0 || config.aa >= POST_AA_MODES)
+        config.aa = POST_AA_OFF;
+
+    int width = (int)(window_width * config.render_scale + 0.5f);
+    int height = (int)(window_height * config.render_scale + 0.5f);
+    width = width > 0 ? width : 1;
+    height = height > 0 ? height : 1;
+    if(!p->hdr_tex || width != p->width || height != p->height || config.bloom_levels != p->config.bloom_levels ||
+       config.aa != p->config.aa) {
+        if(p->hdr_tex)
+            post_destroy_targets(p);
+        post_create_targets(p, width, height, config.bloom_levels, config.aa);
+    }
+    if(config.aa != POST_AA_FXAA && p->ldr_tex)
+        post_destroy_ldr(p);
+    p->config = config;
+
+    p->scale = scale > 0.0f && scale < config.render_scale ? scale : config.render_scale;
+    p->view_width = (int)(window_width * p->scale + 0.5f);
+    p->view_height = (int)(window_height * p->scale + 0.5f);
+    p->view_width = p->view_width < 1 ? 1 : p->view_width > p->width ? p->width : p->view_width;
+    p->view_height = p->view_height < 1 ? 1 : p->view_height > p->height ? p->height : p->view_height;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, p->scene_fbo);
+    glViewport(0, 0, p->view_width, p->view_height);
+}
+
+/*
+ * Under TAA moves projection by this frame's subpixel offset, so every
+ * pixel sees a different part of itself over the sequence.
+ * view_projection is the unjittered one, reprojection goes by it.
+ */
+void
+post_jitter(Post *p, mat4x4 projection, mat4x4 view_projection)
+{
+    mat4x4_dup(p->prev_view_projection, p->view_projection);
+    mat4x4_dup(p->view_projection, view_projection);
+    if(p->config.aa != POST_AA_TAA) {
+        p->jitter[0] = p->jitter[1] = 0.0f;
+        return;
+    }
+    const float *offset = post_jitter_offsets[p->jitter_index++ % 8];
+    p->jitter[0] = offset[0];
+    p->jitter[1] = offset[1];
+    // clip x and y move by the offset times w, the same in NDC after the divide
+    float x = 2.0f * offset[0] / p->view_width, y = 2.0f * offset[1] / p->view_height;
+    for(int column = 0; column < 4; column++) {
+        projection[column][0] += x * projection[column][3];
+        projection[column][1] += y * projection[column][3];
+    }
+}
+
+static void
+post_bloom(Post *p, unsigned int source)
+{
+    PostConfig *c = &p->config;
+    glBindFramebuffer(GL_FRAMEBUFFER, p->bloom_fbo);
+    glActiveTexture(GL_TEXTURE0);
+
+    gpu_timer_begin(&p->bloom_down_timer);
+    glUseProgram(p->downsample_program);
+    float knee = c->bloom_knee > 1e-4f ? c->bloom_knee : 1e-4f;
+    glUniform3f(p->loc_down_threshold, c->bloom_threshold, c->bloom_threshold - knee, 0.25f / knee);
+
+    // the bright pass rides along with the first downsample
+    glBindTexture(GL_TEXTURE_2D, source);
+    glUniform1i(p->loc_down_prefilter, 1);
+    glUniform2f(p->loc_down_texel, 1.0f / p->width, 1.0f / p->height);
+    post_uv_scale(p->loc_down_uv, p->view_width, p->view_height, p->width, p->height);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->bloom_tex, 0);
+    int w, h, vw, vh;
+    post_bloom_size(p, 0, &w, &h);
+    post_bloom_view(p, 0, &vw, &vh);
+    glViewport(0, 0, vw, vh);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glUniform1i(p->loc_down_prefilter, 0);
+    glBindTexture(GL_TEXTURE_2D, p->bloom_tex);
+    for(int level = 1; level < p->bloom_levels; level++) {
+        // only the level read is visible to the pass, as in hiz_build
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+        glUniform2f(p->loc_down_texel, 1.0f / w, 1.0f / h);
+        post_uv_scale(p->loc_down_uv, vw, vh, w, h);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->bloom_tex, level);
+        post_bloom_size(p, level, &w, &h);
+        post_bloom_view(p, level, &vw, &vh);
+        glViewport(0, 0, vw, vh);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    gpu_timer_end(&p->bloom_down_timer);
+
+    // each level keeps its own downsample and gains the blurred levels below it
+    gpu_timer_begin(&p->bloom_up_timer);
+    glUseProgram(p->upsample_program);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    for(int level = p->bloom_levels - 2; level >= 0; level--) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level + 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level + 1);
+        post_bloom_size(p, level + 1, &w, &h);
+        post_bloom_view(p, level + 1, &vw, &vh);
+        glUniform2f(p->loc_up_texel, 1.0f / w, 1.0f / h);
+        post_uv_scale(p->loc_up_uv, vw, vh, w, h);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->bloom_tex, level);
+        post_bloom_view(p, level, &vw, &vh);
+        glViewport(0, 0, vw, vh);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glDisable(GL_BLEND);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, p->bloom_levels - 1);
+    gpu_timer_end(&p->bloom_up_timer);
+}
+
+/* Blends this frame into the history, returns the texture holding the result. */
+static unsigned int
+post_taa(Post *p)
+{
+    int next = 1 - p->history;
+    mat4x4 inverse, reprojection;
+    mat4x4_invert(inverse, p->view_projection);
+    mat4x4_mul(reprojection, p->prev_view_projection, inverse);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, p->taa_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->history_tex[next], 0);
+    glViewport(0, 0, p->view_width, p->view_height);
+    glUseProgram(p->taa_program);
+    glUniformMatrix4fv(p->loc_taa_reprojection, 1, GL_FALSE, (GLfloat *)reprojection);
+    glUniform2f(p->loc_taa_jitter, p->jitter[0] / p->view_width, p->jitter[1] / p->view_height);
+    glUniform2i(p->loc_taa_view_size, p->view_width, p->view_height);
+    glUniform2fv(p->loc_taa_history_uv, 1, p->history_uv);
+    glUniform1f(p->loc_taa_feedback, p->history_valid ? p->config.taa_feedback : 1.0f);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, p->depth_tex);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, p->history_tex[p->history]);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, p->hdr_tex);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    p->history = next;
+    p->history_valid = true;
+    p->history_uv[0] = (float)p->view_width / p->width;
+    p->history_uv[1] = (float)p->view_height / p->height;
+    return p->history_tex[next];
+}
+
+/* Resolves the HDR target into the default framebuffer, which is left bound. */
+void
+post_end(Post *p, int mode, int window_width, int window_height)
+{
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glBindVertexArray(p->empty_vao);
+
+    // everything after reads the resolved target, hi-z its depth
+    unsigned int source = p->hdr_tex;
+    gpu_timer_begin(&p->aa_timer);
+    if(p->samples) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, p->msaa_fbo);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, p->hdr_fbo);
+        int w = p->view_width, h = p->view_height;
+        glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+    } else if(p->config.aa == POST_AA_TAA) {
+        source = post_taa(p);
+    }
+    gpu_timer_end(&p->aa_timer);
+
+    bool bloom = mode == POST_BLOOM;
+    if(bloom)
+        post_bloom(p, source);
+
+    bool fxaa = p->config.aa == POST_AA_FXAA;
+    if(fxaa && (p->ldr_width != window_width || p->ldr_height != window_height)) {
+        if(p->ldr_tex)
+            post_destroy_ldr(p);
+        // FXAA works on tone mapped, gamma encoded colour
+        post_texture(&p->ldr_tex, GL_RGBA8, window_width, window_height, GL_RGBA, GL_UNSIGNED_BYTE, GL_LINEAR);
+        glGenFramebuffers(1, &p->ldr_fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, p->ldr_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p->ldr_tex, 0);
+        p->ldr_width = window_width;
+        p->ldr_height = window_height;
+    }
+
+    gpu_timer_begin(&p->composite_timer);
+    glBindFramebuffer(GL_FRAMEBUFFER, fxaa ? p->ldr_fbo : 0);
+    glViewport(0, 0, window_width, window_height);
+    glUseProgram(p->composite_program);
+    glUniform1f(p->loc_exposure, p->config.exposure);
+    glUniform1f(p->loc_bloom_intensity, bloom ? p->config.bloom_intensity : 0.0f);
+    bool upscaled = p->view_width < window_width || p->view_height < window_height;
+    glUniform1f(p->loc_sharpness, upscaled ? p->config.sharpness : 0.0f);
+    glUniform2f(p->loc_composite_texel, 1.0f / p->width, 1.0f / p->height);
+    post_uv_scale(p->loc_composite_uv, p->view_width, p->view_height, p->width, p->height);
+    int bw, bh, bvw, bvh;
+    post_bloom_size(p, 0, &bw, &bh);
+    post_bloom_view(p, 0, &bvw, &bvh);
+    post_uv_scale(p->loc_bloom_uv, bvw, bvh, bw, bh);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, p->bloom_tex);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, source);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    gpu_timer_end(&p->composite_timer);
+
+    if(fxaa) {
+        gpu_timer_begin(&p->aa_timer);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glUseProgram(p->fxaa_program);
+        glUniform2f(p->loc_fxaa_texel, 1.0f / window_width, 1.0f / window_height);
+        glBindTexture(GL_TEXTURE_2D, p->ldr_tex);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        gpu_timer_end(&p->aa_timer);
+    }
+
+    glBindVertexArray(0);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+}
+
+size_t
+post_memory(const Post *p)
+{
+    // RGBA16F and DEPTH24_STENCIL8, then the bloom chain at 4 bytes
+    size_t pixels = (size_t)p->width * p->height;
+    size_t bytes = pixels * 12;
+    for(int level = 0; level < p->bloom_levels; level++) {
+        int w, h;
+        post_bloom_size(p, level, &w, &h);
+        bytes += (size_t)w * h * 4;
+    }
+    bytes += pixels * 12 * p->samples;
+    if(p->history_tex[0])
+        bytes += pixels * 8 * 2;
+    if(p->ldr_tex)
+        bytes += (size_t)p->ldr_width * p->ldr_height * 4;
+    return bytes;
+}
+
+void
+post_destroy(Post *p)
+{
+    if(p->hdr_tex)
+        post_destroy_targets(p);
+    if(p->ldr_tex)
+        post_destroy_ldr(p);
+    glDeleteVertexArrays(1, &p->empty_vao);
+    gpu_timer_destroy(&p->aa_timer);
+    gpu_timer_destroy(&p->bloom_down_timer);
+    gpu_timer_destroy(&p->bloom_up_timer);
+    gpu_timer_destroy(&p->composite_timer);
+}
@@ -0,0 +1,113 @@
+#ifndef __POST__H__
+#define __POST__H__
+
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "gpu_timer.h"
+
+/*
+ * HDR post processing. The scene is drawn into an RGBA16F target of the
+ * window size times render_scale, with a depth texture later passes can
+ * sample. Dynamic resolution draws a smaller frame into the bottom left
+ * corner of the same targets, so changing the scale allocates nothing and
+ * keeps the TAA history; every pass reads its inputs by the part of them
+ * the frame covered. post_end then runs
+ *   1. a bright pass fused into the first downsample, HDR to half size
+ *   2. downsamples down the R11F_G11F_B10F bloom chain, one mip a pass
+ *   3. upsamples back up it with a tent filter, each blended onto the mip
+ *      above so no pass combines them
+ *   4. bloom, exposure, tone mapping, gamma and the scale to the window in
+ *      a single full screen pass into the default framebuffer, sharpened
+ *      when the scene was drawn smaller than the window
+ * Only the first and last passes touch every pixel.
+ *
+ * Anti-aliasing hooks in around that:
+ *   msaa  the scene draws into multisampled renderbuffers instead, they
+ *         are resolved into the HDR target by a blit first. Forward only,
+ *         the G-buffer isn't multisampled
+ *   fxaa  the composite pass writes an RGBA8 target at window size and
+ *         one more pass filters it into the default framebuffer
+ *   taa   the projection is jittered a subpixel every frame and a pass
+ *         before bloom blends the scene with last frame's result,
+ *         reprojected from depth and clamped to the new neighbourhood.
+ *         Camera motion only, moving objects lean on the clamp
+ */
+
+enum { POST_OFF, POST_TONEMAP, POST_BLOOM, POST_MODES };
+enum { POST_AA_OFF, POST_AA_MSAA2, POST_AA_MSAA4, POST_AA_MSAA8, POST_AA_FXAA, POST_AA_TAA, POST_AA_MODES };
+
+#define POST_MAX_BLOOM_LEVELS 8
+
+typedef struct {
+    float render_scale;       /* of the window, the size the scene is drawn at */
+    int bloom_levels;         /* the first is half the render size */
+    float bloom_threshold;    /* luminance where bloom starts */
+    float bloom_knee;         /* soft ramp below the threshold */
+    float bloom_intensity;
+    float exposure;
+    float sharpness;          /* 0 to 1, only while the scene is scaled up to the window */
+    int aa;                   /* POST_AA_* */
+    float taa_feedback;       /* of the new frame in the history, the rest is carried over */
+} PostConfig;
+
+typedef struct {
+    unsigned int downsample_program;
+    unsigned int upsample_program;
+    unsigned int composite_program;
+    unsigned int fxaa_program;
+    unsigned int taa_program;
+    /* uniform locations of the programs above, looked up once in post_init */
+    int loc_down_texel, loc_down_uv, loc_down_prefilter, loc_down_threshold;
+    int loc_up_texel, loc_up_uv;
+    int loc_taa_reprojection, loc_taa_jitter, loc_taa_view_size, loc_taa_history_uv, loc_taa_feedback;
+    int loc_exposure, loc_bloom_intensity, loc_sharpness, loc_composite_texel, loc_composite_uv, loc_bloom_uv;
+    int loc_fxaa_texel;
+    unsigned int scene_fbo;   /* what the scene draws into, hdr_fbo or msaa_fbo */
+    unsigned int hdr_fbo;
+    unsigned int hdr_tex;
+    unsigned int depth_tex;
+    unsigned int bloom_fbo;
+    unsigned int bloom_tex;
+    unsigned int empty_vao;
+    int width, height;        /* of the HDR target */
+    int view_width, view_height;  /* the part of it this frame draws into */
+    float scale;              /* of the window, the size this frame is drawn at */
+    int bloom_levels;
+    PostConfig config;
+
+    unsigned int msaa_fbo;
+    unsigned int msaa_color_rb;
+    unsigned int msaa_depth_rb;
+    int samples;              /* 0 without MSAA */
+    unsigned int ldr_fbo;     /* FXAA's input */
+    unsigned int ldr_tex;
+    int ldr_width, ldr_height;
+    unsigned int taa_fbo;
+    unsigned int history_tex[2];
+    int history;              /* the one last frame wrote */
+    vec2 history_uv;          /* the part of it last frame covered */
+    bool history_valid;
+    u32 jitter_index;
+    vec2 jitter;              /* this frame's, in texels */
+    mat4x4 view_projection;   /* unjittered, of this frame and the last */
+    mat4x4 prev_view_projection;
+
+    GpuTimer aa_timer;
+    GpuTimer bloom_down_timer;
+    GpuTimer bloom_up_timer;
+    GpuTimer composite_timer;
+} Post;
+
+const char *post_mode_name(int mode);
+const char *post_aa_name(int aa);
+int post_aa_from_name(const char *name);
+void post_init(Post *p, unsigned int downsample_program, unsigned int upsample_program, unsigned int composite_program,
+               unsigned int fxaa_program, unsigned int taa_program);
+void post_configure(Post *p, PostConfig config, float scale, int window_width, int window_height);
+void post_jitter(Post *p, mat4x4 projection, mat4x4 view_projection);
+void post_end(Post *p, int mode, int window_width, int window_height);
+size_t post_memory(const Post *p);
+void post_destroy(Post *p);
+
+#endif
@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shader.h"
+#include "startup.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define SHADER_MAX_INCLUDES 4
+#define SHADER_INCLUDE "#include \""
+
+static const char *
+shader_stage_name(GLenum type)
+{
+    return type == GL_VERTEX_SHADER ? "VERTEX" : type == GL_GEOMETRY_SHADER ? "GEOMETRY" : "FRAGMENT";
+}
+
+static unsigned int
+shader_create(const char *source, GLenum type)
+{
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    return shader;
+}
+
+static void
+shader_check(unsigned int shader, GLenum type, const char *name)
+{
+    int success;
+    char info_log[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if(!success) {
+        glGetShaderInfoLog(shader, sizeof(info_log), NULL, info_log);
+        ERROR_EXIT(1, "ERROR SHADER %s COMPILATION_FAILED %s\n%s\n", shader_stage_name(type), name, info_log);
+    }
+}
+
+/* A single stage, checked right away, for programs that aren't a vertex and fragment pair. */
+unsigned int
+compile_shader(const char *source, GLenum type)
+{
+    unsigned int shader = shader_create(source, type);
+    shader_check(shader, type, "");
+    return shader;
+}
+
+unsigned int
+link_shader_program(const char *vertex_source, const char *fragment_source, const char *name)
+{
+    unsigned int vertex_shader = shader_create(vertex_source, GL_VERTEX_SHADER);
+    unsigned int fragment_shader = shader_create(fragment_source, GL_FRAGMENT_SHADER);
+    unsigned int program = glCreateProgram();
+
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    glLinkProgram(program);
+
+    // a failed compile always fails the link, so the stages are only asked when it did
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if(!success) {
+        char info_log[512];
+        shader_check(vertex_shader, GL_VERTEX_SHADER, name);
+        shader_check(fragment_shader, GL_FRAGMENT_SHADER, name);
+        glGetProgramInfoLog(program, sizeof(info_log), NULL, info_log);
+        ERROR_EXIT(1, "ERROR SHADER Program LINKING_FAILED %s\n%s\n", name, info_log);
+    }
+
+    glDetachShader(program, vertex_shader);
+    glDetachShader(program, fragment_shader);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    return program;
+}
+
+/* Returns source itself when it includes nothing, else the spliced copy on the scratch arena. */
+static const char *
+shader_expand(Assets *assets, Arena *scratch, const char *filename, const char *source)
+{
+    const char *begin[SHADER_MAX_INCLUDES], *end[SHADER_MAX_INCLUDES], *text[SHADER_MAX_INCLUDES];
+    size_t length[SHADER_MAX_INCLUDES];
+    size_t total = strlen(source);
+    int count = 0;
+    const char *directory_end = strrchr(filename, '/');
+    int directory = directory_end ? (int)(directory_end - filename + 1) : 0;
+
+    for(const char *line = source, *next; line; line = next) {
+        next = strchr(line, '\n');
+        next = next ? next + 1 : NULL;
+        if(strncmp(line, SHADER_INCLUDE, strlen(SHADER_INCLUDE)) != 0)
+            continue;
+        const char *name = line + strlen(SHADER_INCLUDE);
+        const char *quote = strchr(name, '"');
+        if(!quote || memchr(name, '\n', (size_t)(quote - name))) {
+            ERROR_EXIT(1, "Unterminated #include in %s\n", filename);
+        }
+        if(count == SHADER_MAX_INCLUDES) {
+            ERROR_EXIT(1, "More than %d includes in %s\n", SHADER_MAX_INCLUDES, filename);
+        }
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%.*s%.*s", directory, filename, (int)(quote - name), name);
+        begin[count] = line;
+        end[count] = next ? next - 1 : line + strlen(line);     /* the newline stays */
+        text[count] = assets_read(assets, path, scratch, &length[count]);
+        total += length[count] - (size_t)(end[count] - line);
+        count++;
+    }
+    if(!count)
+        return source;
+
+    char *out = arena_push(scratch, total + 1, 1);
+    char *o = out;
+    const char *s = source;
+    for(int i = 0; i < count; i++) {
+        memcpy(o, s, (size_t)(begin[i] - s));
+        o += begin[i] - s;
+        memcpy(o, text[i], length[i]);
+        o += length[i];
+        s = end[i];
+    }
+    strcpy(o, s);
+    return out;
+}
+
+/* The sources only live on the scratch arena until the program is linked. */
+unsigned int
+get_shader_program(Assets *assets, Arena *scratch, const char *vertex_filename, const char *fragment_filename)
+{
+    double begin = startup_now();
+    size_t mark = arena_mark(scratch);
+    const char *vertex_source = shader_expand(assets, scratch, vertex_filename,
+                                              assets_read(assets, vertex_filename, scratch, NULL));
+    const char *fragment_source = shader_expand(assets, scratch, fragment_filename,
+                                                assets_read(assets, fragment_filename, scratch, NULL));
+    unsigned int program = link_shader_program(vertex_source, fragment_source, fragment_filename);
+    arena_pop_to(scratch, mark);
+    startup_end(startup_begin("shaders"), begin);
+
+    fprintf(stdout, "Shader program loaded\n");
+    return program;
+}
@@ -0,0 +1,26 @@
+#ifndef __SHADER__H__
+#define __SHADER__H__
+
+#include <glad/glad.h>
+
+#include "assets.h"
+#include "memory.h"
+
+/*
+ * Shader programs from asset files. The sources are read through the
+ * asset pack (zero copy when stored) onto a scratch arena that is popped
+ * once the program is linked. Both stages are compiled before anything
+ * is queried and only the link status is checked, so a driver that
+ * compiles in the background is never waited on twice; the per stage
+ * logs are only fetched when the link failed.
+ *
+ * A line #include "file" in a source read this way is replaced by that
+ * file, from the same directory. Included files don't include further.
+ */
+
+unsigned int compile_shader(const char *source, GLenum type);
+unsigned int link_shader_program(const char *vertex_source, const char *fragment_source, const char *name);
+unsigned int get_shader_program(Assets *assets, Arena *scratch, const char *vertex_filename,
+                                const char *fragment_filename);
+
+#endif
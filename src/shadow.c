@@ -0,0 +1,256 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "shadow.h"
+#include "frustum.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+/* how far behind a cascade casters are still picked up */
+#define CASTER_EXTENSION 20.0f
+
+static void
+shadow_create_targets(Shadow *s)
+{
+    int layers = s->config.cascade_count;
+
+    glGenTextures(1, &s->depth_tex);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, s->depth_tex);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, s->config.resolution, s->config.resolution,
+                 layers, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    // linear filtering + compare mode gives a free 2x2 PCF tap on most hardware
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    glGenFramebuffers(1, &s->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, s->fbo);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, s->depth_tex, 0, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        ERROR_EXIT(1, "Shadow framebuffer is not complete\n");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static void
+shadow_destroy_targets(Shadow *s)
+{
+    glDeleteTextures(1, &s->depth_tex);
+    glDeleteFramebuffers(1, &s->fbo);
+}
+
+void
+shadow_init(Shadow *s, unsigned int depth_program, ShadowConfig config)
+{
+    s->program = depth_program;
+    s->mesh_uniforms = gpu_mesh_uniforms(depth_program);
+    s->config = config;
+    s->cascade_count = 0;
+    for(int i = 0; i < MAX_CASCADES; i++)
+        gpu_timer_init(&s->timers[i]);
+    shadow_create_targets(s);
+}
+
+void
+shadow_configure(Shadow *s, ShadowConfig config)
+{
+    if(config.cascade_count < 1)
+        config.cascade_count = 1;
+    if(config.cascade_count > MAX_CASCADES)
+        config.cascade_count = MAX_CASCADES;
+
+    int realloc_targets = config.resolution != s->config.resolution ||
+                          config.cascade_count != s->config.cascade_count;
+    s->config = config;
+    if(realloc_targets) {
+        shadow_destroy_targets(s);
+        shadow_create_targets(s);
+    }
+}
+
+static void
+light_look_at(mat4x4 view, vec3 eye, vec3 forward)
+{
+    vec3 up = { 0.0f, 1.0f, 0.0f };
+    if(fabsf(forward[1]) > 0.99f) {
+        up[1] = 0.0f;
+        up[2] = 1.0f;
+    }
+    vec3 center;
+    vec3_add(center, eye, forward);
+    mat4x4_look_at(view, eye, center, up);
+}
+
+void
+shadow_update_point(Shadow *s, vec3 light_pos, vec3 target)
+{
+    Camera light;
+    camera_init(&light, light_pos, 0.0f, 0.0f, 100.0f * (3.141592f / 180.0f), 1.0f, 0.1f, s->config.max_distance);
+    camera_look_at(&light, light_pos, target);
+    camera_update(&light);
+    mat4x4_dup(s->light_matrix[0], light.view_projection);
+
+    s->cascade_count = 1;
+    s->split_far[0] = 1e9f;
+}
+
+void
+shadow_update_cascades(Shadow *s, vec3 to_light, const Camera *camera)
+{
+    const int count = s->config.cascade_count;
+    const float near = 0.1f;
+    const float far = s->config.max_distance;
+    const float lambda = s->config.split_lambda;
+
+    const float *right = camera->right, *up = camera->up;
+
+    float tan_y = tanf(camera->fov * 0.5f);
+    float tan_x = tan_y * camera->aspect;
+
+    vec3 forward;
+    vec3_scale(forward, to_light, -1.0f);
+    vec3_norm(forward, forward);
+    vec3 origin = { 0.0f, 0.0f, 0.0f };
+    mat4x4 light_view;
+    light_look_at(light_view, origin, forward);
+
+    float split_near = near;
+    for(int c = 0; c < count; c++) {
+        float t = (float)(c + 1) / count;
+        float split_uniform = near + (far - near) * t;
+        float split_log = near * powf(far / near, t);
+        float split_far = lambda * split_log + (1.0f - lambda) * split_uniform;
+
+        // bounding sphere of the slice, stays the same size while the camera turns
+        vec3 corners[8];
+        float depths[2] = { split_near, split_far };
+        vec3 center = { 0.0f, 0.0f, 0.0f };
+        for(int i = 0; i < 8; i++) {
+            float d = depths[i >> 2];
+            float sx = (i & 1) ? 1.0f : -1.0f;
+            float sy = (i & 2) ? 1.0f : -1.0f;
+            for(int k = 0; k < 3; k++) {
+                corners[i][k] = camera->position[k] + camera->front[k] * d +
+                                right[k] * sx * tan_x * d + up[k] * sy * tan_y * d;
+            }
+            vec3_add(center, center, corners[i]);
+        }
+        vec3_scale(center, center, 1.0f / 8.0f);
+        float radius = 0.0f;
+        for(int i = 0; i < 8; i++) {
+            vec3 diff;
+            vec3_sub(diff, corners[i], center);
+            float len = vec3_len(diff);
+            if(len > radius)
+                radius = len;
+        }
+        radius = ceilf(radius * 16.0f) / 16.0f;
+
+        // snap to whole texels so the map does not shimmer when the camera moves
+        vec4 c4 = { center[0], center[1], center[2], 1.0f };
+        vec4 ls;
+        mat4x4_mul_vec4(ls, light_view, c4);
+        float texel = 2.0f * radius / s->config.resolution;
+        ls[0] = floorf(ls[0] / texel) * texel;
+        ls[1] = floorf(ls[1] / texel) * texel;
+
+        mat4x4 projection;
+        mat4x4_ortho(projection, ls[0] - radius, ls[0] + radius, ls[1] - radius, ls[1] + radius,
+                     -ls[2] - radius - CASTER_EXTENSION, -ls[2] + radius);
+        mat4x4_mul(s->light_matrix[c], projection, light_view);
+        s->split_far[c] = split_far;
+        split_near = split_far;
+    }
+    s->cascade_count = count;
+}
+
+void
+shadow_render(Shadow *s, mat4x4 *models, const float *radii, const u8 *mesh_ids, const u8 *lods, int count,
+              const GpuMesh *meshes)
+{
+    int res = s->config.resolution;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, s->fbo);
+    glViewport(0, 0, res, res);
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_CULL_FACE);
+    glCullFace(GL_FRONT);
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(1.5f, 4.0f);
+
+    glUseProgram(s->program);
+    int model_loc = glGetUniformLocation(s->program, "model");
+    mat4x4 identity;
+    mat4x4_identity(identity);
+    glUniformMatrix4fv(glGetUniformLocation(s->program, "view"), 1, GL_FALSE, (GLfloat*)identity);
+
+    for(int c = 0; c < s->cascade_count; c++) {
+        gpu_timer_begin(&s->timers[c]);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, s->depth_tex, 0, c);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glUniformMatrix4fv(glGetUniformLocation(s->program, "projection"), 1, GL_FALSE, (GLfloat*)s->light_matrix[c]);
+
+        // casters in front of the near plane still throw shadows into the cascade
+        vec4 planes[FRUSTUM_PLANES];
+        frustum_from_matrix(planes, s->light_matrix[c]);
+        unsigned int mask = FRUSTUM_ALL_PLANES & ~(1u << FRUSTUM_NEAR);
+
+        // casters use the level the camera picked, their silhouette matches what is seen
+        s->drawn[c] = 0;
+        int bound = -1;
+        for(int i = 0; i < count; i++) {
+            if(!frustum_test_sphere(planes, models[i][3], radii[i], mask))
+                continue;
+            if(mesh_ids[i] != bound) {
+                bound = mesh_ids[i];
+                gpu_mesh_bind(&meshes[bound], &s->mesh_uniforms);
+            }
+            glUniformMatrix4fv(model_loc, 1, GL_FALSE, (GLfloat*)models[i]);
+            gpu_mesh_draw_lod(&meshes[bound], lods[i]);
+            s->drawn[c]++;
+        }
+        gpu_timer_end(&s->timers[c]);
+    }
+
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glDisable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void
+shadow_bind(Shadow *s, unsigned int program, int texture_unit)
+{
+    glActiveTexture(GL_TEXTURE0 + texture_unit);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, s->depth_tex);
+    glActiveTexture(GL_TEXTURE0);
+
+    glUniform1i(glGetUniformLocation(program, "shadowMap"), texture_unit);
+    glUniform1i(glGetUniformLocation(program, "cascadeCount"), s->cascade_count);
+    glUniform1i(glGetUniformLocation(program, "pcfRadius"), s->config.pcf_radius);
+    glUniformMatrix4fv(glGetUniformLocation(program, "lightMatrix"), s->cascade_count, GL_FALSE,
+                       (GLfloat*)s->light_matrix);
+    glUniform1fv(glGetUniformLocation(program, "cascadeSplits"), s->cascade_count, s->split_far);
+}
+
+size_t
+shadow_memory(const Shadow *s)
+{
+    return (size_t)s->config.resolution * s->config.resolution * 4 * s->config.cascade_count;
+}
+
+void
+shadow_destroy(Shadow *s)
+{
+    shadow_destroy_targets(s);
+    for(int i = 0; i < MAX_CASCADES; i++)
+        gpu_timer_destroy(&s->timers[i]);
+}
@@ -0,0 +1,45 @@
+#ifndef __SHADOW__H__
+#define __SHADOW__H__
+
+#include <linmath.h>
+
+#include "camera.h"
+#include "gpu_timer.h"
+#include "vertex_format.h"
+
+#define MAX_CASCADES 4
+/* lit programs sample the shadow map array from this unit */
+#define SHADOW_TEXTURE_UNIT 3
+
+typedef struct {
+    int resolution;        /* per cascade, square */
+    int cascade_count;     /* 1 renders a single perspective map from the light */
+    int pcf_radius;        /* 0: one hardware 2x2 tap, n: (2n+1)^2 taps */
+    float split_lambda;    /* 0 uniform splits, 1 logarithmic */
+    float max_distance;    /* cascades cover the view up to this distance */
+} ShadowConfig;
+
+typedef struct {
+    ShadowConfig config;
+    unsigned int fbo;
+    unsigned int depth_tex;
+    unsigned int program;
+    GpuMeshUniforms mesh_uniforms;
+    int cascade_count;
+    mat4x4 light_matrix[MAX_CASCADES];
+    float split_far[MAX_CASCADES];
+    int drawn[MAX_CASCADES];
+    GpuTimer timers[MAX_CASCADES];
+} Shadow;
+
+void shadow_init(Shadow *s, unsigned int depth_program, ShadowConfig config);
+void shadow_configure(Shadow *s, ShadowConfig config);
+void shadow_update_point(Shadow *s, vec3 light_pos, vec3 target);
+void shadow_update_cascades(Shadow *s, vec3 to_light, const Camera *camera);
+void shadow_render(Shadow *s, mat4x4 *models, const float *radii, const u8 *mesh_ids, const u8 *lods, int count,
+                   const GpuMesh *meshes);
+void shadow_bind(Shadow *s, unsigned int program, int texture_unit);
+size_t shadow_memory(const Shadow *s);
+void shadow_destroy(Shadow *s);
+
+#endif
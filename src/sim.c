@@ -0,0 +1,72 @@
+#include <math.h>
+
+#include "sim.h"
+
+#define CAMERA_SPEED 2.5f
+
+static void
+sim_step(SimState *s, const SimInput *input, float dt)
+{
+    const float distance = CAMERA_SPEED * dt;
+
+    vec3 temp;
+    vec3_scale(temp, input->front, distance * input->move_forward);
+    vec3_add(s->camera_pos, s->camera_pos, temp);
+
+    vec3_scale(temp, input->right, distance * input->move_right);
+    vec3_add(s->camera_pos, s->camera_pos, temp);
+
+    s->time += dt;
+    s->light_pos[0] = sinf((float)s->time) * 2.0f;
+    s->light_pos[1] = 1.0f;
+    s->light_pos[2] = cosf((float)s->time) * 2.0f;
+}
+
+void
+sim_init(Sim *sim, vec3 camera_pos)
+{
+    SimState *s = &sim->current;
+    s->time = 0.0;
+    vec3_dup(s->camera_pos, camera_pos);
+    s->light_pos[0] = 0.0f;
+    s->light_pos[1] = 1.0f;
+    s->light_pos[2] = 2.0f;
+
+    sim->previous = sim->current;
+    sim->accumulator = 0.0;
+    sim->steps = 0;
+}
+
+/* Returns the number of fixed steps taken for this frame. */
+int
+sim_advance(Sim *sim, double frame_time, const SimInput *input)
+{
+    if(frame_time > SIM_MAX_FRAME)
+        frame_time = SIM_MAX_FRAME;
+    sim->accumulator += frame_time;
+
+    int steps = 0;
+    while(sim->accumulator >= SIM_DT) {
+        sim->previous = sim->current;
+        sim_step(&sim->current, input, (float)SIM_DT);
+        sim->accumulator -= SIM_DT;
+        steps++;
+    }
+    sim->steps += steps;
+    return steps;
+}
+
+/* Blends the last two states by how far the accumulator is into the next step. */
+void
+sim_interpolate(const Sim *sim, SimState *out)
+{
+    const SimState *a = &sim->previous;
+    const SimState *b = &sim->current;
+    float alpha = (float)(sim->accumulator / SIM_DT);
+
+    out->time = a->time + (b->time - a->time) * alpha;
+    for(int i = 0; i < 3; i++) {
+        out->camera_pos[i] = a->camera_pos[i] + (b->camera_pos[i] - a->camera_pos[i]) * alpha;
+        out->light_pos[i] = a->light_pos[i] + (b->light_pos[i] - a->light_pos[i]) * alpha;
+    }
+}
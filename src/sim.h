@@ -0,0 +1,35 @@
+#ifndef __SIM__H__
+#define __SIM__H__
+
+#include <linmath.h>
+
+/* the simulation always advances in steps of exactly this many seconds */
+#define SIM_DT (1.0 / 120.0)
+/* longest frame the accumulator accepts, avoids the spiral of death after a stall */
+#define SIM_MAX_FRAME 0.25
+
+typedef struct {
+    float move_forward;   /* -1 back, 1 forward */
+    float move_right;     /* -1 left, 1 right */
+    vec3 front;
+    vec3 right;           /* unit length, from the camera's cached basis */
+} SimInput;
+
+typedef struct {
+    double time;
+    vec3 camera_pos;
+    vec3 light_pos;
+} SimState;
+
+typedef struct {
+    SimState previous;
+    SimState current;
+    double accumulator;
+    unsigned long long steps;
+} Sim;
+
+void sim_init(Sim *sim, vec3 camera_pos);
+int sim_advance(Sim *sim, double frame_time, const SimInput *input);
+void sim_interpolate(const Sim *sim, SimState *out);
+
+#endif
@@ -0,0 +1,49 @@
+#include <string.h>
+
+#include "spsc.h"
+
+void
+spsc_init(SpscQueue *q, void *storage, size_t item_size, size_t capacity)
+{
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    q->storage = storage;
+    q->item_size = item_size;
+    q->mask = capacity - 1;
+}
+
+/* Returns 0 when the queue is full. Producer thread only. */
+int
+spsc_push(SpscQueue *q, const void *item)
+{
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    if(tail - head > q->mask)
+        return 0;
+
+    memcpy(q->storage + (tail & q->mask) * q->item_size, item, q->item_size);
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+/* Returns 0 when the queue is empty. Consumer thread only. */
+int
+spsc_pop(SpscQueue *q, void *item)
+{
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if(head == tail)
+        return 0;
+
+    memcpy(item, q->storage + (head & q->mask) * q->item_size, q->item_size);
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return 1;
+}
+
+size_t
+spsc_size(SpscQueue *q)
+{
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    return tail - head;
+}
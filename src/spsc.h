@@ -0,0 +1,26 @@
+#ifndef __SPSC__H__
+#define __SPSC__H__
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/*
+ * Lock-free single producer / single consumer ring of fixed size items.
+ * Items are copied in and out, capacity must be a power of two. head is
+ * only written by the consumer and tail only by the producer, they live
+ * on separate cache lines so the two threads do not false share.
+ */
+typedef struct {
+    _Alignas(64) atomic_size_t head;
+    _Alignas(64) atomic_size_t tail;
+    _Alignas(64) unsigned char *storage;
+    size_t item_size;
+    size_t mask;
+} SpscQueue;
+
+void spsc_init(SpscQueue *q, void *storage, size_t item_size, size_t capacity);
+int spsc_push(SpscQueue *q, const void *item);
+int spsc_pop(SpscQueue *q, void *item);
+size_t spsc_size(SpscQueue *q);
+
+#endif
@@ -0,0 +1,120 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "startup.h"
+
+static struct {
+    pthread_mutex_t lock;
+    struct timespec origin;
+    double before_main_ms;      /* negative when /proc isn't there */
+    StartupPhase phases[STARTUP_MAX_PHASES];
+    int count;
+    bool reported;
+} startup = { .lock = PTHREAD_MUTEX_INITIALIZER, .before_main_ms = -1.0 };
+
+/* process start time, in the same boot clock the kernel stamps it with */
+static double
+startup_exec_age_ms(void)
+{
+    FILE *file = fopen("/proc/self/stat", "r");
+    if(!file)
+        return -1.0;
+    char line[1024];
+    size_t length = fread(line, 1, sizeof(line) - 1, file);
+    fclose(file);
+    line[length] = '\0';
+
+    // the command name may contain spaces, the fields after it are counted from the closing paren
+    char *p = strrchr(line, ')');
+    if(!p)
+        return -1.0;
+    unsigned long long start_ticks = 0;
+    for(int field = 2; field < 22 && p; field++)
+        p = strchr(p + 1, ' ');
+    if(!p || sscanf(p + 1, "%llu", &start_ticks) != 1)
+        return -1.0;
+
+    struct timespec now;
+    clock_gettime(CLOCK_BOOTTIME, &now);
+    double now_ms = now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+    return now_ms - start_ticks * 1000.0 / sysconf(_SC_CLK_TCK);
+}
+
+void
+startup_init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &startup.origin);
+    startup.before_main_ms = startup_exec_age_ms();
+}
+
+double
+startup_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec - startup.origin.tv_sec) * 1000.0 + (ts.tv_nsec - startup.origin.tv_nsec) / 1000000.0;
+}
+
+/* -1 once the table is full, startup_end ignores that */
+int
+startup_begin(const char *name)
+{
+    pthread_mutex_lock(&startup.lock);
+    int i = 0;
+    while(i < startup.count && strcmp(startup.phases[i].name, name))
+        i++;
+    if(i == startup.count) {
+        if(i == STARTUP_MAX_PHASES) {
+            pthread_mutex_unlock(&startup.lock);
+            return -1;
+        }
+        memset(&startup.phases[i], 0, sizeof(StartupPhase));
+        startup.phases[i].name = name;
+        startup.count++;
+    }
+    pthread_mutex_unlock(&startup.lock);
+    return i;
+}
+
+void
+startup_end(int phase, double begin_ms)
+{
+    if(phase < 0)
+        return;
+    double end_ms = startup_now();
+    pthread_mutex_lock(&startup.lock);
+    StartupPhase *p = &startup.phases[phase];
+    if(!p->count)
+        p->first_ms = begin_ms;
+    p->count++;
+    p->last_ms = end_ms;
+    p->total_ms += end_ms - begin_ms;
+    pthread_mutex_unlock(&startup.lock);
+}
+
+/* Call after the first swap, only the first call prints. */
+void
+startup_first_frame(FILE *out)
+{
+    double now = startup_now();
+    pthread_mutex_lock(&startup.lock);
+    if(startup.reported) {
+        pthread_mutex_unlock(&startup.lock);
+        return;
+    }
+    startup.reported = true;
+
+    fprintf(out, "Startup, first frame %.1f ms after main", now);
+    if(startup.before_main_ms >= 0.0)
+        fprintf(out, " (+%.0f ms exec to main, 10 ms ticks)", startup.before_main_ms);
+    fprintf(out, "\n  %-20s %5s %10s %16s\n", "phase", "count", "total ms", "from - to ms");
+    for(int i = 0; i < startup.count; i++) {
+        const StartupPhase *p = &startup.phases[i];
+        fprintf(out, "  %-20s %5u %10.3f %7.1f - %6.1f\n", p->name, p->count, p->total_ms, p->first_ms,
+                p->last_ms);
+    }
+    pthread_mutex_unlock(&startup.lock);
+}
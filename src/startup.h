@@ -0,0 +1,46 @@
+#ifndef __STARTUP__H__
+#define __STARTUP__H__
+
+#include <stdio.h>
+
+#include "untitled_types.h"
+
+/*
+ * Where the time between exec and the first presented frame goes.
+ * startup_init runs first thing in main and is the origin of the
+ * timeline; every phase is bracketed by startup_begin and startup_end
+ * from whichever thread does the work, phases with the same name are
+ * summed (one line for all the shaders), and startup_first_frame prints
+ * the breakdown once. The time before main, exec and the dynamic linker,
+ * comes from /proc/self/stat in clock ticks, so it is only good to 10 ms.
+ *
+ * Phases on different threads overlap, so the durations add up to more
+ * than the wall time when the render thread and the main thread load in
+ * parallel.
+ */
+
+#define STARTUP_MAX_PHASES 32
+
+typedef struct {
+    const char *name;
+    u32 count;
+    double first_ms, last_ms;   /* since startup_init, start of the first and end of the last */
+    double total_ms;
+} StartupPhase;
+
+void startup_init(void);
+double startup_now(void);
+int startup_begin(const char *name);
+void startup_end(int phase, double begin_ms);
+void startup_first_frame(FILE *out);
+
+/* brackets a statement */
+#define STARTUP_PHASE(name, statement) \
+    do { \
+        double startup_begin_ms_ = startup_now(); \
+        int startup_phase_ = startup_begin(name); \
+        statement; \
+        startup_end(startup_phase_, startup_begin_ms_); \
+    } while(0)
+
+#endif
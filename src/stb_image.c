@@ -0,0 +1,5 @@
+/* stb_image's implementation, once for the whole program */
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+// a unity build includes more modules after this one, they only want the declarations
+#undef STB_IMAGE_IMPLEMENTATION
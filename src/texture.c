@@ -0,0 +1,41 @@
+#include <glad/glad.h>
+#include <stdio.h>
+#include <stb_image.h>
+
+#include "texture.h"
+#include "startup.h"
+
+unsigned int
+texture_load(Assets *assets, Arena *scratch, const char *name, bool flip)
+{
+    double begin = startup_now();
+    size_t mark = arena_mark(scratch), size;
+    const char *file = assets_read(assets, name, scratch, &size);
+
+    int width, height, channels;
+    stbi_set_flip_vertically_on_load(flip);
+    u8 *pixels = stbi_load_from_memory((const u8 *)file, (int)size, &width, &height, &channels, 0);
+    arena_pop_to(scratch, mark);
+    if(!pixels) {
+        fprintf(stderr, "Failed to load texture %s: %s\n", name, stbi_failure_reason());
+        return 0;
+    }
+
+    static const GLenum formats[] = { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+    GLenum format = formats[channels - 1];
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // rows of a 3 channel image aren't 4 byte aligned in general
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, (GLint)format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    stbi_image_free(pixels);
+    startup_end(startup_begin("textures"), begin);
+    return texture;
+}
@@ -0,0 +1,16 @@
+#ifndef __TEXTURE__H__
+#define __TEXTURE__H__
+
+#include "assets.h"
+#include "memory.h"
+
+/*
+ * 2D textures decoded straight from the asset's bytes, the pack mapping
+ * when it is stored there, so the file is never copied before stb_image
+ * sees it. Repeating, trilinear, with mipmaps. Returns 0 when the image
+ * doesn't decode.
+ */
+
+unsigned int texture_load(Assets *assets, Arena *scratch, const char *name, bool flip);
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef __TIMING__H__
+#define __TIMING__H__
+
+#include <time.h>
+
+/* Milliseconds on CLOCK_MONOTONIC, the clock every timing report uses. */
+static inline double
+now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+#endif
@@ -0,0 +1,306 @@
+#include <glad/glad.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vertex_format.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+u32
+vertex_format_stride(VertexFormat f)
+{
+    u32 position = f.position == POSITION_FLOAT ? 12 : 8;
+    u32 normal = f.normal == NORMAL_FLOAT ? 12 : 4;
+    return position + normal;
+}
+
+const char *
+vertex_format_name(VertexFormat f)
+{
+    static const char *positions[] = { "float", "half", "snorm16", "unorm16" };
+    static const char *normals[] = { "float", "2_10_10_10", "octahedral" };
+    static char name[64];
+    snprintf(name, sizeof(name), "%s positions, %s normals", positions[f.position], normals[f.normal]);
+    return name;
+}
+
+/* Round to nearest, no denormals, enough for positions relative to the bounds center. */
+static u16
+float_to_half(float value)
+{
+    u32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    u32 sign = (bits >> 16) & 0x8000;
+    int exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+    u32 mantissa = bits & 0x7fffff;
+    if(exponent <= 0)
+        return (u16)sign;
+    if(exponent >= 31)
+        return (u16)(sign | 0x7c00);
+    u32 half = sign | (u32)exponent << 10 | mantissa >> 13;
+    // the carry of rounding can ripple into the exponent, which is still correct
+    if(mantissa & 0x1000)
+        half++;
+    return (u16)half;
+}
+
+static i16
+snorm16(float value)
+{
+    value = value < -1.0f ? -1.0f : value > 1.0f ? 1.0f : value;
+    return (i16)roundf(value * 32767.0f);
+}
+
+static u32
+pack_2_10_10_10(const float *n)
+{
+    u32 packed = 0;
+    for(int k = 0; k < 3; k++) {
+        float v = n[k] < -1.0f ? -1.0f : n[k] > 1.0f ? 1.0f : n[k];
+        int q = (int)roundf(v * 511.0f);
+        packed |= ((u32)q & 0x3ff) << (10 * k);
+    }
+    return packed;
+}
+
+/*
+ * Interleaved position + normal in format f. offset and scale receive
+ * the dequantization the shader has to apply.
+ */
+void *
+vertex_format_encode(VertexFormat f, const Mesh *m, vec3 offset, vec3 scale)
+{
+    u32 stride = vertex_format_stride(f);
+    u8 *data = calloc(m->vertex_count ? m->vertex_count : 1, stride);
+    if(!data) {
+        ERROR_EXIT(1, "Couldn't malloc\n");
+    }
+
+    vec3 center, extent;
+    for(int k = 0; k < 3; k++) {
+        center[k] = (m->min[k] + m->max[k]) * 0.5f;
+        extent[k] = (m->max[k] - m->min[k]) * 0.5f;
+        if(extent[k] == 0.0f)
+            extent[k] = 1.0f;
+    }
+    switch(f.position) {
+    case POSITION_FLOAT:
+        vec3_scale(offset, offset, 0.0f);
+        scale[0] = scale[1] = scale[2] = 1.0f;
+        break;
+    case POSITION_HALF:
+        vec3_dup(offset, center);
+        scale[0] = scale[1] = scale[2] = 1.0f;
+        break;
+    case POSITION_SNORM16:
+        vec3_dup(offset, center);
+        vec3_dup(scale, extent);
+        break;
+    case POSITION_UNORM16:
+        vec3_dup(offset, m->min);
+        vec3_scale(scale, extent, 2.0f);
+        break;
+    }
+
+    for(u32 i = 0; i < m->vertex_count; i++) {
+        u8 *vertex = data + (size_t)i * stride;
+        const float *p = &m->positions[i * 3];
+        u16 *q = (u16 *)vertex;
+        switch(f.position) {
+        case POSITION_FLOAT:
+            memcpy(vertex, p, 12);
+            break;
+        case POSITION_HALF:
+            for(int k = 0; k < 3; k++)
+                q[k] = float_to_half(p[k] - offset[k]);
+            q[3] = 0x3c00;
+            break;
+        case POSITION_SNORM16:
+            for(int k = 0; k < 3; k++)
+                q[k] = (u16)snorm16((p[k] - offset[k]) / scale[k]);
+            q[3] = 32767;
+            break;
+        case POSITION_UNORM16:
+            for(int k = 0; k < 3; k++) {
+                float t = (p[k] - offset[k]) / scale[k];
+                q[k] = (u16)(fminf(fmaxf(t, 0.0f), 1.0f) * 65535.0f + 0.5f);
+            }
+            q[3] = 65535;
+            break;
+        }
+
+        u8 *normal = vertex + (f.position == POSITION_FLOAT ? 12 : 8);
+        const float *n = &m->normals[i * 3];
+        if(f.normal == NORMAL_FLOAT) {
+            memcpy(normal, n, 12);
+        } else if(f.normal == NORMAL_INT_2_10_10_10) {
+            u32 packed = pack_2_10_10_10(n);
+            memcpy(normal, &packed, 4);
+        } else {
+            float oct[2];
+            mesh_oct_encode(n, oct);
+            i16 encoded[2] = { snorm16(oct[0]), snorm16(oct[1]) };
+            memcpy(normal, encoded, 4);
+        }
+    }
+    return data;
+}
+
+static void
+set_attributes(VertexFormat f, u32 stride, size_t position_offset, size_t normal_offset)
+{
+    // glVertexAttribPointer with normalized integers gives floats in the shader, nothing else changes
+    switch(f.position) {
+    case POSITION_FLOAT:
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void *)position_offset);
+        break;
+    case POSITION_HALF:
+        glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, stride, (void *)position_offset);
+        break;
+    case POSITION_SNORM16:
+        glVertexAttribPointer(0, 4, GL_SHORT, GL_TRUE, stride, (void *)position_offset);
+        break;
+    case POSITION_UNORM16:
+        glVertexAttribPointer(0, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride, (void *)position_offset);
+        break;
+    }
+    glEnableVertexAttribArray(0);
+
+    switch(f.normal) {
+    case NORMAL_FLOAT:
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void *)normal_offset);
+        break;
+    case NORMAL_INT_2_10_10_10:
+        glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void *)normal_offset);
+        break;
+    case NORMAL_OCTAHEDRAL:
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride, (void *)normal_offset);
+        break;
+    }
+    glEnableVertexAttribArray(1);
+}
+
+static void
+upload_indices(GpuMesh *g, const void *indices, u32 index_size)
+{
+    g->index_type = index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    g->index_bytes = (size_t)g->index_count * index_size;
+    glGenBuffers(1, &g->ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g->ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, g->index_bytes, indices, GL_STATIC_DRAW);
+}
+
+void
+gpu_mesh_create(GpuMesh *g, const Mesh *m, VertexFormat f)
+{
+    memset(g, 0, sizeof(*g));
+    g->format = f;
+    g->vertex_count = m->vertex_count;
+    g->index_count = m->index_count;
+    g->stride = vertex_format_stride(f);
+    g->vertex_bytes = (size_t)g->stride * m->vertex_count;
+    g->lod_count = m->lod_count;
+    memcpy(g->lods, m->lods, sizeof(MeshLod) * m->lod_count);
+    void *vertices = vertex_format_encode(f, m, g->position_offset, g->position_scale);
+
+    glGenVertexArrays(1, &g->vao);
+    glBindVertexArray(g->vao);
+    glGenBuffers(1, &g->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, g->vbo);
+    glBufferData(GL_ARRAY_BUFFER, g->vertex_bytes, vertices, GL_STATIC_DRAW);
+    set_attributes(f, g->stride, 0, f.position == POSITION_FLOAT ? 12 : 8);
+
+    if(m->vertex_count <= 65536) {
+        u16 *indices = malloc(sizeof(u16) * (m->index_count ? m->index_count : 1));
+        if(!indices) {
+            ERROR_EXIT(1, "Couldn't malloc\n");
+        }
+        for(u32 i = 0; i < m->index_count; i++)
+            indices[i] = (u16)m->indices[i];
+        upload_indices(g, indices, 2);
+        free(indices);
+    } else {
+        upload_indices(g, m->indices, 4);
+    }
+    glBindVertexArray(0);
+    free(vertices);
+}
+
+/*
+ * The cache already is unorm16 positions + octahedral normals, its sections
+ * go to the GPU as they are. mesh_map_cache has checked them against the file.
+ */
+void
+gpu_mesh_create_from_cache(GpuMesh *g, const MeshView *v)
+{
+    const MeshCacheHeader *h = v->header;
+    memset(g, 0, sizeof(*g));
+    g->format = (VertexFormat){ POSITION_UNORM16, NORMAL_OCTAHEDRAL };
+    g->vertex_count = h->vertex_count;
+    g->index_count = h->index_count;
+    g->stride = vertex_format_stride(g->format);
+    g->vertex_bytes = (size_t)g->stride * h->vertex_count;
+    memcpy(g->position_offset, h->position_min, sizeof(vec3));
+    memcpy(g->position_scale, h->position_scale, sizeof(vec3));
+    g->lod_count = h->lod_count;
+    memcpy(g->lods, h->lods, sizeof(MeshLod) * h->lod_count);
+
+    size_t positions = (size_t)h->vertex_count * 8, normals = (size_t)h->vertex_count * 4;
+    glGenVertexArrays(1, &g->vao);
+    glBindVertexArray(g->vao);
+    glGenBuffers(1, &g->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, g->vbo);
+    glBufferData(GL_ARRAY_BUFFER, positions + normals, NULL, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, positions, v->positions);
+    glBufferSubData(GL_ARRAY_BUFFER, positions, normals, v->normals);
+    // two streams instead of interleaved, stride 0 means tightly packed
+    set_attributes(g->format, 0, 0, positions);
+    upload_indices(g, v->indices, h->index_size);
+    glBindVertexArray(0);
+}
+
+GpuMeshUniforms
+gpu_mesh_uniforms(unsigned int program)
+{
+    GpuMeshUniforms u;
+    u.position_offset = glGetUniformLocation(program, "positionOffset");
+    u.position_scale = glGetUniformLocation(program, "positionScale");
+    u.normal_encoding = glGetUniformLocation(program, "normalEncoding");
+    return u;
+}
+
+/* The program the locations came from has to be in use. */
+void
+gpu_mesh_bind(const GpuMesh *g, const GpuMeshUniforms *u)
+{
+    glBindVertexArray(g->vao);
+    glUniform3fv(u->position_offset, 1, g->position_offset);
+    glUniform3fv(u->position_scale, 1, g->position_scale);
+    glUniform1i(u->normal_encoding, g->format.normal == NORMAL_OCTAHEDRAL);
+}
+
+/* Level 0, the full mesh. */
+void
+gpu_mesh_draw(const GpuMesh *g)
+{
+    gpu_mesh_draw_lod(g, 0);
+}
+
+void
+gpu_mesh_draw_lod(const GpuMesh *g, u32 lod)
+{
+    const MeshLod *l = &g->lods[lod < g->lod_count ? lod : g->lod_count - 1];
+    size_t index_size = g->index_type == GL_UNSIGNED_SHORT ? 2 : 4;
+    glDrawElements(GL_TRIANGLES, l->index_count, g->index_type, (void *)(l->index_offset * index_size));
+}
+
+void
+gpu_mesh_destroy(GpuMesh *g)
+{
+    glDeleteVertexArrays(1, &g->vao);
+    glDeleteBuffers(1, &g->vbo);
+    glDeleteBuffers(1, &g->ebo);
+    memset(g, 0, sizeof(*g));
+}
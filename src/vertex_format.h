@@ -0,0 +1,72 @@
+#ifndef __VERTEX_FORMAT__H__
+#define __VERTEX_FORMAT__H__
+
+#include <stddef.h>
+#include <linmath.h>
+
+#include "untitled_types.h"
+#include "mesh.h"
+
+/*
+ * Vertex layouts for position + normal. Quantized positions are
+ * dequantized in the vertex shader as
+ *
+ *     position = positionOffset + aPos.xyz * positionScale
+ *
+ * and normals are either used as is or octahedral decoded from .xy,
+ * selected by normalEncoding. gpu_mesh_bind sets those uniforms, at
+ * locations each program looks up once with gpu_mesh_uniforms.
+ */
+
+typedef enum {
+    POSITION_FLOAT,           /* 12 bytes */
+    POSITION_HALF,            /* 8 bytes, relative to the bounds center */
+    POSITION_SNORM16,         /* 8 bytes, [-1, 1] over the bounds */
+    POSITION_UNORM16,         /* 8 bytes, [0, 1] over the bounds, the mesh cache layout */
+} PositionFormat;
+
+typedef enum {
+    NORMAL_FLOAT,             /* 12 bytes */
+    NORMAL_INT_2_10_10_10,    /* 4 bytes */
+    NORMAL_OCTAHEDRAL,        /* 4 bytes, snorm16 x 2 */
+} NormalFormat;
+
+typedef struct {
+    PositionFormat position;
+    NormalFormat normal;
+} VertexFormat;
+
+typedef struct {
+    unsigned int vao, vbo, ebo;
+    VertexFormat format;
+    u32 vertex_count;
+    u32 index_count;
+    unsigned int index_type;
+    u32 stride;
+    vec3 position_offset;
+    vec3 position_scale;
+    size_t vertex_bytes;
+    size_t index_bytes;
+    u32 lod_count;
+    MeshLod lods[MESH_MAX_LODS];
+} GpuMesh;
+
+typedef struct {
+    int position_offset;
+    int position_scale;
+    int normal_encoding;
+} GpuMeshUniforms;
+
+u32 vertex_format_stride(VertexFormat f);
+const char *vertex_format_name(VertexFormat f);
+void *vertex_format_encode(VertexFormat f, const Mesh *m, vec3 offset, vec3 scale);
+
+void gpu_mesh_create(GpuMesh *g, const Mesh *m, VertexFormat f);
+void gpu_mesh_create_from_cache(GpuMesh *g, const MeshView *v);
+GpuMeshUniforms gpu_mesh_uniforms(unsigned int program);
+void gpu_mesh_bind(const GpuMesh *g, const GpuMeshUniforms *u);
+void gpu_mesh_draw(const GpuMesh *g);
+void gpu_mesh_draw_lod(const GpuMesh *g, u32 lod);
+void gpu_mesh_destroy(GpuMesh *g);
+
+#endif
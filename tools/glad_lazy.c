@@ -0,0 +1,187 @@
+/*
+ * Generates src/glad_lazy.c from include/glad/glad.h: one stub per GL
+ * entry point with the entry point's own signature. gladLoadGLLazy
+ * points every glad_gl* pointer at its stub, the first call through it
+ * looks the real function up, stores it over the stub and forwards the
+ * call, every later call goes straight to the driver.
+ *
+ *     glad_lazy include/glad/glad.h > src/glad_lazy.c
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+#define MAX_FUNCTIONS 1024
+#define MAX_VERSIONS 32
+
+typedef struct {
+    char pfn[96];
+    char ret[64];
+    char params[512];
+} Typedef;
+
+static Typedef typedefs[MAX_FUNCTIONS];
+static int typedef_count;
+static char names[MAX_FUNCTIONS][64];
+static int name_pfn[MAX_FUNCTIONS];
+static int name_count;
+static char versions[MAX_VERSIONS][64];
+static int version_count;
+
+static void
+trim(char *s)
+{
+    size_t n = strlen(s);
+    while(n && isspace((unsigned char)s[n - 1]))
+        s[--n] = '\0';
+    size_t start = 0;
+    while(isspace((unsigned char)s[start]))
+        start++;
+    memmove(s, s + start, n - start + 1);
+}
+
+/* typedef RET (APIENTRYP PFN...PROC)(PARAMS); */
+static void
+parse_typedef(const char *line)
+{
+    const char *open = strstr(line, "(APIENTRYP ");
+    const char *close = open ? strchr(open, ')') : NULL;
+    const char *params = close ? strchr(close + 1, '(') : NULL;
+    const char *end = params ? strrchr(params, ')') : NULL;
+    if(!end || typedef_count == MAX_FUNCTIONS)
+        return;
+    Typedef *t = &typedefs[typedef_count++];
+    const char *ret = line + strlen("typedef ");
+    snprintf(t->ret, sizeof(t->ret), "%.*s", (int)(open - ret), ret);
+    trim(t->ret);
+    const char *pfn = open + strlen("(APIENTRYP ");
+    snprintf(t->pfn, sizeof(t->pfn), "%.*s", (int)(close - pfn), pfn);
+    snprintf(t->params, sizeof(t->params), "%.*s", (int)(end - params - 1), params + 1);
+}
+
+static int
+find_typedef(const char *pfn)
+{
+    for(int i = 0; i < typedef_count; i++)
+        if(!strcmp(typedefs[i].pfn, pfn))
+            return i;
+    return -1;
+}
+
+/* The argument list for the forwarding call, the last identifier of every parameter. */
+static void
+argument_names(const char *params, char *out, size_t size)
+{
+    out[0] = '\0';
+    if(!strcmp(params, "void"))
+        return;
+    size_t used = 0;
+    const char *p = params;
+    while(*p) {
+        const char *comma = strchr(p, ',');
+        const char *end = comma ? comma : p + strlen(p);
+        const char *name_end = end;
+        while(name_end > p && !isalnum((unsigned char)name_end[-1]) && name_end[-1] != '_')
+            name_end--;
+        const char *name = name_end;
+        while(name > p && (isalnum((unsigned char)name[-1]) || name[-1] == '_'))
+            name--;
+        used += snprintf(out + used, size - used, "%s%.*s", used ? ", " : "", (int)(name_end - name), name);
+        if(!comma)
+            break;
+        p = comma + 1;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    if(argc < 2) {
+        ERROR_EXIT(1, "usage: glad_lazy include/glad/glad.h > src/glad_lazy.c\n");
+    }
+    FILE *file = fopen(argv[1], "r");
+    if(!file) {
+        ERROR_EXIT(1, "Couldn't open file %s\n", argv[1]);
+    }
+    char line[1024];
+    while(fgets(line, sizeof(line), file)) {
+        char pfn[96], name[64];
+        if(!strncmp(line, "typedef ", 8) && strstr(line, "(APIENTRYP PFNGL")) {
+            parse_typedef(line);
+        } else if(sscanf(line, "GLAPI %95s glad_%63[A-Za-z0-9_];", pfn, name) == 2 && !strncmp(pfn, "PFNGL", 5)) {
+            int t = find_typedef(pfn);
+            if(t < 0 || name_count == MAX_FUNCTIONS) {
+                ERROR_EXIT(1, "No typedef for %s\n", pfn);
+            }
+            snprintf(names[name_count], sizeof(names[0]), "%s", name);
+            name_pfn[name_count++] = t;
+        } else if(sscanf(line, "GLAPI int GLAD_GL_VERSION_%31[0-9_];", name) == 1 && version_count < MAX_VERSIONS) {
+            snprintf(versions[version_count++], sizeof(versions[0]), "%s", name);
+        }
+    }
+    fclose(file);
+
+    printf("/*\n"
+           "    Lazy entry points for glad, generated by tools/glad_lazy.c from\n"
+           "    include/glad/glad.h (%d functions). Do not edit, run make glad-lazy.\n"
+           "*/\n\n"
+           "#include <stdio.h>\n"
+           "#include <stdlib.h>\n"
+           "#include <glad/glad.h>\n\n"
+           "#include \"glad_lazy.h\"\n\n"
+           "static GLADloadproc glad_lazy_load;\n"
+           "unsigned int glad_lazy_resolved;\n\n"
+           "static void *\n"
+           "glad_lazy_resolve(const char *name)\n"
+           "{\n"
+           "    void *proc = glad_lazy_load(name);\n"
+           "    if(!proc) {\n"
+           "        fprintf(stderr, \"OpenGL entry point %%s is missing\\n\", name);\n"
+           "        exit(1);\n"
+           "    }\n"
+           "    glad_lazy_resolved++;\n"
+           "    return proc;\n"
+           "}\n\n", name_count);
+
+    for(int i = 0; i < name_count; i++) {
+        const Typedef *t = &typedefs[name_pfn[i]];
+        if(!strcmp(names[i], "glGetString"))
+            continue;           /* resolved up front, the version check needs it */
+        char arguments[512];
+        argument_names(t->params, arguments, sizeof(arguments));
+        int returns = strcmp(t->ret, "void") != 0;
+        printf("static %s APIENTRY glad_lazy_%s(%s)\n{\n", t->ret, names[i], t->params);
+        printf("    glad_%s = (%s)glad_lazy_resolve(\"%s\");\n", names[i], t->pfn, names[i]);
+        printf("    %sglad_%s(%s);\n}\n\n", returns ? "return " : "", names[i], arguments);
+    }
+
+    printf("int\n"
+           "gladLoadGLLazy(GLADloadproc load)\n"
+           "{\n"
+           "    glad_lazy_load = load;\n"
+           "    glad_lazy_resolved = 0;\n"
+           "    GLVersion.major = 0;\n"
+           "    GLVersion.minor = 0;\n"
+           "    glad_glGetString = (PFNGLGETSTRINGPROC)load(\"glGetString\");\n"
+           "    if(!glad_glGetString)\n"
+           "        return 0;\n"
+           "    const char *version = (const char *)glad_glGetString(GL_VERSION);\n"
+           "    if(!version || sscanf(version, \"%%d.%%d\", &GLVersion.major, &GLVersion.minor) != 2)\n"
+           "        return 0;\n");
+    for(int i = 0; i < version_count; i++) {
+        int major = 0, minor = 0;
+        sscanf(versions[i], "%d_%d", &major, &minor);
+        printf("    GLAD_GL_VERSION_%s = (GLVersion.major == %d && GLVersion.minor >= %d) || GLVersion.major > %d;\n",
+               versions[i], major, minor, major);
+    }
+    printf("\n");
+    for(int i = 0; i < name_count; i++) {
+        if(strcmp(names[i], "glGetString"))
+            printf("    glad_%s = glad_lazy_%s;\n", names[i], names[i]);
+    }
+    printf("    return 1;\n}\n");
+    return 0;
+}
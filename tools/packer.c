@@ -0,0 +1,117 @@
+/*
+ * Bundles files into an asset pack (src/pack.h). Directories are walked
+ * recursively, names are stored as given on the command line, so run it
+ * from the directory the game resolves its assets against.
+ *
+ *     packer [--stored] assets.pak shaders teksture
+ *
+ * --stored writes every entry uncompressed.
+ */
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "pack.h"
+
+#define ERROR_EXIT(E, ...) fprintf(stderr, __VA_ARGS__); exit(E)
+
+typedef struct {
+    char **names;
+    int count;
+    int capacity;
+} NameList;
+
+static void
+add_name(NameList *l, const char *name)
+{
+    if(l->count == l->capacity) {
+        l->capacity = l->capacity ? l->capacity * 2 : 64;
+        l->names = realloc(l->names, sizeof(char *) * l->capacity);
+        if(!l->names) {
+            ERROR_EXIT(1, "Couldn't realloc\n");
+        }
+    }
+    l->names[l->count++] = strdup(name);
+}
+
+static void
+add_path(NameList *l, const char *path)
+{
+    struct stat st;
+    if(stat(path, &st) != 0) {
+        ERROR_EXIT(1, "Couldn't stat %s\n", path);
+    }
+    if(!S_ISDIR(st.st_mode)) {
+        add_name(l, path);
+        return;
+    }
+    DIR *dir = opendir(path);
+    if(!dir) {
+        ERROR_EXIT(1, "Couldn't open directory %s\n", path);
+    }
+    struct dirent *d;
+    while((d = readdir(dir))) {
+        if(d->d_name[0] == '.')
+            continue;
+        char child[4096];
+        size_t length = strlen(path);
+        snprintf(child, sizeof(child), "%s%s%s", path, length && path[length - 1] == '/' ? "" : "/", d->d_name);
+        add_path(l, child);
+    }
+    closedir(dir);
+}
+
+static int
+compare_names(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+int
+main(int argc, char **argv)
+{
+    bool compress = true;
+    int first = 1;
+    if(argc > 1 && !strcmp(argv[1], "--stored")) {
+        compress = false;
+        first++;
+    }
+    if(argc - first < 2) {
+        fprintf(stderr, "usage: %s [--stored] output.pak files or directories...\n", argv[0]);
+        return 1;
+    }
+
+    NameList list = {0};
+    for(int i = first + 1; i < argc; i++)
+        add_path(&list, argv[i]);
+    // readdir order isn't stable, sorting keeps the pack reproducible
+    qsort(list.names, list.count, sizeof(char *), compare_names);
+
+    if(!pack_write(argv[first], (const char **)list.names, list.count, compress))
+        return 1;
+
+    Pack pack;
+    if(!pack_open(&pack, argv[first])) {
+        ERROR_EXIT(1, "Couldn't open the pack just written\n");
+    }
+    u64 original = 0, packed = 0;
+    for(u32 b = 0; b < pack.header->bucket_count; b++) {
+        const PackEntry *e = &pack.buckets[b];
+        if(!e->hash)
+            continue;
+        original += e->original_size;
+        packed += e->size;
+        fprintf(stdout, "  %-40.*s %8u -> %8u %s\n", e->name_length, (const char *)pack.base + e->name_offset,
+                e->original_size, e->size, e->compression == PACK_LZ4 ? "lz4" : "stored");
+    }
+    fprintf(stdout, "%s: %d files, %.1f KB -> %.1f KB, %.1f KB on disk\n", argv[first], list.count,
+            original / 1024.0, packed / 1024.0, pack.size / 1024.0);
+    pack_close(&pack);
+
+    for(int i = 0; i < list.count; i++)
+        free(list.names[i]);
+    free(list.names);
+    return 0;
+}